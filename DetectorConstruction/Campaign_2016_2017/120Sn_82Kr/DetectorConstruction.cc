@@ -49,6 +49,7 @@ along with utr.  If not, see <http://www.gnu.org/licenses/>.
 #include "Table2.hh"
 #include "Wheel.hh"
 #include "ZeroDegree_Setup.hh"
+#include "utrRegions.hh"
 
 // Sensitive Detectors
 #include "EnergyDepositionSD.hh"
@@ -211,6 +212,8 @@ G4VPhysicalVolume *DetectorConstruction::Construct() {
 
   second_Target.Set_Containing_Volume(beampipe.Get_Beampipe_Vacuum());
   second_Target.Construct(G4ThreeVector(0., 0., -beampipe.Get_Z_Axis_Offset_Z() + G3_Target_To_2nd_Target), 20. * deg, 270. * deg);
+  utrRegions::AddVolume("target", second_Target.Get_Target_Logical());
+  utrRegions::AddVolume("target", second_Target.Get_Sphere_Logical());
 #endif
 
   print_info();
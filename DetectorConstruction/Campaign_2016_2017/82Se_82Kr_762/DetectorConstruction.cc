@@ -43,6 +43,7 @@ Materials *materials = Materials::Instance();
 #include "globals.hh"
 
 // Bricks
+#include "BrickEnvelope.hh"
 #include "Bricks.hh"
 
 // Filters
@@ -424,6 +425,8 @@ G4VPhysicalVolume *DetectorConstruction::Construct() {
   /**************** WALL0 Lead wall after collimator
    * *************************/
 
+  BrickEnvelope *wall0 = new BrickEnvelope(world_log, "Wall0");
+
   for (int ny = -2; ny <= 2; ny++) {
     for (int nx = -1; nx <= 1; nx++) {
       for (int nz = 0; nz < 8; nz++) {
@@ -441,6 +444,8 @@ G4VPhysicalVolume *DetectorConstruction::Construct() {
     }
   }
 
+  wall0->Close();
+
   /**************** Paddle (Scintillator
    * Detector)****************************/
 
@@ -462,6 +467,8 @@ G4VPhysicalVolume *DetectorConstruction::Construct() {
   /**************** WALL1 Lead wall after paddle
    * *****************************/
 
+  BrickEnvelope *wall1 = new BrickEnvelope(world_log, "Wall1");
+
   for (int ny = -2; ny <= 2; ny++) {
     for (int nx = -1; nx <= 1; nx++) {
       for (int nz = 0; nz < 8; nz++) {
@@ -479,6 +486,8 @@ G4VPhysicalVolume *DetectorConstruction::Construct() {
     }
   }
 
+  wall1->Close();
+
   /**************** WALL2 Concrete wall between collimator room and UTR
    * ******/
 
@@ -511,6 +520,8 @@ G4VPhysicalVolume *DetectorConstruction::Construct() {
   /**************** WALL3 Lead wall after concrete wall
    * ***********************/
 
+  BrickEnvelope *wall3 = new BrickEnvelope(world_log, "Wall3");
+
   for (int ny = -2; ny <= 2; ny++) {
     for (int nx = -1; nx <= 1; nx++) {
       for (int nz = 0; nz < 4; nz++) {
@@ -528,9 +539,13 @@ G4VPhysicalVolume *DetectorConstruction::Construct() {
     }
   }
 
+  wall3->Close();
+
   /**************** WALL4 Second wall after concrete wall
    * ********************/
 
+  BrickEnvelope *wall4 = new BrickEnvelope(world_log, "Wall4");
+
   for (int ny = -2; ny <= 2; ny++) {
     for (int nz = 0; nz < 4; nz++) {
       for (int nx = 0; nx < 1; nx++) {
@@ -557,8 +572,13 @@ G4VPhysicalVolume *DetectorConstruction::Construct() {
     }
   }
 
+  wall4->Close();
+
   /**************** WALL5 Lead wall in front of g3 setup
    * *********************/
+
+  BrickEnvelope *wall5 = new BrickEnvelope(world_log, "Wall5");
+
   for (int i = 0; i < 3; i++) {
     nb->Put(-nb->L / 2., -BeamTube_Outer_Radius + nb->S * 3.5,
             -Wall5_To_Target - nb->M * (i + 0.5), 0., 90. * deg, 0.);
@@ -645,9 +665,13 @@ G4VPhysicalVolume *DetectorConstruction::Construct() {
   cb->Put(fcb->S * 0.5 + cb->M * 0.5, -BeamTube_Outer_Radius - nb->S * 3. - cb->M - AlPlate_Y - cb->M * 0.5,
           -Wall5_To_Target - nb->M * 3. + cb->L * 0.5);
 
+  wall5->Close();
+
   /**************** WALL6 Lead shielding after g3 setup
    * *************************/
 
+  BrickEnvelope *wall6 = new BrickEnvelope(world_log, "Wall6");
+
   G4double FirstLayer_OffsetY = -8. * mm; // Measured
 
   // First layer in beam direction
@@ -749,6 +773,8 @@ G4VPhysicalVolume *DetectorConstruction::Construct() {
            -BeamTube_Outer_Radius + nb->S * 0.5,
            Wall6_To_Target + nb->M * 2.);
 
+  wall6->Close();
+
   /********************* Table Plate ******************/
 
   G4double TablePlate_Width = 21. * inch; // Measured
@@ -774,6 +800,8 @@ G4VPhysicalVolume *DetectorConstruction::Construct() {
 
   /**************** WALL7 *****************/
 
+  BrickEnvelope *wall7 = new BrickEnvelope(world_log, "Wall7");
+
   G4double Wall7_To_Target = Wheel_To_Target_Position +
                              Wheel_Total_Thickness + TablePlate_Length -
                              75. * mm - 3. * nb->S; // Measured
@@ -989,6 +1017,8 @@ G4VPhysicalVolume *DetectorConstruction::Construct() {
       Wall7_To_Target + WallBelowTable_Distance + nb->M * 3. - cb->M * 0.5,
       0., 90. * deg, 0.);
 
+  wall7->Close();
+
   /******************** Target Holder Tube with cap ***********/
 
   // Tube
@@ -2572,6 +2602,8 @@ G4VPhysicalVolume *DetectorConstruction::Construct() {
 
   print_info(Target2_To_Target, Collimator_To_Target);
 
+  BrickEnvelope::BuildAll();
+
   return world_phys;
 }
 
@@ -31,9 +31,13 @@ class Kr82_Target {
 
   void Construct(G4ThreeVector global_coordinates, G4double theta, G4double phi);
   void Set_Containing_Volume(G4LogicalVolume *World_Log) { World_Logical = World_Log; };
+  G4LogicalVolume *Get_Target_Logical() { return Krypton_Logical; };
+  G4LogicalVolume *Get_Sphere_Logical() { return Sphere_Logical; };
 
   private:
   G4LogicalVolume *World_Logical;
+  G4LogicalVolume *Krypton_Logical;
+  G4LogicalVolume *Sphere_Logical;
 };
 
 #endif
@@ -32,9 +32,9 @@ along with utr.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "Kr82_Target.hh"
 
-Kr82_Target::Kr82_Target() : World_Logical(nullptr) {}
+Kr82_Target::Kr82_Target() : World_Logical(nullptr), Krypton_Logical(nullptr), Sphere_Logical(nullptr) {}
 
-Kr82_Target::Kr82_Target(G4LogicalVolume *World_Log) : World_Logical(World_Log) {}
+Kr82_Target::Kr82_Target(G4LogicalVolume *World_Log) : World_Logical(World_Log), Krypton_Logical(nullptr), Sphere_Logical(nullptr) {}
 
 void Kr82_Target::Construct(G4ThreeVector global_coordinates, G4double theta, G4double phi) {
 
@@ -88,7 +88,7 @@ void Kr82_Target::Construct(G4ThreeVector global_coordinates, G4double theta, G4
       new G4Sphere("Krypton_Solid", 0., GasSphere_Inner_Radius, 0.,
                    360. * deg, 0., 180. * deg);
 
-  G4LogicalVolume *Krypton_Logical = new G4LogicalVolume(
+  Krypton_Logical = new G4LogicalVolume(
       Krypton_Solid, target_Kr, "Krypton_Logical");
 
   Krypton_Logical->SetVisAttributes(G4Colour::Green());
@@ -123,7 +123,7 @@ void Kr82_Target::Construct(G4ThreeVector global_coordinates, G4double theta, G4
       "Sphere_Solid", GasSphere_Inner_Radius, GasSphere_Outer_Radius, 0.,
       360. * deg, 0., 180. * deg);
 
-  G4LogicalVolume *Sphere_Logical = new G4LogicalVolume(
+  Sphere_Logical = new G4LogicalVolume(
       Sphere_Solid, stainlessSteel, "Sphere_Logical");
 
   Sphere_Logical->SetVisAttributes(G4Colour::Grey());
@@ -38,6 +38,7 @@ Actually, the g3 setup is valid until run 489
 #include "globals.hh"
 
 #include "Beampipe_Long.hh"
+#include "BrickEnvelope.hh"
 #include "Collimator_Room.hh"
 #include "Detectors_2nd_Setup_6.hh"
 #include "Detectors_G3_Setup_6.hh"
@@ -216,6 +217,8 @@ G4VPhysicalVolume *DetectorConstruction::Construct() {
   // second_Target.Construct(G4ThreeVector(0., 0., G3_Target_To_2nd_Target - beampipe_Long.Get_Z_Axis_Offset_Z()));
 #endif
 
+  BrickEnvelope::BuildAll();
+
   print_info();
 
   return World_Physical;
@@ -39,6 +39,7 @@ Actually, the g3 setup is valid until run 489
 
 #include "Beampipe_Downstream.hh"
 #include "Beampipe_Upstream.hh"
+#include "BrickEnvelope.hh"
 #include "Collimator_Room.hh"
 #include "Detectors_2nd_271_279.hh"
 #include "Detectors_G3_Setup_10.hh"
@@ -225,6 +226,8 @@ G4VPhysicalVolume *DetectorConstruction::Construct() {
   second_Target.Construct(G4ThreeVector(0., 0., -beampipe_Downstream.Get_Z_Axis_Offset_Z()));
 #endif
 
+  BrickEnvelope::BuildAll();
+
   print_info();
 
   return World_Physical;
@@ -43,6 +43,7 @@ The detector setups for this run are from the "Setup 11" configuration in the EL
 
 #include "Beampipe_Downstream.hh"
 #include "Beampipe_Upstream.hh"
+#include "BrickEnvelope.hh"
 #include "Collimator_Room.hh"
 #include "Detectors_2nd_Setup_11.hh"
 #include "Detectors_G3_Setup_10.hh"
@@ -215,6 +216,8 @@ G4VPhysicalVolume *DetectorConstruction::Construct() {
   second_Target.Construct(G4ThreeVector(0., 0., -beampipe_Downstream.Get_Z_Axis_Offset_Z()));
 #endif
 
+  BrickEnvelope::BuildAll();
+
   print_info();
 
   return World_Physical;
@@ -40,6 +40,7 @@ Both the G3 and the 2nd setup correspond to 'Setup 10' in the ELOG
 
 #include "Beampipe_Downstream.hh"
 #include "Beampipe_Upstream.hh"
+#include "BrickEnvelope.hh"
 #include "Collimator_Room.hh"
 #include "Detectors_2nd_Setup_10.hh"
 #include "Detectors_G3_Setup_10.hh"
@@ -212,6 +213,8 @@ G4VPhysicalVolume *DetectorConstruction::Construct() {
   second_Target.Construct(G4ThreeVector(0., 0., -beampipe_Downstream.Get_Z_Axis_Offset_Z()));
 #endif
 
+  BrickEnvelope::BuildAll();
+
   print_info();
 
   return World_Physical;
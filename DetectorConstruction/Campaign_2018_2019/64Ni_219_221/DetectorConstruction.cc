@@ -38,6 +38,7 @@ Setup for runs 219 - 221
 
 #include "Beampipe_Downstream.hh"
 #include "Beampipe_Upstream.hh"
+#include "BrickEnvelope.hh"
 #include "Collimator_Room.hh"
 #include "Detectors_2nd_146_225.hh"
 #include "Detectors_G3_146_228.hh"
@@ -219,6 +220,8 @@ G4VPhysicalVolume *DetectorConstruction::Construct() {
   second_Target.Construct(G4ThreeVector(0., 0., -beampipe_Downstream.Get_Z_Axis_Offset_Z()));
 #endif
 
+  BrickEnvelope::BuildAll();
+
   print_info();
 
   return World_Physical;
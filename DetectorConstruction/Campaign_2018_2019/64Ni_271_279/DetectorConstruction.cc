@@ -38,6 +38,7 @@ Setup for runs 271 - 279
 
 #include "Beampipe_Downstream.hh"
 #include "Beampipe_Upstream.hh"
+#include "BrickEnvelope.hh"
 #include "Collimator_Room.hh"
 #include "Detectors_2nd_271_279.hh"
 #include "Detectors_G3_271_279.hh"
@@ -45,12 +46,14 @@ Setup for runs 271 - 279
 #include "First_UTR_Wall.hh"
 #include "G3_Table.hh"
 #include "G3_Wall_243_279.hh"
+#include "GeometryDetail.hh"
 #include "Ni64_Sobotka_Target.hh"
 #include "Ni64_Target.hh"
 #include "Room.hh"
 #include "Table2_243_279.hh"
 #include "Wheel.hh"
 #include "ZeroDegree_Setup.hh"
+#include "utrRegions.hh"
 
 // Sensitive Detectors
 #include "EnergyDepositionSD.hh"
@@ -58,7 +61,9 @@ Setup for runs 271 - 279
 #include "ParticleSD.hh"
 #include "SecondarySD.hh"
 
-DetectorConstruction::DetectorConstruction() {}
+DetectorConstruction::DetectorConstruction() {
+  GeometryDetail::SetSetupSwitchesSupported(true);
+}
 
 DetectorConstruction::~DetectorConstruction() {}
 
@@ -171,6 +176,7 @@ G4VPhysicalVolume *DetectorConstruction::Construct() {
   /***************** FIRST_UTR_WALL *****************/
 
   first_UTR_Wall.Construct(G4ThreeVector(0., 0., Wheel_To_Target - First_Setup_To_Wheel - first_Setup.Get_Length() - First_UTR_Wall_To_First_Setup - first_UTR_Wall.Get_Length() * 0.5));
+  utrRegions::AddVolume("shielding", first_UTR_Wall.Get_Lead_Wall_Logical());
 
   /***************** FIRST_SETUP *****************/
 
@@ -179,14 +185,21 @@ G4VPhysicalVolume *DetectorConstruction::Construct() {
   /***************** G3_WALL *****************/
 
   g3_Wall.Construct(G4ThreeVector(0., 0., Wheel_To_Target - First_Setup_To_Wheel + First_Setup_To_G3_Wall + g3_Wall.Get_Length() * 0.5));
+  for (auto logical_volume : g3_Wall.Get_Logical_Volumes()) {
+    utrRegions::AddVolume("shielding", logical_volume);
+  }
 
   /***************** DETECTORS_G3 *****************/
 
-  detectors_G3.Construct(G4ThreeVector(0., 0., 0.));
+  if (GeometryDetail::GetG3Setup()) {
+    detectors_G3.Construct(G4ThreeVector(0., 0., 0.));
+  }
 
   /***************** WHEEL *****************/
 
-  wheel.Construct(G4ThreeVector(0., 0., Wheel_To_Target + wheel.Get_Length() * 0.5));
+  if (GeometryDetail::GetG3Setup()) {
+    wheel.Construct(G4ThreeVector(0., 0., Wheel_To_Target + wheel.Get_Length() * 0.5));
+  }
 
   /***************** G3_TABLE *****************/
 
@@ -194,7 +207,9 @@ G4VPhysicalVolume *DetectorConstruction::Construct() {
 
   /***************** TABLE_2 *****************/
 
-  table2.Construct(G4ThreeVector(0., 0., Wheel_To_Target + wheel.Get_Length() + g3_Table.Get_Length() + table2.Get_Length() * 0.5 + table2.Get_Z_Axis_Offset_Z()));
+  if (GeometryDetail::GetSecondSetup()) {
+    table2.Construct(G4ThreeVector(0., 0., Wheel_To_Target + wheel.Get_Length() + g3_Table.Get_Length() + table2.Get_Length() * 0.5 + table2.Get_Z_Axis_Offset_Z()));
+  }
 
   /***************** BEAMPIPE_DOWNSTREAM *****************/
 
@@ -202,7 +217,9 @@ G4VPhysicalVolume *DetectorConstruction::Construct() {
 
   /***************** DETECTORS_2ND *****************/
 
-  detectors_2nd.Construct(G4ThreeVector(0., 0., G3_Target_To_2nd_Target));
+  if (GeometryDetail::GetSecondSetup()) {
+    detectors_2nd.Construct(G4ThreeVector(0., 0., G3_Target_To_2nd_Target));
+  }
 
   /***************** ZERODEGREE_SETUP *****************/
 
@@ -213,15 +230,23 @@ G4VPhysicalVolume *DetectorConstruction::Construct() {
 #ifdef USE_TARGETS
   /***************** G3_TARGET *****************/
 
-  g3_Target.Set_Containing_Volume(beampipe_Upstream.Get_Beampipe_Vacuum());
-  g3_Target.Construct(G4ThreeVector(0., 0., -beampipe_Upstream.Get_Z_Axis_Offset_Z()));
+  if (GeometryDetail::GetG3Setup()) {
+    g3_Target.Set_Containing_Volume(beampipe_Upstream.Get_Beampipe_Vacuum());
+    g3_Target.Construct(G4ThreeVector(0., 0., -beampipe_Upstream.Get_Z_Axis_Offset_Z()));
+    utrRegions::AddVolume("target", g3_Target.Get_Target_Logical());
+  }
 
   /***************** SECOND_TARGET *****************/
 
-  second_Target.Set_Containing_Volume(beampipe_Downstream.Get_Beampipe_Vacuum());
-  second_Target.Construct(G4ThreeVector(0., 0., -beampipe_Downstream.Get_Z_Axis_Offset_Z()));
+  if (GeometryDetail::GetSecondSetup()) {
+    second_Target.Set_Containing_Volume(beampipe_Downstream.Get_Beampipe_Vacuum());
+    second_Target.Construct(G4ThreeVector(0., 0., -beampipe_Downstream.Get_Z_Axis_Offset_Z()));
+    utrRegions::AddVolume("target", second_Target.Get_Target_Logical());
+  }
 #endif
 
+  BrickEnvelope::BuildAll();
+
   print_info();
 
   return World_Physical;
@@ -240,62 +265,67 @@ void DetectorConstruction::ConstructSDandField() {
 
   /*************** Gamma3 **************/
 
-  EnergyDepositionSD *HPGe1SD = new EnergyDepositionSD("HPGe1", "HPGe1");
-  G4SDManager::GetSDMpointer()->AddNewDetector(HPGe1SD);
-  HPGe1SD->SetDetectorID(1);
-  SetSensitiveDetector("HPGe1", HPGe1SD, true);
-
-  EnergyDepositionSD *HPGe2SD = new EnergyDepositionSD("HPGe2", "HPGe2");
-  G4SDManager::GetSDMpointer()->AddNewDetector(HPGe2SD);
-  HPGe2SD->SetDetectorID(2);
-  SetSensitiveDetector("HPGe2", HPGe2SD, true);
-
-  EnergyDepositionSD *HPGe3SD = new EnergyDepositionSD("HPGe3", "HPGe3");
-  G4SDManager::GetSDMpointer()->AddNewDetector(HPGe3SD);
-  HPGe3SD->SetDetectorID(3);
-  SetSensitiveDetector("HPGe3", HPGe3SD, true);
-
-  EnergyDepositionSD *HPGe4SD = new EnergyDepositionSD("HPGe4", "HPGe4");
-  G4SDManager::GetSDMpointer()->AddNewDetector(HPGe4SD);
-  HPGe4SD->SetDetectorID(4);
-  SetSensitiveDetector("HPGe4", HPGe4SD, true);
-
-  EnergyDepositionSD *LaBr1SD = new EnergyDepositionSD("LaBr1", "LaBr1");
-  G4SDManager::GetSDMpointer()->AddNewDetector(LaBr1SD);
-  LaBr1SD->SetDetectorID(5);
-  SetSensitiveDetector("LaBr1", LaBr1SD, true);
-
-  EnergyDepositionSD *LaBr2SD = new EnergyDepositionSD("LaBr2", "LaBr2");
-  G4SDManager::GetSDMpointer()->AddNewDetector(LaBr2SD);
-  LaBr2SD->SetDetectorID(6);
-  SetSensitiveDetector("LaBr2", LaBr2SD, true);
-
-  EnergyDepositionSD *LaBr3SD = new EnergyDepositionSD("LaBr3", "LaBr3");
-  G4SDManager::GetSDMpointer()->AddNewDetector(LaBr3SD);
-  LaBr3SD->SetDetectorID(7);
-  SetSensitiveDetector("LaBr3", LaBr3SD, true);
-
-  EnergyDepositionSD *LaBr4SD = new EnergyDepositionSD("LaBr4", "LaBr4");
-  G4SDManager::GetSDMpointer()->AddNewDetector(LaBr4SD);
-  LaBr4SD->SetDetectorID(8);
-  SetSensitiveDetector("LaBr4", LaBr4SD, true);
+  // The sensitive detectors can only be attached to logical volumes which exist
+  if (GeometryDetail::GetG3Setup()) {
+    EnergyDepositionSD *HPGe1SD = new EnergyDepositionSD("HPGe1", "HPGe1");
+    G4SDManager::GetSDMpointer()->AddNewDetector(HPGe1SD);
+    HPGe1SD->SetDetectorID(1);
+    SetSensitiveDetector("HPGe1", HPGe1SD, true);
+
+    EnergyDepositionSD *HPGe2SD = new EnergyDepositionSD("HPGe2", "HPGe2");
+    G4SDManager::GetSDMpointer()->AddNewDetector(HPGe2SD);
+    HPGe2SD->SetDetectorID(2);
+    SetSensitiveDetector("HPGe2", HPGe2SD, true);
+
+    EnergyDepositionSD *HPGe3SD = new EnergyDepositionSD("HPGe3", "HPGe3");
+    G4SDManager::GetSDMpointer()->AddNewDetector(HPGe3SD);
+    HPGe3SD->SetDetectorID(3);
+    SetSensitiveDetector("HPGe3", HPGe3SD, true);
+
+    EnergyDepositionSD *HPGe4SD = new EnergyDepositionSD("HPGe4", "HPGe4");
+    G4SDManager::GetSDMpointer()->AddNewDetector(HPGe4SD);
+    HPGe4SD->SetDetectorID(4);
+    SetSensitiveDetector("HPGe4", HPGe4SD, true);
+
+    EnergyDepositionSD *LaBr1SD = new EnergyDepositionSD("LaBr1", "LaBr1");
+    G4SDManager::GetSDMpointer()->AddNewDetector(LaBr1SD);
+    LaBr1SD->SetDetectorID(5);
+    SetSensitiveDetector("LaBr1", LaBr1SD, true);
+
+    EnergyDepositionSD *LaBr2SD = new EnergyDepositionSD("LaBr2", "LaBr2");
+    G4SDManager::GetSDMpointer()->AddNewDetector(LaBr2SD);
+    LaBr2SD->SetDetectorID(6);
+    SetSensitiveDetector("LaBr2", LaBr2SD, true);
+
+    EnergyDepositionSD *LaBr3SD = new EnergyDepositionSD("LaBr3", "LaBr3");
+    G4SDManager::GetSDMpointer()->AddNewDetector(LaBr3SD);
+    LaBr3SD->SetDetectorID(7);
+    SetSensitiveDetector("LaBr3", LaBr3SD, true);
+
+    EnergyDepositionSD *LaBr4SD = new EnergyDepositionSD("LaBr4", "LaBr4");
+    G4SDManager::GetSDMpointer()->AddNewDetector(LaBr4SD);
+    LaBr4SD->SetDetectorID(8);
+    SetSensitiveDetector("LaBr4", LaBr4SD, true);
+  }
 
   /*************** Second setup **************/
 
-  EnergyDepositionSD *HPGe10SD = new EnergyDepositionSD("HPGe10", "HPGe10");
-  G4SDManager::GetSDMpointer()->AddNewDetector(HPGe10SD);
-  HPGe10SD->SetDetectorID(10);
-  SetSensitiveDetector("HPGe10", HPGe10SD, true);
-
-  EnergyDepositionSD *HPGe11SD = new EnergyDepositionSD("HPGe11", "HPGe11");
-  G4SDManager::GetSDMpointer()->AddNewDetector(HPGe11SD);
-  HPGe11SD->SetDetectorID(11);
-  SetSensitiveDetector("HPGe11", HPGe11SD, true);
-
-  EnergyDepositionSD *HPGe12SD = new EnergyDepositionSD("HPGe12", "HPGe12");
-  G4SDManager::GetSDMpointer()->AddNewDetector(HPGe12SD);
-  HPGe12SD->SetDetectorID(12);
-  SetSensitiveDetector("HPGe12", HPGe12SD, true);
+  if (GeometryDetail::GetSecondSetup()) {
+    EnergyDepositionSD *HPGe10SD = new EnergyDepositionSD("HPGe10", "HPGe10");
+    G4SDManager::GetSDMpointer()->AddNewDetector(HPGe10SD);
+    HPGe10SD->SetDetectorID(10);
+    SetSensitiveDetector("HPGe10", HPGe10SD, true);
+
+    EnergyDepositionSD *HPGe11SD = new EnergyDepositionSD("HPGe11", "HPGe11");
+    G4SDManager::GetSDMpointer()->AddNewDetector(HPGe11SD);
+    HPGe11SD->SetDetectorID(11);
+    SetSensitiveDetector("HPGe11", HPGe11SD, true);
+
+    EnergyDepositionSD *HPGe12SD = new EnergyDepositionSD("HPGe12", "HPGe12");
+    G4SDManager::GetSDMpointer()->AddNewDetector(HPGe12SD);
+    HPGe12SD->SetDetectorID(12);
+    SetSensitiveDetector("HPGe12", HPGe12SD, true);
+  }
 
   Max_Sensitive_Detector_ID = 12;
 }
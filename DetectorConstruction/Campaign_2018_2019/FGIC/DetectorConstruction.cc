@@ -37,6 +37,7 @@ along with utr.  If not, see <http://www.gnu.org/licenses/>.
 #include "Room.hh"
 //#include "Beampipe_Upstream.hh"
 #include "Beampipe_Downstream.hh"
+#include "BrickEnvelope.hh"
 #include "First_Setup.hh"
 #include "First_UTR_Wall.hh"
 
@@ -238,6 +239,8 @@ G4VPhysicalVolume *DetectorConstruction::Construct() {
 //	second_Target.Construct(G4ThreeVector(0., 0., -beampipe_Downstream.Get_Z_Axis_Offset_Z()));
 #endif
 
+  BrickEnvelope::BuildAll();
+
   print_info();
 
   return World_Physical;
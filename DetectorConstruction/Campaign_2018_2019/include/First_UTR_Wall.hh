@@ -31,9 +31,11 @@ class First_UTR_Wall {
   void Construct(G4ThreeVector coordinates);
 
   G4double Get_Length() { return First_UTR_Wall_Length; };
+  G4LogicalVolume *Get_Lead_Wall_Logical() { return Lead_Wall_Logical; };
 
   private:
   G4LogicalVolume *World_Logical;
+  G4LogicalVolume *Lead_Wall_Logical;
   G4double First_UTR_Wall_Length;
 };
 
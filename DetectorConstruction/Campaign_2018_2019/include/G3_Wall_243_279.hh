@@ -22,6 +22,10 @@ along with utr.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "G4LogicalVolume.hh"
 
+#include <vector>
+
+using std::vector;
+
 class G3_Wall_243_279 {
   public:
   G3_Wall_243_279(G4LogicalVolume *World_Log);
@@ -31,9 +35,12 @@ class G3_Wall_243_279 {
 
   G4double Get_Floor_Level() { return Floor_Level; };
   G4double Get_Length() { return G3_Wall_Length; };
+  const vector<G4LogicalVolume *> &Get_Logical_Volumes() { return Logical_Volumes; };
 
   private:
   G4LogicalVolume *World_Logical;
+  // All logical volumes of the lead wall, its concrete base and the lead wrap
+  vector<G4LogicalVolume *> Logical_Volumes;
 
   G4double Lead_Wall_Tunnel_Y;
   G4double Lead_Wall_Base_Y;
@@ -31,9 +31,11 @@ class Ni64_Sobotka_Target {
 
   void Construct(G4ThreeVector global_coordinates);
   void Set_Containing_Volume(G4LogicalVolume *World_Log) { World_Logical = World_Log; };
+  G4LogicalVolume *Get_Target_Logical() { return Target_Logical; };
 
   private:
   G4LogicalVolume *World_Logical;
+  G4LogicalVolume *Target_Logical;
 };
 
 #endif
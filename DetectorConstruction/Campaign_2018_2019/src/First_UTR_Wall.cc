@@ -30,6 +30,7 @@ along with utr.  If not, see <http://www.gnu.org/licenses/>.
 #include "Units.hh"
 
 First_UTR_Wall::First_UTR_Wall(G4LogicalVolume *World_Log) : World_Logical(World_Log),
+                                                             Lead_Wall_Logical(nullptr),
                                                              First_UTR_Wall_Length(8. * inch) {}
 
 void First_UTR_Wall::Construct(G4ThreeVector global_coordinates) {
@@ -51,7 +52,7 @@ void First_UTR_Wall::Construct(G4ThreeVector global_coordinates) {
 
   G4SubtractionSolid *Lead_Wall_Solid = new G4SubtractionSolid("Lead_Wall_Solid", Lead_Wall_Solid_Solid, Lead_Wall_Hole_Solid, 0, G4ThreeVector(0., -1. * inch, 0.));
 
-  G4LogicalVolume *Lead_Wall_Logical = new G4LogicalVolume(Lead_Wall_Solid, Pb, "Lead_Wall_Logical");
+  Lead_Wall_Logical = new G4LogicalVolume(Lead_Wall_Solid, Pb, "Lead_Wall_Logical");
   Lead_Wall_Logical->SetVisAttributes(green);
 
   new G4PVPlacement(0, global_coordinates + G4ThreeVector(0., Beam_Pipe_Outer_Radius, 0.), Lead_Wall_Logical, "Lead_Wall", World_Logical, false, 0, false);
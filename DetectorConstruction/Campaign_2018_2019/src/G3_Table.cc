@@ -27,6 +27,7 @@ along with utr.  If not, see <http://www.gnu.org/licenses/>.
 #include "G4Tubs.hh"
 #include "G4VisAttributes.hh"
 
+#include "BrickEnvelope.hh"
 #include "G3_Table.hh"
 #include "Units.hh"
 
@@ -82,6 +83,9 @@ void G3_Table::Construct(G4ThreeVector global_coordinates) {
 
   new G4PVPlacement(0, global_coordinates + G4ThreeVector(0., 0., -Wall_To_Table_Edge + 10. * inch), Lead_Collimator_Logical, "Lead_Collimator", World_Logical, false, 0, false);
 
+  // The bases below the lead wall and the table plate can be homogenized
+  BrickEnvelope *base_envelope = new BrickEnvelope(World_Logical, "G3_Table_Base", true);
+
   G4double Concrete_Base_X = 20. * inch;
   G4double Concrete_Base_Y = 7.25 * inch;
   G4double Concrete_Base_Z = 1.5 * 7.75 * inch;
@@ -112,6 +116,8 @@ void G3_Table::Construct(G4ThreeVector global_coordinates) {
 
   new G4PVPlacement(0, global_coordinates + G4ThreeVector(0., 1. * inch - 0.5 * Lead_Wall_Y - Concrete_Base_Y - Plastic_Base_Y - G3_Table_Plate_Thickness * 0.5, 0.), G3_Table_Plate_Logical, "G3_Table_Plate", World_Logical, false, 0, false);
 
+  base_envelope->Close();
+
   // Upstream beam pipe holder
   G4double Upstream_Holder_X = 2.75 * inch;
   G4double Upstream_Holder_Y = -(1. * inch - Lead_Wall_Y * 0.5 - Concrete_Base_Y - Plastic_Base_Y);
@@ -61,6 +61,7 @@ void G3_Wall_243_279::Construct(G4ThreeVector global_coordinates) {
 
   G4LogicalVolume *Lead_Wall_Tunnel_Logical = new G4LogicalVolume(Lead_Wall_Tunnel_Solid, Pb, "Lead_Wall_Tunnel_Logical");
   Lead_Wall_Tunnel_Logical->SetVisAttributes(green);
+  Logical_Volumes.push_back(Lead_Wall_Tunnel_Logical);
 
   new G4PVPlacement(0, global_coordinates + G4ThreeVector(0., 0., -G3_Wall_Length * 0.5 + 2. * inch + Lead_Wall_Tunnel_Z * 0.5), Lead_Wall_Tunnel_Logical, "Lead_Wall_Tunnel", World_Logical, false, 0, false);
 
@@ -71,6 +72,7 @@ void G3_Wall_243_279::Construct(G4ThreeVector global_coordinates) {
 
   G4LogicalVolume *Lead_Wall_Base_Logical = new G4LogicalVolume(Lead_Wall_Base_Solid, Pb, "Lead_Wall_Base_Logical");
   Lead_Wall_Base_Logical->SetVisAttributes(green);
+  Logical_Volumes.push_back(Lead_Wall_Base_Logical);
 
   new G4PVPlacement(0, global_coordinates + G4ThreeVector(0., -Lead_Wall_Tunnel_Y * 0.5 - Lead_Wall_Base_Y * 0.5, -G3_Wall_Length * 0.5 + Lead_Wall_Base_Z * 0.5), Lead_Wall_Base_Logical, "Lead_Wall_Base", World_Logical, false, 0, false);
 
@@ -82,6 +84,7 @@ void G3_Wall_243_279::Construct(G4ThreeVector global_coordinates) {
 
   G4LogicalVolume *Lead_Wall_Top_Logical = new G4LogicalVolume(Lead_Wall_Top_Solid, Pb, "Lead_Wall_Top_Logical");
   Lead_Wall_Top_Logical->SetVisAttributes(green);
+  Logical_Volumes.push_back(Lead_Wall_Top_Logical);
 
   new G4PVPlacement(0, global_coordinates + G4ThreeVector(0., Lead_Wall_Tunnel_Y * 0.5 + Lead_Wall_Top_Y * 0.5, -G3_Wall_Length * 0.5 + Lead_Wall_Base_Z - Lead_Wall_Top_Z * 0.5), Lead_Wall_Top_Logical, "Lead_Wall_Top", World_Logical, false, 0, false);
 
@@ -93,6 +96,7 @@ void G3_Wall_243_279::Construct(G4ThreeVector global_coordinates) {
 
   G4LogicalVolume *Concrete_Base_Hor_Logical = new G4LogicalVolume(Concrete_Base_Hor_Solid, concrete, "Concrete_Base_Hor_Logical");
   Concrete_Base_Hor_Logical->SetVisAttributes(white);
+  Logical_Volumes.push_back(Concrete_Base_Hor_Logical);
 
   new G4PVPlacement(0, global_coordinates + G4ThreeVector(0., Floor_Level + Concrete_Base_Hor_Y * 0.5, -G3_Wall_Length * 0.5 + Concrete_Base_Hor_Z * 0.5), Concrete_Base_Hor_Logical, "Concrete_Base_Hor", World_Logical, false, 0, false);
 
@@ -103,6 +107,7 @@ void G3_Wall_243_279::Construct(G4ThreeVector global_coordinates) {
 
   G4LogicalVolume *Concrete_Base_Ver_Logical = new G4LogicalVolume(Concrete_Base_Ver_Solid, concrete, "Concrete_Base_Ver_Logical");
   Concrete_Base_Ver_Logical->SetVisAttributes(white);
+  Logical_Volumes.push_back(Concrete_Base_Ver_Logical);
 
   new G4PVPlacement(0, global_coordinates + G4ThreeVector(0., Floor_Level + Concrete_Base_Ver_Y * 0.5, -G3_Wall_Length * 0.5 + Concrete_Base_Hor_Z + Concrete_Base_Ver_Z * 0.5), Concrete_Base_Ver_Logical, "Concrete_Base_Ver", World_Logical, false, 0, false);
 
@@ -111,6 +116,7 @@ void G3_Wall_243_279::Construct(G4ThreeVector global_coordinates) {
 
   G4LogicalVolume *Lead_Wrap_Logical = new G4LogicalVolume(Lead_Wrap_Solid, Pb, "Lead_Wrap_Logical");
   Lead_Wrap_Logical->SetVisAttributes(green);
+  Logical_Volumes.push_back(Lead_Wrap_Logical);
 
   new G4PVPlacement(0, global_coordinates + G4ThreeVector(0., 0., -G3_Wall_Length * 0.5 + Concrete_Base_Hor_Z + 8. * inch), Lead_Wrap_Logical, "Lead_Wrap", World_Logical, false, 0, false);
 }
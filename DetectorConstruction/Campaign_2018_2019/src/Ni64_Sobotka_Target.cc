@@ -30,9 +30,9 @@ along with utr.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "Ni64_Sobotka_Target.hh"
 
-Ni64_Sobotka_Target::Ni64_Sobotka_Target() : World_Logical(nullptr) {}
+Ni64_Sobotka_Target::Ni64_Sobotka_Target() : World_Logical(nullptr), Target_Logical(nullptr) {}
 
-Ni64_Sobotka_Target::Ni64_Sobotka_Target(G4LogicalVolume *World_Log) : World_Logical(World_Log) {}
+Ni64_Sobotka_Target::Ni64_Sobotka_Target(G4LogicalVolume *World_Log) : World_Logical(World_Log), Target_Logical(nullptr) {}
 
 void Ni64_Sobotka_Target::Construct(G4ThreeVector global_coordinates) {
 
@@ -65,7 +65,7 @@ void Ni64_Sobotka_Target::Construct(G4ThreeVector global_coordinates) {
 
   G4Tubs *Target_Solid = new G4Tubs("Ni64_Sobotka_Solid", 0., Target_Radius, Target_Length * 0.5, 0., twopi);
 
-  G4LogicalVolume *Target_Logical = new G4LogicalVolume(Target_Solid, Target_Material, "Ni64_Sobotka_Logical");
+  Target_Logical = new G4LogicalVolume(Target_Solid, Target_Material, "Ni64_Sobotka_Logical");
   Target_Logical->SetVisAttributes(yellow);
 
   new G4PVPlacement(0, global_coordinates + G4ThreeVector(), Target_Logical, "Ni64_Sobotka_Target", World_Logical, false, 0);
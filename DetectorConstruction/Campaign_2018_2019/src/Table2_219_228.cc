@@ -29,6 +29,7 @@ along with utr.  If not, see <http://www.gnu.org/licenses/>.
 #include "G4TwoVector.hh"
 #include "G4VisAttributes.hh"
 
+#include "BrickEnvelope.hh"
 #include "Table2_219_228.hh"
 #include "Units.hh"
 
@@ -285,12 +286,17 @@ void Table2_219_228::Construct(G4ThreeVector global_coordinates) {
   new G4PVPlacement(0, global_coordinates + G4ThreeVector(0., -Upstream_Holder_Ring_Outer_Radius + Upstream_Holder_Hole_Depth - Upstream_Holder_Base_Y - Holder_Base_To_Table + 18. * inch, -3.75 * inch - Brass_Column_Base - Al_Bar_Thickness * 0.5), Al_Bar_Logical, "Al_Bar_1", World_Logical, false, 0, false); // Estimated vertical position
 
   // Construct holding structure below table
+  // The table plates are kept, because the vertical detectors reach into their hole, but the
+  // structure below them can be homogenized
+  BrickEnvelope *below_table_envelope = new BrickEnvelope(World_Logical, "Table2_Below_Table", true);
 
   new G4PVPlacement(0, global_coordinates + G4ThreeVector(Table_Plate_Hole_Radius + 2.5 * inch + Brass_Column_Base * 0.5, -Upstream_Holder_Ring_Outer_Radius + Upstream_Holder_Hole_Depth - Upstream_Holder_Base_Y - Holder_Base_To_Table - Table_Plate_Thickness - Brass_Column_Height * 0.5, -3.75 * inch - Brass_Column_Base * 0.5), Brass_Column_Logical, "Brass_Column_1", World_Logical, false, 0, false);
   new G4PVPlacement(0, global_coordinates + G4ThreeVector(-Table_Plate_Hole_Radius - 2.5 * inch - Brass_Column_Base * 0.5, -Upstream_Holder_Ring_Outer_Radius + Upstream_Holder_Hole_Depth - Upstream_Holder_Base_Y - Holder_Base_To_Table - Table_Plate_Thickness - Brass_Column_Height * 0.5, -3.75 * inch - Brass_Column_Base * 0.5), Brass_Column_Logical, "Brass_Column_2", World_Logical, false, 0, false); // Estimated length. Actually measured only the length of the holding structure on top
 
   new G4PVPlacement(0, global_coordinates + G4ThreeVector(0., -Upstream_Holder_Ring_Outer_Radius + Upstream_Holder_Hole_Depth - Upstream_Holder_Base_Y - Holder_Base_To_Table - Table_Plate_Thickness - 18. * inch, -3.75 * inch - Brass_Column_Base - Al_Bar_Thickness * 0.5), Al_Bar_Logical, "Al_Bar_2", World_Logical, false, 0, false); // Estimated vertical position
 
+  below_table_envelope->Close();
+
   // Lead shielding after first beam pipe holder
 
   G4Box *Lead_On_Table_1_Solid_Solid = new G4Box("Lead_On_Table_1_Solid_Solid", 12. * inch * 0.5, 8. * inch * 0.5, 2. * inch * 0.5);
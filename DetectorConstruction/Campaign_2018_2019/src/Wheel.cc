@@ -17,6 +17,7 @@ GNU General Public License for more details.
 You should have received a copy of the GNU General Public License
 along with utr.  If not, see <http://www.gnu.org/licenses/>.
 */
+#include <algorithm>
 #include <sstream>
 
 #include "G4NistManager.hh"
@@ -25,6 +26,7 @@ along with utr.  If not, see <http://www.gnu.org/licenses/>.
 #include "G4Tubs.hh"
 #include "G4VisAttributes.hh"
 
+#include "BrickEnvelope.hh"
 #include "Units.hh"
 #include "Wheel.hh"
 
@@ -59,6 +61,9 @@ void Wheel::Construct(G4ThreeVector global_coordinates) {
 
   G4double pos_z = -Wheel_Thickness * 0.5;
 
+  // The rings have no sensitive parts and are far from the beam, so they can be homogenized
+  BrickEnvelope *wheel_envelope = new BrickEnvelope(World_Logical, "Wheel", true);
+
   for (unsigned int i = 0; i < Ring_Radius.size(); ++i) {
     solidName << "Wheel_Ring_" << i << "_Solid";
     Wheel_Ring_Solid = new G4Tubs(solidName.str(), Hole_Radius, Ring_Radius[i], Ring_Thickness[i] * 0.5, 0., twopi);
@@ -76,4 +81,7 @@ void Wheel::Construct(G4ThreeVector global_coordinates) {
     logicalName.str("");
     physicalName.str("");
   }
+
+  wheel_envelope->SetSolid(new G4Tubs("Wheel_Envelope_Solid", Hole_Radius, *std::max_element(Ring_Radius.begin(), Ring_Radius.end()), Wheel_Thickness * 0.5, 0., twopi), global_coordinates);
+  wheel_envelope->Close();
 }
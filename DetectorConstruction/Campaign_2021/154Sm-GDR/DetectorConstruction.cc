@@ -42,6 +42,7 @@ along with utr.  If not, see <http://www.gnu.org/licenses/>.
 
 // Detectors
 #include "CeBr3_2x2.hh"
+#include "DetectorModelCache.hh"
 #include "HPGe_Clover.hh"
 #include "HPGe_Coaxial.hh"
 #include "HPGe_Collection.hh"
@@ -446,6 +447,7 @@ G4VPhysicalVolume *DetectorConstruction::Construct() {
     clovers.push_back(HPGe_Clover(worldLogical, det_pos.id));
     clovers[clovers.size() - 1].setProperties(hpge_Collection.HPGe_Clover_Yale);
     clovers[clovers.size() - 1].useDewar();
+    clovers[clovers.size() - 1].useModelCache();
     clovers[clovers.size() - 1].Add_Filter("G4_Cu", det_pos.filterThicknessCu, -1.);
     clovers[clovers.size() - 1].Add_Filter("G4_Pb", det_pos.filterThicknessPb, -1.);
     clovers[clovers.size() - 1].Construct(det_pos.targetPosOffset, det_pos.theta, det_pos.phi, det_pos.distance, det_pos.intrinsicRotationAngle);
@@ -455,6 +457,7 @@ G4VPhysicalVolume *DetectorConstruction::Construct() {
   for (auto det_pos : labr_positions) {
     labrs.push_back(LaBr_3x3(worldLogical, det_pos.id));
     labrs[labrs.size() - 1].useHousing();
+    labrs[labrs.size() - 1].useModelCache();
     labrs[labrs.size() - 1].Add_Filter("G4_Cu", det_pos.filterThicknessCu, -1.);
     labrs[labrs.size() - 1].Add_Filter("G4_Pb", det_pos.filterThicknessPb, -1.);
     labrs[labrs.size() - 1].Construct(det_pos.targetPosOffset, det_pos.theta, det_pos.phi, det_pos.distance);
@@ -463,11 +466,14 @@ G4VPhysicalVolume *DetectorConstruction::Construct() {
   vector<CeBr3_2x2> cebrs;
   for (auto det_pos : cebr_positions) {
     cebrs.push_back(CeBr3_2x2(worldLogical, det_pos.id));
+    cebrs[cebrs.size() - 1].useModelCache();
     cebrs[cebrs.size() - 1].Add_Filter("G4_Cu", det_pos.filterThicknessCu, -1.);
     cebrs[cebrs.size() - 1].Add_Filter("G4_Pb", det_pos.filterThicknessPb, -1.);
     cebrs[cebrs.size() - 1].Construct(det_pos.targetPosOffset, det_pos.theta, det_pos.phi, det_pos.distance);
   }
 
+  DetectorModelCache::PrintSummary();
+
 #ifdef USE_ZERODEGREE
   HPGe_Coaxial zerodegree(worldLogical, "ZeroDegree");
   zerodegree.setProperties(hpge_Collection.HPGe_120_TUNL_40383);
@@ -645,7 +651,7 @@ void DetectorConstruction::ConstructSDandField() {
     EnergyDepositionSD *sensitiveDet = new EnergyDepositionSD(detName, detName);
     G4SDManager::GetSDMpointer()->AddNewDetector(sensitiveDet);
     sensitiveDet->SetDetectorID(detIDNo);
-    SetSensitiveDetector(detName, sensitiveDet, true);
+    DetectorModelCache::SetSensitiveDetector(detName, sensitiveDet);
   }
   for (auto det_pos : cebr_positions) {
     detIDNo++;
@@ -653,7 +659,7 @@ void DetectorConstruction::ConstructSDandField() {
     EnergyDepositionSD *sensitiveDet = new EnergyDepositionSD(detName, detName);
     G4SDManager::GetSDMpointer()->AddNewDetector(sensitiveDet);
     sensitiveDet->SetDetectorID(detIDNo);
-    SetSensitiveDetector(detName, sensitiveDet, true);
+    DetectorModelCache::SetSensitiveDetector(detName, sensitiveDet);
   }
   for (auto det_pos : clover_positions) {
     for (int subCrystalNo = 1; subCrystalNo < 5; subCrystalNo++) {
@@ -662,7 +668,7 @@ void DetectorConstruction::ConstructSDandField() {
       EnergyDepositionSD *sensitiveDet = new EnergyDepositionSD(detName, detName);
       G4SDManager::GetSDMpointer()->AddNewDetector(sensitiveDet);
       sensitiveDet->SetDetectorID(detIDNo);
-      SetSensitiveDetector(detName, sensitiveDet, true);
+      DetectorModelCache::SetSensitiveDetector(detName, sensitiveDet);
     }
   }
   Max_Sensitive_Detector_ID = detIDNo; // Necessary for EVENT_EVENTWISE output mode
@@ -0,0 +1,162 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Header-only reader for the binary columnar output of utr (/utr/output/format columnar).
+// The file format is described in include/ColumnarWriter.hh.
+//
+// Example:
+//
+//   ColumnarReader reader("utr0_t0.utrc");
+//   const size_t edep = reader.GetColumnIndex("edep");
+//   while (reader.ReadChunk()) {
+//     for (size_t row = 0; row < reader.GetNRows(); ++row) {
+//       double e = reader.GetValue(edep, row);
+//       ...
+//     }
+//   }
+//
+// GetColumn<T>() gives direct access to the values of a column in the current chunk, if T is
+// the type of the column.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+class ColumnarReader {
+  public:
+  enum ColumnType : uint8_t {
+    INT32 = 0,
+    INT64 = 1,
+    FLOAT32 = 2,
+    FLOAT64 = 3
+  };
+  static size_t GetTypeSize(ColumnType type) { return (type == INT64 || type == FLOAT64) ? 8 : 4; }
+
+  explicit ColumnarReader(const std::string &filename) : file(filename, std::ios::binary), n_rows(0) {
+    if (!file) {
+      throw std::runtime_error("Could not open '" + filename + "'");
+    }
+
+    char magic[8];
+    read(magic, sizeof(magic));
+    if (memcmp(magic, "UTRCOL01", sizeof(magic)) != 0) {
+      throw std::runtime_error("'" + filename + "' is not a columnar utr output file");
+    }
+
+    uint32_t n_columns = 0;
+    read(&n_columns, sizeof(n_columns));
+    for (uint32_t i = 0; i < n_columns; ++i) {
+      uint8_t type = 0;
+      uint8_t name_length = 0;
+      read(&type, sizeof(type));
+      read(&name_length, sizeof(name_length));
+      if (type > FLOAT64) {
+        throw std::runtime_error("Unknown column type in '" + filename + "'");
+      }
+      std::string name(name_length, '\0');
+      read(&name[0], name_length);
+      columns.push_back(Column{name, ColumnType(type), std::vector<char>()});
+    }
+  }
+
+  size_t GetNColumns() const { return columns.size(); }
+  const std::string &GetColumnName(size_t column) const { return columns.at(column).name; }
+  ColumnType GetColumnType(size_t column) const { return columns.at(column).type; }
+  // Returns GetNColumns() if there is no column with this name
+  size_t GetColumnIndex(const std::string &name) const {
+    size_t column = 0;
+    while (column < columns.size() && columns[column].name != name) {
+      ++column;
+    }
+    return column;
+  }
+
+  // Read the next chunk of rows. Returns false at the end of the file.
+  bool ReadChunk() {
+    uint32_t n = 0;
+    if (!file.read(reinterpret_cast<char *>(&n), sizeof(n))) {
+      n_rows = 0;
+      return false;
+    }
+    n_rows = n;
+    for (auto &c : columns) {
+      c.data.resize(n_rows * GetTypeSize(c.type));
+      read(c.data.data(), c.data.size());
+    }
+    return true;
+  }
+  // Number of rows in the current chunk
+  size_t GetNRows() const { return n_rows; }
+
+  template <typename T>
+  const T *GetColumn(size_t column) const {
+    const Column &c = columns.at(column);
+    if (sizeof(T) != GetTypeSize(c.type) || std::is_integral<T>::value != (c.type == INT32 || c.type == INT64)) {
+      throw std::runtime_error("Column '" + c.name + "' has a different type");
+    }
+    return reinterpret_cast<const T *>(c.data.data());
+  }
+
+  // Value of a column in a row of the current chunk, converted to double
+  double GetValue(size_t column, size_t row) const {
+    const Column &c = columns[column];
+    switch (c.type) {
+      case INT32:
+        return get<int32_t>(c, row);
+      case INT64:
+        return double(get<int64_t>(c, row));
+      case FLOAT32:
+        return get<float>(c, row);
+      case FLOAT64:
+        return get<double>(c, row);
+    }
+    return 0.;
+  }
+
+  private:
+  struct Column {
+    std::string name;
+    ColumnType type;
+    std::vector<char> data;
+  };
+
+  template <typename T>
+  static T get(const Column &c, size_t row) {
+    T value;
+    memcpy(&value, c.data.data() + row * sizeof(T), sizeof(T));
+    return value;
+  }
+
+  void read(void *destination, size_t size) {
+    if (!file.read(static_cast<char *>(destination), static_cast<std::streamsize>(size))) {
+      throw std::runtime_error("Unexpected end of a columnar utr output file");
+    }
+  }
+
+  std::ifstream file;
+  std::vector<Column> columns;
+  size_t n_rows;
+};
@@ -0,0 +1,146 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// ColumnarToRoot converts one or more columnar utr output files (/utr/output/format columnar) to a
+// ROOT file with a TTree, whose branches have the same names as the columns. All values are stored
+// as doubles, like in the root output format of utr, so that the result can be processed with the
+// other tools in OutputProcessing. Several input files (e.g. the files of all threads of a run)
+// with the same columns are concatenated.
+
+#include <argp.h>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <TFile.h>
+#include <TTree.h>
+
+#include "ColumnarReader.hh"
+
+using std::cerr;
+using std::cout;
+using std::endl;
+using std::string;
+using std::vector;
+
+static char doc[] = "Convert columnar utr output files to a ROOT file with a TTree";
+static char args_doc[] = "INPUTFILE [INPUTFILE...]";
+
+static struct argp_option options[] = {
+    {"tree", 't', "TREENAME", 0, "Name of the tree in the output file (default: utr, use 'edep' for output of the EVENT_EVENTWISE mode)"},
+    {"filename", 'o', "OUTPUTFILENAME", 0, "Output file name, file will be overwritten! (default: first INPUTFILE with the extension .root)"},
+    {0, 0, 0, 0, 0}};
+
+struct arguments {
+  string tree = "utr";
+  string outputFilename = "";
+  vector<string> inputFilenames;
+};
+
+static error_t parse_opt(int key, char *arg, struct argp_state *state) {
+  struct arguments *arguments = (struct arguments *)state->input;
+
+  switch (key) {
+    case 't':
+      arguments->tree = arg;
+      break;
+    case 'o':
+      arguments->outputFilename = arg;
+      break;
+    case ARGP_KEY_ARG:
+      arguments->inputFilenames.push_back(arg);
+      break;
+    case ARGP_KEY_END:
+      if (arguments->inputFilenames.empty()) {
+        argp_usage(state);
+      }
+      break;
+    default:
+      return ARGP_ERR_UNKNOWN;
+  }
+  return 0;
+}
+
+static struct argp argp = {options, parse_opt, args_doc, doc, 0, 0, 0};
+
+int main(int argc, char *argv[]) {
+  struct arguments arguments;
+  argp_parse(&argp, argc, argv, 0, 0, &arguments);
+
+  if (arguments.outputFilename == "") {
+    arguments.outputFilename = arguments.inputFilenames[0];
+    const size_t extension = arguments.outputFilename.rfind(".utrc");
+    if (extension != string::npos) {
+      arguments.outputFilename.erase(extension);
+    }
+    arguments.outputFilename += ".root";
+  }
+
+  TFile outputFile(arguments.outputFilename.c_str(), "RECREATE");
+  TTree tree(arguments.tree.c_str(), arguments.tree.c_str());
+  vector<string> names;
+  vector<Double_t> values;
+  Long64_t nEntries = 0;
+
+  try {
+    for (auto inputFilename : arguments.inputFilenames) {
+      ColumnarReader reader(inputFilename);
+
+      // The branches are created from the columns of the first file, all other files need to have the same columns
+      if (names.empty()) {
+        values.resize(reader.GetNColumns());
+        for (size_t column = 0; column < reader.GetNColumns(); ++column) {
+          names.push_back(reader.GetColumnName(column));
+          tree.Branch(names[column].c_str(), &values[column]);
+        }
+      } else {
+        bool sameColumns = reader.GetNColumns() == names.size();
+        for (size_t column = 0; sameColumns && column < names.size(); ++column) {
+          sameColumns = reader.GetColumnName(column) == names[column];
+        }
+        if (!sameColumns) {
+          cerr << "> Error: '" << inputFilename << "' has different columns than '" << arguments.inputFilenames[0] << "'" << endl;
+          return 1;
+        }
+      }
+
+      while (reader.ReadChunk()) {
+        for (size_t row = 0; row < reader.GetNRows(); ++row) {
+          for (size_t column = 0; column < values.size(); ++column) {
+            values[column] = reader.GetValue(column, row);
+          }
+          tree.Fill();
+        }
+      }
+      cout << "> Converted '" << inputFilename << "' (" << tree.GetEntries() - nEntries << " entries)" << endl;
+      nEntries = tree.GetEntries();
+    }
+  } catch (std::runtime_error &e) {
+    cerr << "> Error: " << e.what() << endl;
+    return 1;
+  }
+
+  outputFile.Write();
+  outputFile.Close();
+  cout << "> Wrote " << nEntries << " entries to '" << arguments.outputFilename << "'" << endl;
+
+  return 0;
+}
@@ -0,0 +1,212 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <argp.h>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <stdlib.h>
+#include <string>
+
+#include <TFile.h>
+#include <TH1.h>
+#include <TKey.h>
+
+using std::cerr;
+using std::cout;
+using std::endl;
+using std::setw;
+using std::string;
+
+// Program documentation.
+static char doc[] = "Compare the histograms with the same names in two ROOT files, for example the output of getHistogram or of the histogram output format of utr for two physics lists or two levels of detail of the geometry.\vIf a tolerance or a maximum chi^2/NDF is given, each histogram is marked as 'ok' or 'CHANGED', and the exit status is 2 if any histogram changed.";
+// Description of the accepted/required arguments
+static char args_doc[] = "REFERENCE_FILE FILE";
+
+// The options argp understands
+static struct argp_option options[] = {
+    {"emin", 'l', "EMIN", 0, "Lower limit of the compared energy range (default: 0)"},
+    {"emax", 'u', "EMAX", 0, "Upper limit of the compared energy range (default: upper limit of the histograms)"},
+    {"rebin", 'r', "NBINS", 0, "Combine NBINS bins before the chi^2 test (default: 1)"},
+    {"tolerance", 't', "TOL", 0, "Mark a histogram as changed if the relative difference of the counts exceeds TOL by more than two standard deviations (default: no test)"},
+    {"chi2", 'c', "MAXCHI2", 0, "Mark a histogram as changed if chi^2/NDF exceeds MAXCHI2 (default: no test)"},
+    {0}};
+
+// Used by main to communicate with parse_opt
+struct arguments {
+  char *args[2]; // Non-option Arguments
+  double emin = 0.;
+  double emax = -1.;
+  int rebin = 1;
+  double tolerance = -1.;
+  double maxChi2 = -1.;
+};
+
+// Function to parse a single option
+static error_t parse_opt(int key, char *arg, struct argp_state *state) {
+  // Get the input argument from argp_parse, which is a pointer to the arguments structure
+  struct arguments *arguments = (struct arguments *)state->input;
+
+  switch (key) {
+    case 'l':
+      arguments->emin = atof(arg);
+      break;
+    case 'u':
+      arguments->emax = atof(arg);
+      break;
+    case 'r':
+      arguments->rebin = atoi(arg);
+      break;
+    case 't':
+      arguments->tolerance = atof(arg);
+      break;
+    case 'c':
+      arguments->maxChi2 = atof(arg);
+      break;
+
+    case ARGP_KEY_ARG:
+      if (state->arg_num >= 2) {
+        // Too many arguments
+        cerr << "Error: compareSpectra takes exactly two arguments!" << endl;
+        argp_usage(state);
+      }
+      arguments->args[state->arg_num] = arg;
+      break;
+
+    case ARGP_KEY_END:
+      if (state->arg_num < 2) {
+        // Not enough arguments
+        cerr << "Error: compareSpectra takes exactly two arguments!" << endl;
+        argp_usage(state);
+      }
+      break;
+
+    default:
+      return ARGP_ERR_UNKNOWN;
+  }
+  return 0;
+}
+
+static struct argp argp = {options, parse_opt, args_doc, doc};
+
+int main(int argc, char *argv[]) {
+
+  struct arguments arguments;
+  // Parse arguments
+  argp_parse(&argp, argc, argv, 0, 0, &arguments);
+  if (arguments.rebin < 1) {
+    cerr << "Error: The number of bins to combine has to be at least 1." << endl;
+    return 1;
+  }
+
+  TFile *referenceFile = new TFile(arguments.args[0]);
+  TFile *file = new TFile(arguments.args[1]);
+  if (referenceFile->IsZombie() || file->IsZombie()) {
+    cerr << "Error: Could not open the input files." << endl;
+    return 1;
+  }
+
+  // The ratio of the counts is given with its statistical uncertainty. Since both simulations
+  // are independent, the spectra are compatible if chi^2/NDF is close to 1.
+  const bool test = arguments.tolerance >= 0. || arguments.maxChi2 >= 0.;
+  cout << setw(12) << "Histogram" << setw(16) << "Reference" << setw(16) << "Counts" << setw(24) << "Ratio" << setw(16) << "chi^2/NDF";
+  if (test) {
+    cout << setw(10) << "Verdict";
+  }
+  cout << endl;
+
+  int nCompared = 0;
+  int nChanged = 0;
+  TIter nextKey(referenceFile->GetListOfKeys());
+  TKey *key;
+  while ((key = (TKey *)nextKey())) {
+    TH1 *referenceHistogram = dynamic_cast<TH1 *>(key->ReadObj());
+    if (referenceHistogram == nullptr) {
+      continue;
+    }
+    TH1 *histogram = dynamic_cast<TH1 *>(file->Get(key->GetName()));
+    if (histogram == nullptr) {
+      cout << setw(12) << key->GetName() << "  not found in " << arguments.args[1] << endl;
+      continue;
+    }
+    if (histogram->GetNbinsX() != referenceHistogram->GetNbinsX()) {
+      cout << setw(12) << key->GetName() << "  different binning, skipped" << endl;
+      continue;
+    }
+    if (arguments.rebin > 1) {
+      referenceHistogram->Rebin(arguments.rebin);
+      histogram->Rebin(arguments.rebin);
+    }
+
+    const Int_t firstBin = referenceHistogram->FindBin(arguments.emin);
+    const Int_t lastBin = arguments.emax > arguments.emin ? referenceHistogram->FindBin(arguments.emax) : referenceHistogram->GetNbinsX();
+    referenceHistogram->GetXaxis()->SetRange(firstBin, lastBin);
+    histogram->GetXaxis()->SetRange(firstBin, lastBin);
+
+    const double referenceCounts = referenceHistogram->Integral(firstBin, lastBin);
+    const double counts = histogram->Integral(firstBin, lastBin);
+    const bool referenceEmpty = !(referenceCounts > 0.);
+    const bool empty = !(counts > 0.);
+    if (referenceEmpty && empty) {
+      // Nothing to compare, e.g. a detector which is not hit at all
+      cout << setw(12) << key->GetName() << "  empty in both files, skipped" << endl;
+      continue;
+    }
+    ++nCompared;
+
+    bool changed = false;
+    cout << setw(12) << key->GetName() << setw(16) << referenceCounts << setw(16) << counts;
+    if (!referenceEmpty && !empty) {
+      const double ratio = counts / referenceCounts;
+      const double ratioUncertainty = ratio * sqrt(1. / counts + 1. / referenceCounts);
+      const double chi2 = referenceHistogram->Chi2Test(histogram, "UU CHI2/NDF");
+      changed = (arguments.tolerance >= 0. && fabs(ratio - 1.) - 2. * ratioUncertainty > arguments.tolerance) ||
+                (arguments.maxChi2 >= 0. && chi2 > arguments.maxChi2);
+      cout << std::fixed << std::setprecision(4) << setw(10) << ratio << " +- " << setw(10) << ratioUncertainty
+           << setw(16) << std::setprecision(3) << chi2 << std::defaultfloat << std::setprecision(6);
+    } else {
+      // Exactly one of the spectra is empty in the compared range
+      changed = true;
+      cout << setw(24) << "-" << setw(16) << "-";
+    }
+    if (test) {
+      cout << setw(10) << (changed ? "CHANGED" : "ok");
+      if (changed) {
+        ++nChanged;
+      }
+    }
+    cout << endl;
+  }
+
+  if (nCompared == 0) {
+    cerr << "Error: No common non-empty histograms found." << endl;
+    return 1;
+  }
+
+  if (test) {
+    cout << endl
+         << nChanged << " of " << nCompared << " histograms changed." << endl;
+    if (nChanged > 0) {
+      return 2;
+    }
+  }
+
+  return 0;
+}
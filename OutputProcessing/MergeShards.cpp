@@ -0,0 +1,272 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// MergeShards combines the output of a sharded utr simulation (utr --shard I/N --seed S). It reads
+// the manifests '<NAME>_shard<I>of<N>.manifest' of all shards, verifies that every shard from 0
+// to N-1 is present exactly once, that all shards used the same seed, number of events and output
+// format, and that all listed output files exist. The ROOT n-tuples or histograms of all shards
+// are then combined in a single file, like hadd would do.
+
+#include <argp.h>
+#include <dirent.h>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <sys/stat.h>
+#include <vector>
+
+#include <TFileMerger.h>
+
+using std::cerr;
+using std::cout;
+using std::endl;
+using std::string;
+using std::vector;
+
+static char doc[] = "Verify that all shards of a sharded utr simulation are present and merge their output files";
+static char args_doc[] = "NAME";
+
+static struct argp_option options[] = {
+    {"directory", 'd', "DIRECTORY", 0, "Directory which contains the manifests and the output files of the shards (default: '.')"},
+    {"output", 'o', "OUTPUTFILENAME", 0, "Output file name, file will be overwritten! (default: DIRECTORY/NAME_merged.root)"},
+    {"check", 'c', 0, 0, "Only verify the shards, do not merge the output files"},
+    {0, 0, 0, 0, 0}};
+
+struct arguments {
+  string name = "";
+  string directory = ".";
+  string outputFilename = "";
+  bool checkOnly = false;
+};
+
+static error_t parse_opt(int key, char *arg, struct argp_state *state) {
+  struct arguments *arguments = (struct arguments *)state->input;
+
+  switch (key) {
+    case 'd':
+      arguments->directory = arg;
+      break;
+    case 'o':
+      arguments->outputFilename = arg;
+      break;
+    case 'c':
+      arguments->checkOnly = true;
+      break;
+    case ARGP_KEY_ARG:
+      if (state->arg_num >= 1) {
+        cerr << "Error: mergeShards takes exactly one argument!" << endl;
+        argp_usage(state);
+      }
+      arguments->name = arg;
+      break;
+    case ARGP_KEY_END:
+      if (state->arg_num < 1) {
+        cerr << "Error: mergeShards takes exactly one argument!" << endl;
+        argp_usage(state);
+      }
+      break;
+    default:
+      return ARGP_ERR_UNKNOWN;
+  }
+  return 0;
+}
+
+static struct argp argp = {options, parse_opt, args_doc, doc, 0, 0, 0};
+
+struct Manifest {
+  string filename;
+  unsigned long shard = 0;
+  unsigned long shards = 0;
+  string seed;
+  unsigned long events = 0;
+  unsigned long requested = 0;
+  string format;
+  vector<string> files;
+};
+
+// Parse the 'key value' lines of a manifest written by utrRandom::WriteManifest()
+static bool read_manifest(const string &filename, Manifest &manifest) {
+  std::ifstream file(filename);
+  if (!file.is_open()) {
+    return false;
+  }
+  manifest.filename = filename;
+  bool has_shard = false, has_shards = false;
+  string line;
+  while (std::getline(file, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    std::istringstream line_stream(line);
+    string key, value;
+    line_stream >> key >> value;
+    if (key == "shard") {
+      manifest.shard = std::stoul(value);
+      has_shard = true;
+    } else if (key == "shards") {
+      manifest.shards = std::stoul(value);
+      has_shards = true;
+    } else if (key == "seed") {
+      manifest.seed = value;
+    } else if (key == "events") {
+      manifest.events = std::stoul(value);
+    } else if (key == "requested") {
+      manifest.requested = std::stoul(value);
+    } else if (key == "format") {
+      manifest.format = value;
+    } else if (key == "file") {
+      manifest.files.push_back(value);
+    }
+  }
+  return has_shard && has_shards && manifest.shards > 0;
+}
+
+static bool file_exists(const string &filename) {
+  struct stat buffer;
+  return stat(filename.c_str(), &buffer) == 0;
+}
+
+int main(int argc, char *argv[]) {
+  struct arguments arguments;
+  argp_parse(&argp, argc, argv, 0, 0, &arguments);
+
+  // Find the manifests of all shards
+  const string manifestPrefix = arguments.name + "_shard";
+  const string manifestSuffix = ".manifest";
+  vector<Manifest> manifests;
+  DIR *directory = opendir(arguments.directory.c_str());
+  if (directory == nullptr) {
+    cerr << "Error: Could not open the directory '" << arguments.directory << "'." << endl;
+    return 1;
+  }
+  for (struct dirent *entry = readdir(directory); entry != nullptr; entry = readdir(directory)) {
+    const string entryName = entry->d_name;
+    if (entryName.size() > manifestPrefix.size() + manifestSuffix.size() && entryName.compare(0, manifestPrefix.size(), manifestPrefix) == 0 && entryName.compare(entryName.size() - manifestSuffix.size(), manifestSuffix.size(), manifestSuffix) == 0) {
+      Manifest manifest;
+      if (!read_manifest(arguments.directory + "/" + entryName, manifest)) {
+        cerr << "Error: Could not read the manifest '" << entryName << "'." << endl;
+        closedir(directory);
+        return 1;
+      }
+      manifests.push_back(manifest);
+    }
+  }
+  closedir(directory);
+
+  if (manifests.empty()) {
+    cerr << "Error: No manifests '" << manifestPrefix << "*" << manifestSuffix << "' found in '" << arguments.directory << "'." << endl;
+    return 1;
+  }
+
+  // All shards have to belong to the same simulation
+  const Manifest &first = manifests[0];
+  bool consistent = true;
+  for (auto &manifest : manifests) {
+    if (manifest.shards != first.shards || manifest.seed != first.seed || manifest.requested != first.requested || manifest.format != first.format) {
+      cerr << "Error: The shard in '" << manifest.filename << "' (" << manifest.shards << " shards, seed " << manifest.seed << ", " << manifest.requested << " events, format " << manifest.format
+           << ") does not match the shard in '" << first.filename << "' (" << first.shards << " shards, seed " << first.seed << ", " << first.requested << " events, format " << first.format << ")." << endl;
+      consistent = false;
+    }
+  }
+  if (!consistent) {
+    return 1;
+  }
+
+  // Every shard has to be present exactly once, with all of its files
+  vector<const Manifest *> shards(first.shards, nullptr);
+  bool complete = true;
+  for (auto &manifest : manifests) {
+    if (manifest.shard >= first.shards) {
+      cerr << "Error: Invalid shard " << manifest.shard << " in '" << manifest.filename << "'." << endl;
+      complete = false;
+    } else if (shards[manifest.shard] != nullptr) {
+      cerr << "Error: Shard " << manifest.shard << " is present twice ('" << shards[manifest.shard]->filename << "' and '" << manifest.filename << "')." << endl;
+      complete = false;
+    } else {
+      shards[manifest.shard] = &manifest;
+    }
+    if (manifest.events != manifest.requested) {
+      cerr << "Error: Shard " << manifest.shard << " only simulated " << manifest.events << " of " << manifest.requested << " events." << endl;
+      complete = false;
+    }
+    for (auto &file : manifest.files) {
+      if (!file_exists(arguments.directory + "/" + file)) {
+        cerr << "Error: The output file '" << file << "' of shard " << manifest.shard << " is missing." << endl;
+        complete = false;
+      }
+    }
+  }
+  for (size_t i = 0; i < shards.size(); ++i) {
+    if (shards[i] == nullptr) {
+      cerr << "Error: Shard " << i << " of " << first.shards << " is missing." << endl;
+      complete = false;
+    }
+  }
+  if (!complete) {
+    return 1;
+  }
+
+  unsigned long totalEvents = 0;
+  vector<string> files;
+  for (auto shard : shards) {
+    totalEvents += shard->events;
+    for (auto &file : shard->files) {
+      files.push_back(arguments.directory + "/" + file);
+    }
+  }
+  cout << "All " << first.shards << " shards of '" << arguments.name << "' are present (seed " << first.seed << ", " << totalEvents << " events, " << files.size() << " files in the " << first.format << " format)." << endl;
+
+  if (arguments.checkOnly) {
+    return 0;
+  }
+
+  if (first.format == "columnar") {
+    // Columnar files are concatenated by columnarToRoot
+    cout << "Columnar files are not merged by mergeShards. Convert them to a single ROOT file with:" << endl
+         << "columnarToRoot -o " << arguments.directory << "/" << arguments.name << "_merged.root";
+    for (auto &file : files) {
+      cout << " " << file;
+    }
+    cout << endl;
+    return 0;
+  }
+
+  // TFileMerger adds the histograms and concatenates the trees with the same names
+  const string outputFilename = arguments.outputFilename.empty() ? arguments.directory + "/" + arguments.name + "_merged.root" : arguments.outputFilename;
+  TFileMerger merger(false);
+  if (!merger.OutputFile(outputFilename.c_str(), "RECREATE")) {
+    cerr << "Error: Could not create the output file '" << outputFilename << "'." << endl;
+    return 1;
+  }
+  for (auto &file : files) {
+    if (!merger.AddFile(file.c_str(), false)) {
+      cerr << "Error: Could not open '" << file << "'." << endl;
+      return 1;
+    }
+  }
+  if (!merger.Merge()) {
+    cerr << "Error: Merging the output files failed." << endl;
+    return 1;
+  }
+  cout << "Merged the output files to '" << outputFilename << "'." << endl;
+
+  return 0;
+}
@@ -0,0 +1,75 @@
+if [ "$#" -lt 3 ]; then
+	echo "Usage:
+$(basename "$0") UTR_REFERENCE UTR_TEST MACRO [NTHREADS]
+Comparison of two utr executables, for example of two physics lists. Both executables need to be compiled for the same geometry. For each executable, the script runs
+
+  1) 'init': the macro MACRO without its /run/beamOn commands, to measure the startup time, i.e. the construction of the geometry and the physics tables
+  2) 'run' : the complete macro MACRO
+
+The difference of the run times of both simulations gives the number of events per second without the initialization. If the program /usr/bin/time is available, the peak memory of each simulation is printed as well. The complete runs write histograms (/utr/output/format histogram) to the directory 'benchmark_executables', and their spectra are compared with the compareSpectra executable, which is expected in the same directory as this script.
+
+    UTR_REFERENCE    utr executable which is used as the reference, e.g. with the default physics list
+    UTR_TEST         utr executable which is compared to the reference
+    MACRO            Macro file, which must contain /run/initialize and /run/beamOn
+    NTHREADS         Number of threads (default: 1)
+"
+	exit 1
+fi
+
+UTR_REFERENCE=$1
+UTR_TEST=$2
+MACRO=$3
+NTHREADS=${4:-1}
+OUTPUTDIR="benchmark_executables"
+NEVENTS=$(awk '$1 == "/run/beamOn" {n += $2} END {print n}' "$MACRO")
+
+mkdir -p $OUTPUTDIR
+grep -v "^[[:space:]]*/run/beamOn" "$MACRO" > "$OUTPUTDIR/init.mac"
+
+for EXECUTABLE in reference test; do
+	if [ "$EXECUTABLE" = "reference" ]; then
+		UTR=$UTR_REFERENCE
+	else
+		UTR=$UTR_TEST
+	fi
+
+	echo "/utr/output/format histogram
+/utr/setUseFilenameID false
+/utr/setFilename $EXECUTABLE
+/control/execute $MACRO" > "$OUTPUTDIR/${EXECUTABLE}_run.mac"
+	rm -f "$OUTPUTDIR/${EXECUTABLE}_hist.root"
+
+	echo "$EXECUTABLE: $UTR"
+	for RUN in init run; do
+		if [ "$RUN" = "init" ]; then
+			RUNMACRO="$OUTPUTDIR/init.mac"
+		else
+			RUNMACRO="$OUTPUTDIR/${EXECUTABLE}_run.mac"
+		fi
+		LOG="$OUTPUTDIR/${EXECUTABLE}_$RUN.log"
+
+		START=$(date +%s.%N)
+		if [ -x /usr/bin/time ]; then
+			/usr/bin/time -f "%M" -o "$OUTPUTDIR/${EXECUTABLE}_$RUN.mem" $UTR -m $RUNMACRO -t $NTHREADS -o $OUTPUTDIR > "$LOG" 2>&1 || { echo "Error: utr failed, see $LOG"; exit 1; }
+			MEMORY=$(tail -n 1 "$OUTPUTDIR/${EXECUTABLE}_$RUN.mem")
+		else
+			$UTR -m $RUNMACRO -t $NTHREADS -o $OUTPUTDIR > "$LOG" 2>&1 || { echo "Error: utr failed, see $LOG"; exit 1; }
+			MEMORY=""
+		fi
+		STOP=$(date +%s.%N)
+
+		if [ "$RUN" = "init" ]; then
+			INIT_TIME=$(awk -v start=$START -v stop=$STOP 'BEGIN {print stop - start}')
+			awk -v t=$INIT_TIME -v mem="$MEMORY" 'BEGIN {printf "\tstartup: %.1f s", t; if (mem != "") printf ", peak memory: %.0f MB", mem / 1024; printf "\n"}'
+		else
+			awk -v start=$START -v stop=$STOP -v init=$INIT_TIME -v n=$NEVENTS -v mem="$MEMORY" 'BEGIN {
+				printf "\trun    : %.1f s, %.1f events/s (without the startup)", stop - start, (stop - start > init ? n / (stop - start - init) : 0)
+				if (mem != "") printf ", peak memory: %.0f MB", mem / 1024
+				printf "\n"
+			}'
+		fi
+	done
+done
+
+echo "Comparison of the spectra (test / reference):"
+$(dirname "$0")/compareSpectra "$OUTPUTDIR/reference_hist.root" "$OUTPUTDIR/test_hist.root"
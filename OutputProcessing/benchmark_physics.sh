@@ -0,0 +1,50 @@
+if [ "$#" -lt 2 ]; then
+	echo "Usage:
+$(basename "$0") UTR MACRO [NTHREADS] [REGIONS]
+Benchmark of the EM_REGIONAL physics. The script runs the same simulation twice with an executable UTR which was compiled with the EM_REGIONAL option:
+
+  1) 'reference': with the polarized Livermore gamma models in the whole geometry (/utr/physics/polarizedRegions DefaultRegionForTheWorld)
+  2) 'regional' : with the polarized Livermore gamma models only in the given REGIONS (default: 'detectors target')
+
+The macro MACRO must contain /run/initialize and /run/beamOn, and it may define regions with the /utr/region/ commands. Both runs write histograms (/utr/output/format histogram) to the directory 'benchmark_physics'. The script prints the run time and the number of events per second of both runs, and compares the spectra with the compareSpectra executable, which is expected in the same directory as this script.
+
+    UTR          utr executable
+    MACRO        Macro file
+    NTHREADS     Number of threads (default: 1)
+    REGIONS      Regions with the polarized models in the second run (default: 'detectors target')
+"
+	exit 1
+fi
+
+UTR=$1
+MACRO=$2
+NTHREADS=${3:-1}
+REGIONS=${4:-"detectors target"}
+OUTPUTDIR="benchmark_physics"
+NEVENTS=$(awk '$1 == "/run/beamOn" {n += $2} END {print n}' "$MACRO")
+
+mkdir -p $OUTPUTDIR
+
+for RUN in reference regional; do
+	if [ "$RUN" = "reference" ]; then
+		RUNREGIONS="DefaultRegionForTheWorld"
+	else
+		RUNREGIONS=$REGIONS
+	fi
+	RUNMACRO="$OUTPUTDIR/$RUN.mac"
+	rm -f "$OUTPUTDIR/${RUN}_hist.root"
+	echo "/utr/physics/polarizedRegions $RUNREGIONS
+/utr/output/format histogram
+/utr/setUseFilenameID false
+/utr/setFilename $RUN
+/control/execute $MACRO" > $RUNMACRO
+
+	echo "Running the '$RUN' simulation with the polarized models in: $RUNREGIONS"
+	START=$(date +%s.%N)
+	$UTR -m $RUNMACRO -t $NTHREADS -o $OUTPUTDIR > "$OUTPUTDIR/$RUN.log" 2>&1 || { echo "Error: utr failed, see $OUTPUTDIR/$RUN.log"; exit 1; }
+	STOP=$(date +%s.%N)
+	awk -v start=$START -v stop=$STOP -v n=$NEVENTS -v run=$RUN 'BEGIN {printf "\t%s: %.1f s, %.1f events/s (including the initialization)\n", run, stop - start, n / (stop - start)}'
+done
+
+echo "Comparison of the spectra (regional / reference):"
+$(dirname "$0")/compareSpectra "$OUTPUTDIR/reference_hist.root" "$OUTPUTDIR/regional_hist.root"
@@ -19,20 +19,33 @@ along with utr.  If not, see <http://www.gnu.org/licenses/>.
 */
 #pragma once
 
-#include "G4Navigator.hh"
 #include "G4ParticleDefinition.hh"
 #include "G4ParticleGun.hh"
 #include "G4ThreeVector.hh"
 #include "G4VUserPrimaryGeneratorAction.hh"
 
+#include <mutex>
 #include <vector>
 
 #include "AngularDistribution.hh"
+#include "AngularDistributionSampler.hh"
+#include "DirectionBatch.hh"
+#include "SourceVolumeSampler.hh"
 
 #define CHECK_POSITION_GENERATOR 1
 #define CHECK_MOMENTUM_GENERATOR 1
-// Maximum value for the sampled w
-#define MAX_W 3.
+// Grid in (cos(theta), phi) for the piecewise-constant envelope of the angular distribution
+// of each cascade step
+#define ENVELOPE_N_COS_THETA 64
+#define ENVELOPE_N_PHI 128
+// The envelope in each cell of the grid is the maximum of W on the grid points, increased
+// by this fraction of the variation of W within the cell
+#define ENVELOPE_MARGIN 0.25
+// If the check of the momentum generator finds values of W above the envelope, the margin
+// is multiplied by this factor and the envelope is tabulated again, at most
+// ENVELOPE_MAX_ENLARGEMENTS times before the simulation is aborted
+#define ENVELOPE_ENLARGEMENT_FACTOR 4.
+#define ENVELOPE_MAX_ENLARGEMENTS 4
 
 using std::vector;
 
@@ -52,12 +65,35 @@ class AngularCorrelationGenerator : public G4VUserPrimaryGeneratorAction {
   G4ThreeVector get_euler_angles(G4ThreeVector reference_direction,
                                  G4ThreeVector reference_polarization);
 
+  // Batched sampling: fill the buffers of starting points, and of the directions and polarizations
+  // of a single step, for batch_size events at once
+  void fill_position_batch();
+  void fill_direction_batch(unsigned long n_particle);
+  void fill_polarization_batch(unsigned long n_particle);
+
   // Self-checks
 
-  void check_position_generator();
-  void check_momentum_generator();
+  // The samples of the checks are distributed over n_threads threads
+  void check_position_generator(G4int n_threads = 1);
+  void check_momentum_generator(G4int n_threads = 1);
   bool momentum_generator_check_unnecessary(unsigned long n_particle);
 
+  // Run the self-checks on the master thread at the beginning of a run, and publish the results
+  // to the worker threads so that they do not have to repeat them
+  void ValidateOnMaster(G4int n_threads);
+
+  // Look up the functions for the spin cascades of all steps whose direction is sampled
+  void resolve_angular_distributions();
+  // Scan the angular distributions of all steps whose direction is sampled on a grid, and
+  // tabulate a piecewise-constant majorant of W which is used as the envelope for the rejection sampling
+  void tabulate_envelopes();
+  void tabulate_envelope(unsigned long n_particle);
+  G4double angular_distribution(unsigned long n_particle, G4double theta, G4double phi) const {
+    if (is_polarized[n_particle])
+      return ang_dist_states[n_particle](theta, phi, &mixing_ratios[n_particle][0]);
+    return ang_dist_states[n_particle](theta, phi, &mixing_ratios[n_particle][0]) + ang_dist_alt_states[n_particle](theta, phi, &mixing_ratios[n_particle][0]);
+  };
+
   // Set-methods to use with the AngularCorrelationMessenger
 
   void AddParticle(G4ParticleDefinition *particleDefinition) {
@@ -72,19 +108,43 @@ class AngularCorrelationGenerator : public G4VUserPrimaryGeneratorAction {
     states.push_back(vector<G4double>(4));
     alt_states.push_back(vector<G4double>(4));
     mixing_ratios.push_back(vector<G4double>(3));
+    ang_dist_states.push_back(nullptr);
+    ang_dist_alt_states.push_back(nullptr);
+    ang_dist_batch_states.push_back(nullptr);
+    ang_dist_batch_alt_states.push_back(nullptr);
+    direction_batches.push_back(DirectionBatch(batch_size));
+    polarization_batches.push_back(DirectionBatch(batch_size));
+    envelopes.push_back(AngularDistributionSampler(ENVELOPE_N_COS_THETA, ENVELOPE_N_PHI));
+    envelope_margins.push_back(ENVELOPE_MARGIN);
+    resolved_angular_distributions = false;
+    tabulated_envelopes = false;
+    checked_momentum_generator = false;
+    clear_batch();
   };
   void SetEnergy(G4double energy) { particleEnergies[particleEnergies.end() - particleEnergies.begin() - 1] = energy; };
   void SetDirection(G4ThreeVector vec) {
     direction = vec;
     direction_given = true;
+    resolved_angular_distributions = false;
+    tabulated_envelopes = false;
+    checked_momentum_generator = false;
+    clear_batch();
   };
   void SetRelativeAngle(G4double relangle) {
     relative_angle[relative_angle.end() - relative_angle.begin() - 1] = relangle;
     relative_angle_given[relative_angle_given.end() - relative_angle_given.begin() - 1] = true;
+    resolved_angular_distributions = false;
+    tabulated_envelopes = false;
+    checked_momentum_generator = false;
+    clear_batch();
   };
 
   void SetNStates(G4int nst) {
     nstates[nstates.end() - nstates.begin() - 1] = nst;
+    resolved_angular_distributions = false;
+    tabulated_envelopes = false;
+    checked_momentum_generator = false;
+    clear_batch();
   };
   void SetState(G4int n_state, G4double jpi) {
     states[states.end() - states.begin() - 1][n_state] = jpi;
@@ -93,25 +153,80 @@ class AngularCorrelationGenerator : public G4VUserPrimaryGeneratorAction {
     } else {
       alt_states[states.end() - states.begin() - 1][n_state] = jpi;
     }
+    resolved_angular_distributions = false;
+    tabulated_envelopes = false;
+    checked_momentum_generator = false;
+    clear_batch();
   };
   void SetDelta(G4int n_transition, G4double delta) {
     mixing_ratios[mixing_ratios.end() - mixing_ratios.begin() - 1][n_transition] = delta;
+    tabulated_envelopes = false;
+    checked_momentum_generator = false;
+    clear_batch();
   };
   void SetPolarization(G4ThreeVector vec) {
     polarization[polarization.end() - polarization.begin() - 1] = vec;
     if (vec.mag() > 0.)
       is_polarized[is_polarized.end() - is_polarized.begin() - 1] = true;
+    resolved_angular_distributions = false;
+    tabulated_envelopes = false;
+    checked_momentum_generator = false;
+    clear_batch();
+  };
+
+  void SetSourceX(G4double x) {
+    source_x = x;
+    source_sampler.Clear();
+    checked_position_generator = false;
+    clear_batch();
+  };
+  void SetSourceY(G4double y) {
+    source_y = y;
+    source_sampler.Clear();
+    checked_position_generator = false;
+    clear_batch();
+  };
+  void SetSourceZ(G4double z) {
+    source_z = z;
+    source_sampler.Clear();
+    checked_position_generator = false;
+    clear_batch();
   };
 
-  void SetSourceX(G4double x) { source_x = x; };
-  void SetSourceY(G4double y) { source_y = y; };
-  void SetSourceZ(G4double z) { source_z = z; };
+  void SetSourceDX(G4double dx) {
+    range_x = dx;
+    source_sampler.Clear();
+    checked_position_generator = false;
+    clear_batch();
+  };
+  void SetSourceDY(G4double dy) {
+    range_y = dy;
+    source_sampler.Clear();
+    checked_position_generator = false;
+    clear_batch();
+  };
+  void SetSourceDZ(G4double dz) {
+    range_z = dz;
+    source_sampler.Clear();
+    checked_position_generator = false;
+    clear_batch();
+  };
 
-  void SetSourceDX(G4double dx) { range_x = dx; };
-  void SetSourceDY(G4double dy) { range_y = dy; };
-  void SetSourceDZ(G4double dz) { range_z = dz; };
+  void AddSourcePV(G4String physvol) {
+    source_PV_names.push_back(physvol);
+    source_sampler.Clear();
+    checked_position_generator = false;
+    clear_batch();
+  };
 
-  void AddSourcePV(G4String physvol) { source_PV_names.push_back(physvol); };
+  void SetBatchSize(G4int size) {
+    batch_size = size;
+    for (auto &batch : direction_batches)
+      batch.SetSize(batch_size);
+    for (auto &batch : polarization_batches)
+      batch.SetSize(batch_size);
+    clear_batch();
+  };
 
   // Get-methods to use with the AngularCorrelationMessenger
 
@@ -140,6 +255,8 @@ class AngularCorrelationGenerator : public G4VUserPrimaryGeneratorAction {
 
   G4String GetSourcePV(int i) { return source_PV_names[i]; };
 
+  G4int GetBatchSize() { return batch_size; };
+
   private:
   G4ParticleTable *particleTable;
   G4ParticleGun *particleGun;
@@ -161,13 +278,8 @@ class AngularCorrelationGenerator : public G4VUserPrimaryGeneratorAction {
   G4double range_y;
   G4double range_z;
 
-  G4String pv;
-  G4String pvx;
-  G4String pvmx;
-  G4String pvy;
-  G4String pvmy;
-  G4String pvz;
-  G4String pvmz;
+  // Samples the starting points inside the source volumes
+  SourceVolumeSampler source_sampler;
 
   // Particle properties
   vector<G4ParticleDefinition *> particles;
@@ -182,23 +294,50 @@ class AngularCorrelationGenerator : public G4VUserPrimaryGeneratorAction {
   vector<vector<G4double>> alt_states;
   vector<vector<G4double>> mixing_ratios;
 
+  // Functions which evaluate the angular distributions of the states and alt_states cascades.
+  // They are looked up once, not for every sampled direction.
+  vector<AngDistFunction> ang_dist_states;
+  vector<AngDistFunction> ang_dist_alt_states;
+  vector<AngDistBatchFunction> ang_dist_batch_states;
+  vector<AngDistBatchFunction> ang_dist_batch_alt_states;
+  G4bool resolved_angular_distributions;
+  // Piecewise-constant envelopes of the angular distributions for the rejection sampling
+  vector<AngularDistributionSampler> envelopes;
+  // Margins of the envelopes, which start at ENVELOPE_MARGIN and are only enlarged by the check of the momentum generator
+  vector<G4double> envelope_margins;
+  G4bool tabulated_envelopes;
+  // Acceptance of the rejection sampling for each step, as determined by the self-check of the momentum generator
+  vector<G4double> momentum_acceptance;
+
   vector<G4bool> is_polarized;
   vector<G4ThreeVector> polarization;
 
+  // Batched sampling mode: starting points, directions and polarizations are sampled
+  // /angcorr/batchSize at a time and buffered
+  unsigned int batch_size;
+  vector<G4ThreeVector> position_batch;
+  size_t next_position;
+  vector<DirectionBatch> direction_batches;
+  vector<DirectionBatch> polarization_batches;
+  // Values of the alternative cascade, which are needed for the batched evaluation of unpolarized distributions
+  vector<G4double> w_alt_batch;
+  void clear_batch() {
+    position_batch.clear();
+    next_position = 0;
+    for (auto &batch : direction_batches)
+      batch.Clear();
+    for (auto &batch : polarization_batches)
+      batch.Clear();
+  };
+
   /*********************************************
    *  Local variables
    *********************************************/
 
-  G4double random_x;
-  G4double random_y;
-  G4double random_z;
-
   G4double random_theta;
   G4double random_phi;
   G4double random_w;
 
-  G4Navigator *navi;
-
   const G4int MAX_TRIES_POSITION;
   const G4int MAX_TRIES_MOMENTUM;
   G4bool direction_given;
@@ -206,4 +345,15 @@ class AngularCorrelationGenerator : public G4VUserPrimaryGeneratorAction {
 
   G4bool checked_momentum_generator;
   G4bool checked_position_generator;
+
+  // Copy the results of ValidateOnMaster(), if available
+  void use_master_validation();
+
+  // Results of the self-checks on the master thread, shared with all worker threads
+  static std::mutex master_validation_mutex;
+  static G4bool master_checked_position_generator;
+  static G4bool master_checked_momentum_generator;
+  static G4double master_position_acceptance;
+  static vector<G4double> master_momentum_acceptance;
+  static vector<G4double> master_envelope_margins;
 };
@@ -85,4 +85,6 @@ class AngularCorrelationMessenger : public G4UImessenger {
   G4UIcmdWithAString *sourcePVCmd;
 
   G4UIcmdWith3Vector *polarizationCmd;
+
+  G4UIcmdWithAnInteger *batchSizeCmd;
 };
@@ -19,10 +19,24 @@ along with utr.  If not, see <http://www.gnu.org/licenses/>.
 */
 #pragma once
 
+// Angular distribution W(theta, phi) of a single spin cascade, given the multipole mixing ratios mix
+typedef double (*AngDistFunction)(double theta, double phi, const double *mix);
+// Angular distribution of a single spin cascade for n directions: w[i] = W(theta[i], phi[i])
+typedef void (*AngDistBatchFunction)(const double *theta, const double *phi, const double *mix, double *w, unsigned int n);
+
 class AngularDistribution {
   public:
   AngularDistribution(){};
   ~AngularDistribution(){};
 
+  // Look up the spin cascade st[0] -> ... -> st[nst-1] and return the function which evaluates
+  // its angular distribution, or nullptr if the cascade is not implemented.
+  // The lookup is expensive compared to the evaluation, so it should be done once per cascade.
+  AngDistFunction GetAngDistFunction(const double *st, int nst) const;
+  // Same as GetAngDistFunction, but returns a function which evaluates the angular distribution
+  // for a whole batch of directions
+  AngDistBatchFunction GetAngDistBatchFunction(const double *st, int nst) const;
+
+  // Convenience function which looks up the cascade on every call
   double AngDist(double theta, double phi, double *st, int nst, double *mix) const;
 };
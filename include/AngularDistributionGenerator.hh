@@ -19,20 +19,27 @@ along with utr.  If not, see <http://www.gnu.org/licenses/>.
 */
 #pragma once
 
-#include "G4Navigator.hh"
 #include "G4ParticleDefinition.hh"
 #include "G4ParticleGun.hh"
 #include "G4ThreeVector.hh"
 #include "G4VUserPrimaryGeneratorAction.hh"
 
+#include <mutex>
 #include <vector>
 
 #include "AngularDistribution.hh"
+#include "AngularDistributionSampler.hh"
+#include "DirectionBatch.hh"
+#include "SourceVolumeSampler.hh"
 
 #define CHECK_POSITION_GENERATOR 1
 #define CHECK_MOMENTUM_GENERATOR 1
 // Maximum value for the sampled w
 #define MAX_W 3.
+// After the self-check of the momentum generator, w is only sampled up to the maximal
+// occurred value of the angular distribution, increased by this relative margin.
+// If a larger value of W is encountered during the run, w is sampled up to MAX_W again.
+#define MAX_W_MARGIN 0.1
 
 using std::vector;
 
@@ -45,33 +52,131 @@ class AngularDistributionGenerator : public G4VUserPrimaryGeneratorAction {
 
   void GeneratePrimaries(G4Event *anEvent);
 
-  // Self-checks
-  void check_position_generator();
-  void check_momentum_generator();
+  // Self-checks, whose samples are distributed over n_threads threads
+  void check_position_generator(G4int n_threads = 1);
+  void check_momentum_generator(G4int n_threads = 1);
+
+  // Run the self-checks on the master thread at the beginning of a run, and publish the results
+  // to the worker threads so that they do not have to repeat them
+  void ValidateOnMaster(G4int n_threads);
+
+  // Look up the functions for the given spin cascades
+  void resolve_angular_distribution();
+  G4double angular_distribution(G4double theta, G4double phi) const {
+    if (is_polarized)
+      return ang_dist_states(theta, phi, mixing_ratios);
+    return (ang_dist_states(theta, phi, mixing_ratios) + ang_dist_alt_states(theta, phi, mixing_ratios)) / 2.;
+  };
+
+  // Build the table for the inverse-CDF sampling mode and report its deviation from AngDist
+  void tabulate_angular_distribution();
+
+  // Sample batch_size starting points and momentum directions at once, which are used by the
+  // following calls of GeneratePrimaries()
+  void fill_batch();
+
+  // Called when W(theta, phi) == w exceeds max_w. Resets max_w to MAX_W, so that the
+  // rejection sampling does not truncate the angular distribution.
+  void reset_max_w(G4double w);
 
   // Set- and Get- methods to use with the AngularDistributionMessenger
 
-  void SetNStates(G4int nst) { nstates = nst; };
-  void SetState(G4int statenumber, G4double st) { states[statenumber] = st; };
+  void SetNStates(G4int nst) {
+    nstates = nst;
+    checked_momentum_generator = false;
+    ang_dist_states = nullptr;
+    sampler.Clear();
+    clear_batch();
+  };
+  void SetState(G4int statenumber, G4double st) {
+    states[statenumber] = st;
+    checked_momentum_generator = false;
+    ang_dist_states = nullptr;
+    sampler.Clear();
+    clear_batch();
+  };
   void SetDelta(G4int deltanumber, G4double delta) {
     mixing_ratios[deltanumber] = delta;
+    checked_momentum_generator = false;
+    sampler.Clear();
+    clear_batch();
   };
 
   void SetParticleEnergy(G4double en) { particleEnergy = en; };
   void SetParticleDefinition(G4ParticleDefinition *pd) {
     particleDefinition = pd;
   };
-  void SetSourceX(G4double x) { source_x = x; };
-  void SetSourceY(G4double y) { source_y = y; };
-  void SetSourceZ(G4double z) { source_z = z; };
+  void SetSourceX(G4double x) {
+    source_x = x;
+    source_sampler.Clear();
+    checked_position_generator = false;
+    clear_batch();
+  };
+  void SetSourceY(G4double y) {
+    source_y = y;
+    source_sampler.Clear();
+    checked_position_generator = false;
+    clear_batch();
+  };
+  void SetSourceZ(G4double z) {
+    source_z = z;
+    source_sampler.Clear();
+    checked_position_generator = false;
+    clear_batch();
+  };
 
-  void SetSourceDX(G4double dx) { range_x = dx; };
-  void SetSourceDY(G4double dy) { range_y = dy; };
-  void SetSourceDZ(G4double dz) { range_z = dz; };
+  void SetSourceDX(G4double dx) {
+    range_x = dx;
+    source_sampler.Clear();
+    checked_position_generator = false;
+    clear_batch();
+  };
+  void SetSourceDY(G4double dy) {
+    range_y = dy;
+    source_sampler.Clear();
+    checked_position_generator = false;
+    clear_batch();
+  };
+  void SetSourceDZ(G4double dz) {
+    range_z = dz;
+    source_sampler.Clear();
+    checked_position_generator = false;
+    clear_batch();
+  };
 
-  void AddSourcePV(G4String physvol) { source_PV_names.push_back(physvol); };
+  void AddSourcePV(G4String physvol) {
+    source_PV_names.push_back(physvol);
+    source_sampler.Clear();
+    checked_position_generator = false;
+    clear_batch();
+  };
 
-  void SetPolarized(G4bool pol) { is_polarized = pol; };
+  void SetPolarized(G4bool pol) {
+    is_polarized = pol;
+    checked_momentum_generator = false;
+    ang_dist_states = nullptr;
+    sampler.Clear();
+    clear_batch();
+  };
+
+  void SetInverseCDF(G4bool icdf) {
+    use_inverse_cdf = icdf;
+    checked_momentum_generator = false;
+    clear_batch();
+  };
+  void SetInverseCDFNBinsCosTheta(G4int nbins) {
+    sampler.SetNBins(nbins, sampler.GetNBinsPhi());
+    clear_batch();
+  };
+  void SetInverseCDFNBinsPhi(G4int nbins) {
+    sampler.SetNBins(sampler.GetNBinsCosTheta(), nbins);
+    clear_batch();
+  };
+
+  void SetBatchSize(G4int size) {
+    direction_batch.SetSize(size);
+    clear_batch();
+  };
 
   G4ParticleDefinition *GetParticleDefinition() {
     return particleDefinition;
@@ -95,6 +200,12 @@ class AngularDistributionGenerator : public G4VUserPrimaryGeneratorAction {
 
   G4bool IsPolarized() { return is_polarized; };
 
+  G4bool GetInverseCDF() { return use_inverse_cdf; };
+  G4int GetInverseCDFNBinsCosTheta() { return sampler.GetNBinsCosTheta(); };
+  G4int GetInverseCDFNBinsPhi() { return sampler.GetNBinsPhi(); };
+
+  G4int GetBatchSize() { return direction_batch.GetSize(); };
+
   private:
   G4ParticleGun *particleGun;
   AngularDistributionMessenger *angDistMessenger;
@@ -112,6 +223,15 @@ class AngularDistributionGenerator : public G4VUserPrimaryGeneratorAction {
   // possibilities is to switch the parity of the first excited state in the cascade.
   G4double alt_states[4];
   G4double mixing_ratios[3];
+  // Functions which evaluate the angular distributions of the states and alt_states cascades.
+  // They are looked up once, not for every sampled direction.
+  AngDistFunction ang_dist_states;
+  AngDistFunction ang_dist_alt_states;
+  AngDistBatchFunction ang_dist_batch_states;
+  AngDistBatchFunction ang_dist_batch_alt_states;
+  // Upper limit of the sampled w, which is reduced from MAX_W by the self-check of the momentum generator
+  G4double max_w;
+  G4double momentum_acceptance;
 
   G4double source_x;
   G4double source_y;
@@ -123,11 +243,40 @@ class AngularDistributionGenerator : public G4VUserPrimaryGeneratorAction {
 
   G4bool is_polarized;
 
-  G4Navigator *navi;
+  // Samples the starting points inside the source volumes
+  SourceVolumeSampler source_sampler;
+
+  // Inverse-CDF sampling of the momentum direction as an alternative to rejection sampling
+  G4bool use_inverse_cdf;
+  AngularDistributionSampler sampler;
+
+  // Batched sampling mode: starting points and directions are sampled /ang/batchSize at a time
+  // and buffered, so that GeneratePrimaries() only takes the next one from the buffer
+  DirectionBatch direction_batch;
+  vector<G4ThreeVector> position_batch;
+  size_t next_position;
+  // Values of the alternative cascade, which are needed for the batched evaluation of unpolarized distributions
+  vector<G4double> w_alt_batch;
+  void clear_batch() {
+    direction_batch.Clear();
+    position_batch.clear();
+    next_position = 0;
+  };
 
   G4double MAX_TRIES_POSITION;
   G4double MAX_TRIES_MOMENTUM;
 
   G4bool checked_position_generator;
   G4bool checked_momentum_generator;
+
+  // Copy the results of ValidateOnMaster(), if available
+  void use_master_validation();
+
+  // Results of the self-checks on the master thread, shared with all worker threads
+  static std::mutex master_validation_mutex;
+  static G4bool master_checked_position_generator;
+  static G4bool master_checked_momentum_generator;
+  static G4double master_position_acceptance;
+  static G4double master_momentum_acceptance;
+  static G4double master_max_w;
 };
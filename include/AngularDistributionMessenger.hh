@@ -70,4 +70,10 @@ class AngularDistributionMessenger : public G4UImessenger {
   G4UIcmdWithAString *sourcePVCmd;
 
   G4UIcmdWithABool *polarizationCmd;
+
+  G4UIcmdWithABool *inverseCDFCmd;
+  G4UIcmdWithAnInteger *inverseCDFNCosThetaCmd;
+  G4UIcmdWithAnInteger *inverseCDFNPhiCmd;
+
+  G4UIcmdWithAnInteger *batchSizeCmd;
 };
@@ -0,0 +1,86 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include <functional>
+#include <vector>
+
+using std::vector;
+
+// Tabulates an angular distribution W(theta, phi) on a grid of cells in (cos(theta), phi).
+// Since all cells cover the same solid angle, the probability to emit a particle into a
+// cell is proportional to the mean value of W in that cell. Directions are sampled from the
+// cumulative table without any rejection: a single uniform random number selects the cell
+// via a binary search, and two more place the direction uniformly inside the cell.
+// The piecewise-constant table is an approximation of W, whose error is estimated in Tabulate().
+//
+// Alternatively, TabulateMajorant() stores an upper bound of W in each cell. Sampling from
+// this piecewise-constant majorant M and accepting the direction with the probability W/M
+// is an exact rejection sampling method whose acceptance is the ratio of the integrals of
+// W and M. For smooth distributions, this is much closer to 1 than for a constant envelope.
+class AngularDistributionSampler {
+  public:
+  AngularDistributionSampler(unsigned int n_cos_theta = 100, unsigned int n_phi = 200);
+  ~AngularDistributionSampler(){};
+
+  void SetNBins(unsigned int n_cos_theta, unsigned int n_phi);
+  unsigned int GetNBinsCosTheta() const { return n_bins_cos_theta; };
+  unsigned int GetNBinsPhi() const { return n_bins_phi; };
+
+  // Evaluate W on the grid and build the cumulative table.
+  // Returns false if W is nowhere positive, i.e. if there is nothing to sample.
+  bool Tabulate(const std::function<double(double, double)> &w);
+  // Evaluate W on the grid and store an upper bound of W in each cell.
+  // The maximum of W on the corners, edges and inside of the cell is increased by margin
+  // times the variation of W within the cell, to account for maxima between the grid points.
+  // Returns false if W is nowhere positive.
+  bool TabulateMajorant(const std::function<double(double, double)> &w, double margin);
+  bool IsTabulated() const { return !cumulative.empty(); };
+  void Clear() {
+    cumulative.clear();
+    table.clear();
+  };
+
+  // u_cell, u_cos_theta and u_phi are uniform random numbers in [0, 1).
+  // Returns the table entry of the cell of the sampled direction.
+  double Sample(double u_cell, double u_cos_theta, double u_phi, double &theta, double &phi) const;
+
+  // Results of the comparison between the table and W during Tabulate()
+  double GetMaxW() const { return max_w; };
+  // Largest observed |W(theta, phi) - W_table(theta, phi)|, relative to the maximum of W
+  double GetMaxDeviation() const { return max_deviation; };
+  // Mean |W(theta, phi) - W_table(theta, phi)| relative to the mean of W.
+  // This is an estimate of the integral of |W - W_table| over the unit sphere, normalized to the integral of W.
+  double GetMeanDeviation() const { return mean_deviation; };
+  // Estimated ratio of the integrals of W and the majorant, i.e. the acceptance of the rejection sampling
+  double GetMajorantAcceptance() const { return majorant_acceptance; };
+
+  private:
+  unsigned int n_bins_cos_theta;
+  unsigned int n_bins_phi;
+
+  vector<double> cumulative;
+  vector<double> table;
+
+  double max_w;
+  double max_deviation;
+  double mean_deviation;
+  double majorant_acceptance;
+};
@@ -0,0 +1,107 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include <vector>
+
+#include "G4LogicalVolume.hh"
+#include "G4Material.hh"
+#include "G4ThreeVector.hh"
+#include "G4VPhysicalVolume.hh"
+#include "G4VSolid.hh"
+#include "globals.hh"
+
+using std::vector;
+
+// Collects the volumes of a brick wall or a lead castle in an envelope, i.e. a box of the
+// material of the mother volume which is just large enough to contain them. The navigation in
+// the mother volume then only sees a single daughter instead of hundreds of bricks.
+//
+// All daughters which are placed in the mother volume between the construction of the envelope
+// and the call of Close() are members of the envelope, so the bricks of Bricks.hh and Filters.hh
+// and any other G4PVPlacement can be used with World_Logical as before:
+//
+//   BrickEnvelope *wall = new BrickEnvelope(World_Logical, "Wall0");
+//   nb->Put(...);
+//   ...
+//   wall->Close();
+//   ... (rest of the geometry)
+//   BrickEnvelope::BuildAll();
+//
+// The envelopes are only built by BuildAll(), at the end of the construction of the geometry,
+// because the bounding box of the members usually also contains other volumes, like a beam pipe
+// through the hole of a wall. All non-member daughters of the mother volume whose bounding
+// boxes intersect the envelope are subtracted from it. Envelopes whose bounding boxes intersect
+// are merged. Since the material of the envelope is the one of the mother volume, the geometry
+// is physically unchanged.
+//
+// Envelopes of distant support structures can be homogenized (see GeometryDetail.hh): if the
+// level of detail is HOMOGENIZED_DETAIL, the members are removed, and the envelope is filled with
+// a mixture of their materials and the material of the mother volume, which has the same mass as
+// the members and the mother material in the envelope. Instead of the bounding box, the structure
+// can define an envelope solid which is closer to its outer shape with SetSolid(). Homogenized
+// envelopes are built first, so that the other envelopes subtract their final solids. They must not
+// contain sensitive volumes, nor parts which define the beam, like collimators.
+//
+// The envelopes are only created and built during the construction of the geometry by the master thread.
+class BrickEnvelope {
+  public:
+  BrickEnvelope(G4LogicalVolume *mother_Logical, const G4String &name, G4bool homogenizable = false);
+  ~BrickEnvelope(){};
+
+  // Stop collecting daughters of the mother volume
+  void Close();
+  // Use the given solid, placed at position in the mother volume, instead of the bounding box.
+  // It has to contain all members.
+  void SetSolid(G4VSolid *solid, const G4ThreeVector &position);
+
+  // Build and place all closed envelopes, and forget them afterwards
+  static void BuildAll(G4bool check_overlaps = false);
+
+  // Envelopes can be switched off to compare the navigation performance (default: true).
+  // If they are switched off, BuildAll() leaves the members in their mother volume, unless they
+  // are homogenized.
+  static void SetEnabled(G4bool enable) { enabled = enable; };
+  static G4bool GetEnabled() { return enabled; };
+
+  private:
+  void update_bounding_box();
+  G4bool intersects(const G4ThreeVector &min, const G4ThreeVector &max) const;
+  G4bool homogenized() const;
+  void build(G4bool check_overlaps);
+  // Add the masses of the materials of a logical volume and its daughters
+  static void add_masses(G4LogicalVolume *logical, vector<std::pair<G4Material *, G4double>> &masses);
+  // Bounding box of a daughter volume in the coordinate system of its mother
+  static void bounding_box(const G4VPhysicalVolume *physical, G4ThreeVector &min, G4ThreeVector &max);
+
+  G4LogicalVolume *mother_logical;
+  G4String envelope_name;
+  size_t first_daughter;
+  G4bool closed;
+  G4bool homogenizable;
+  G4VSolid *solid;
+  G4ThreeVector solid_position;
+  vector<G4VPhysicalVolume *> members;
+  G4ThreeVector bounding_box_min;
+  G4ThreeVector bounding_box_max;
+
+  static vector<BrickEnvelope *> envelopes;
+  static G4bool enabled;
+};
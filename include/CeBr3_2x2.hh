@@ -65,4 +65,6 @@ class CeBr3_2x2 : public Detector {
 
   private:
   bool use_connectors;
+  // Key of the shared model (see Detector::useModelCache())
+  G4String model_key(G4double intrinsic_rotation_angle) const;
 };
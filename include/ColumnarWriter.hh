@@ -0,0 +1,124 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using std::string;
+using std::vector;
+
+// Writes a table with typed columns to a binary file.
+// The rows are buffered column by column and written in chunks of a fixed number of rows, so
+// that filling a value only copies it into the buffer of its column.
+//
+// File format (native byte order, i.e. little endian on all platforms utr runs on):
+//
+//   char     magic[8]         "UTRCOL01"
+//   uint32   n_columns
+//   n_columns times:
+//     uint8  type             (see ColumnType)
+//     uint8  name_length
+//     char   name[name_length]
+//   Chunks until the end of the file:
+//     uint32 n_rows           (the chunk size, except for the last chunk)
+//     n_columns times:
+//       n_rows values of the type of the column
+//
+// OutputProcessing/ColumnarReader.hh is a header-only reader for these files.
+class ColumnarWriter {
+  public:
+  enum ColumnType : uint8_t {
+    INT32 = 0,
+    INT64 = 1,
+    FLOAT32 = 2,
+    FLOAT64 = 3
+  };
+  static size_t GetTypeSize(ColumnType type) { return (type == INT64 || type == FLOAT64) ? 8 : 4; };
+
+  ColumnarWriter(unsigned int chunk_size = 4096);
+  ~ColumnarWriter();
+
+  // Columns can only be added or removed while no file is open
+  unsigned int AddColumn(const string &name, ColumnType type);
+  void ClearColumns();
+  unsigned int GetNColumns() const { return (unsigned int)columns.size(); };
+
+  // Open a new file and write the header. Returns false if the file could not be opened.
+  bool Open(const string &filename);
+  // Write the last, incomplete chunk and close the file
+  void Close();
+  bool IsOpen() const { return file != nullptr; };
+
+  // Set the value of a column in the current row. The value is converted to the type of the column.
+  // Columns which are not filled are zero.
+  template <typename T>
+  void Fill(unsigned int column, T value) {
+    Column &c = columns[column];
+    switch (c.type) {
+      case INT32:
+        store(c, (int32_t)value);
+        break;
+      case INT64:
+        store(c, (int64_t)value);
+        break;
+      case FLOAT32:
+        store(c, (float)value);
+        break;
+      case FLOAT64:
+        store(c, (double)value);
+        break;
+    }
+  };
+  // Finish the current row
+  void AddRow() {
+    if (++n_rows == chunk_size) {
+      WriteChunk();
+    }
+  };
+
+  unsigned long GetNBytesWritten() const { return n_bytes_written; };
+
+  private:
+  struct Column {
+    string name;
+    ColumnType type;
+    size_t type_size;
+    vector<char> buffer;
+  };
+
+  template <typename T>
+  void store(Column &c, T value) {
+    memcpy(c.buffer.data() + n_rows * sizeof(T), &value, sizeof(T));
+  };
+
+  void write(const void *data, size_t size);
+  void WriteChunk();
+
+  unsigned int chunk_size;
+  unsigned int n_rows;
+  vector<Column> columns;
+
+  FILE *file;
+  unsigned long n_bytes_written;
+};
@@ -0,0 +1,46 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include "G4VSensitiveDetector.hh"
+
+#include <map>
+
+class G4Step;
+class G4HCofThisEvent;
+
+// Sensitive detector of a logical volume which is shared by several detectors (see
+// DetectorModelCache). It does not record anything itself, but passes each step to the
+// sensitive detector of the detector in which the step happened. The detector is identified
+// by the copy number of the physical volume at the given depth of the touchable history,
+// which is the placement of the detector model that contains the logical volume.
+class CopyNumberSD : public G4VSensitiveDetector {
+  public:
+  CopyNumberSD(const G4String &name, G4int copy_number_depth);
+  virtual ~CopyNumberSD();
+
+  void AddSensitiveDetector(G4int copy_number, G4VSensitiveDetector *sensitive_detector) { sensitive_detectors[copy_number] = sensitive_detector; };
+
+  virtual G4bool ProcessHits(G4Step *step, G4TouchableHistory *history);
+
+  private:
+  G4int depth;
+  std::map<G4int, G4VSensitiveDetector *> sensitive_detectors;
+};
@@ -26,9 +26,13 @@ along with utr.  If not, see <http://www.gnu.org/licenses/>.
 #include <vector>
 
 #include "G4LogicalVolume.hh"
+#include "G4RotationMatrix.hh"
+#include "G4ThreeVector.hh"
 
 using std::vector;
 
+struct DetectorModel;
+
 class Detector {
   public:
   Detector(G4LogicalVolume *World_Logical, G4String name);
@@ -45,8 +49,21 @@ class Detector {
   // to shield low-energy radiation. Similar to the filters, additional wraps
   // will be wrapped around previous ones.
   void Add_Wrap(G4String wrap_material, G4double wrap_thickness);
+  // Share the logical volumes with all other detectors of the same type which use the model
+  // cache and have the same properties, filters and wraps (see DetectorModelCache).
+  // The sensitive detectors have to be attached with DetectorModelCache::SetSensitiveDetector().
+  void useModelCache() { use_model_cache = true; };
 
   protected:
+  // Place a top-level part of the detector in the world volume. The local position is given in the
+  // coordinate system of the detector, whose origin is placed at 'origin' with the rotation 'rotation'.
+  // If the detector is constructed as a shared model, the part is added to the model instead.
+  void place(G4RotationMatrix *rotation, G4ThreeVector origin, DetectorModel *model, G4LogicalVolume *logical, G4String name, G4ThreeVector local_position) const;
+  // Description of the filters and wraps, which is a part of the key of a shared model.
+  // The filters of a model start at the distance 'filter_position_z' from the front of the detector.
+  G4String filter_and_wrap_key(G4double filter_position_z) const;
+
+
   G4LogicalVolume *world_Logical;
   G4String detector_name;
 
@@ -56,4 +73,6 @@ class Detector {
 
   vector<G4String> wrap_materials;
   vector<G4double> wrap_thicknesses;
+
+  bool use_model_cache;
 };
@@ -0,0 +1,73 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include "G4RotationMatrix.hh"
+#include "G4ThreeVector.hh"
+#include "G4VPhysicalVolume.hh"
+#include "globals.hh"
+
+#include <vector>
+
+using std::vector;
+
+// Geometric acceptance of all sensitive detectors of the current thread.
+// Each placement of a logical volume with a sensitive detector is enclosed in a sphere around
+// the extent of its solid (G4VSolid::BoundingLimits()), transformed to the world frame.
+// A straight line from a point in a given direction can only enter a detector if it
+// intersects one of the spheres, so the spheres give a conservative estimate of the detectors
+// that are visible from any point without a table for each possible origin.
+// Sensitive volumes inside replicated or parameterised volumes are represented by the
+// sphere of the mother volume of the replica, since the positions of the copies are not unique.
+class DetectorAcceptance {
+  public:
+  DetectorAcceptance() : margin(0.){};
+  ~DetectorAcceptance(){};
+
+  // Find all sensitive volumes in the geometry tree of the world volume. The sensitive detectors
+  // are thread-local, so this has to be called by each thread after ConstructSDandField().
+  void Build();
+  void Clear();
+  size_t GetNDetectors() const { return radius.size(); };
+
+  // Increase the radius of all spheres by a safety margin
+  void SetMargin(G4double m) { margin = m; };
+  G4double GetMargin() const { return margin; };
+
+  // True if the ray from position in the (unit) direction intersects the sphere of at least one
+  // detector, or if the position is inside a sphere. Always true if there are no detectors.
+  G4bool CanReach(const G4ThreeVector &position, const G4ThreeVector &direction) const;
+  // True if the distance from position to the sphere of every detector is larger than distance,
+  // i.e. if a particle with a range smaller than distance cannot reach any detector.
+  // Always false if there are no detectors.
+  G4bool IsFartherThan(const G4ThreeVector &position, G4double distance) const;
+
+  private:
+  void find_sensitive_volumes(G4VPhysicalVolume *physical_volume, const G4RotationMatrix &rotation, const G4ThreeVector &translation);
+  G4bool contains_sensitive_volume(const G4LogicalVolume *logical_volume) const;
+  void add_sphere(const G4LogicalVolume *logical_volume, const G4RotationMatrix &rotation, const G4ThreeVector &translation);
+
+  G4double margin;
+
+  vector<G4double> center_x;
+  vector<G4double> center_y;
+  vector<G4double> center_z;
+  vector<G4double> radius;
+};
@@ -0,0 +1,101 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include <map>
+#include <vector>
+
+#include "G4AssemblyVolume.hh"
+#include "G4LogicalVolume.hh"
+#include "G4RotationMatrix.hh"
+#include "G4ThreeVector.hh"
+#include "G4VSensitiveDetector.hh"
+#include "globals.hh"
+
+class CopyNumberSD;
+
+using std::vector;
+
+// The logical volumes of a detector, which can be shared by all detectors of the same type
+// with the same properties, filters and wraps. The top-level parts of the detector are collected
+// in a G4AssemblyVolume, and each detector is an imprint of the assembly, so identical
+// detectors only differ in the physical volumes of their top-level parts.
+struct DetectorModel {
+  struct SensitiveVolume {
+    G4LogicalVolume *logical;
+    // Suffix which is appended to the name of a detector to get the name of its sensitive volume
+    G4String suffix;
+    // Index of the top-level part which contains the sensitive volume, and the depth of the
+    // sensitive volume in that part
+    size_t part;
+    G4int depth;
+  };
+
+  G4AssemblyVolume *assembly;
+  // Suffixes which are appended to the name of a detector to get the names of the physical
+  // volumes of its top-level parts, in the order in which they were added to the assembly
+  vector<G4String> part_suffixes;
+  vector<SensitiveVolume> sensitive_volumes;
+  unsigned int n_placements;
+};
+
+// Cache of the detector models, keyed by a string which contains everything the construction
+// of a detector depends on (see Detector::useModelCache()).
+// Since the sensitive volumes of a model are shared, the detectors are identified by the copy
+// numbers of their top-level parts: SetSensitiveDetector() attaches a CopyNumberSD to the shared
+// logical volume, which passes the steps on to the sensitive detector of each detector.
+// The geometry is constructed by the master thread, while the sensitive detectors are created by
+// each thread. Therefore, the models and placements are only modified during the construction of
+// the geometry, and only read by ConstructSDandField().
+class DetectorModelCache {
+  public:
+  // Returns nullptr if there is no model for the key yet
+  static DetectorModel *Find(const G4String &key);
+  static DetectorModel *Create(const G4String &key);
+  // Add a top-level part to the assembly of a model
+  static void AddPart(DetectorModel *model, G4LogicalVolume *logical, const G4String &suffix, G4ThreeVector local_position);
+  // Register a sensitive volume, after all parts of the model have been added to the assembly
+  static void AddSensitiveVolume(DetectorModel *model, G4LogicalVolume *logical, const G4String &suffix);
+  // Place a detector. The rotation and the origin are given in the convention of G4PVPlacement,
+  // i.e. the rotation is the inverse of the rotation of the detector.
+  // The imprinted physical volumes of the top-level parts are renamed after the detector.
+  static void Place(DetectorModel *model, const G4String &detector_name, G4RotationMatrix *rotation, const G4ThreeVector &origin, G4LogicalVolume *mother_logical);
+
+  // Attach a sensitive detector to the sensitive volume 'name' of a detector, i.e. the detector
+  // name with the suffix of the volume. Volumes of detectors which do not use a model are looked
+  // up by their name, like G4VUserDetectorConstruction::SetSensitiveDetector() does.
+  // Called by the ConstructSDandField() method of a DetectorConstruction.
+  static void SetSensitiveDetector(const G4String &name, G4VSensitiveDetector *sensitive_detector);
+
+  static void PrintSummary();
+
+  private:
+  struct Placement {
+    G4LogicalVolume *logical;
+    G4int depth;
+    G4int copy_number;
+  };
+
+  static G4int find_depth(G4LogicalVolume *mother_logical, G4LogicalVolume *logical);
+
+  static std::map<G4String, DetectorModel *> models;
+  static std::map<G4String, Placement> placements;
+  static G4ThreadLocal std::map<G4LogicalVolume *, CopyNumberSD *> *copy_number_sds;
+};
@@ -0,0 +1,90 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include <functional>
+#include <vector>
+
+using std::vector;
+
+// Buffer of momentum directions which are sampled in batches instead of one per event.
+// Fill() proposes a whole batch of candidate directions, evaluates the angular distribution for
+// all of them with a single call, and accepts each candidate with the probability W/envelope.
+// The accepted directions are converted to unit vectors in a separate loop over arrays.
+// All loops work on contiguous arrays without function calls via pointers, so that the compiler
+// can vectorize them. Pop() only returns the next buffered direction.
+class DirectionBatch {
+  public:
+  // Fills n uniform random numbers in [0, 1) into u
+  typedef std::function<void(unsigned int n, double *u)> UniformFunction;
+  // Proposes n candidate directions and the value of the envelope of W for each of them
+  typedef std::function<void(unsigned int n, double *theta, double *phi, double *envelope)> ProposalFunction;
+  // Evaluates w[i] = W(theta[i], phi[i]) for n directions
+  typedef std::function<void(const double *theta, const double *phi, double *w, unsigned int n)> EvaluationFunction;
+
+  DirectionBatch(unsigned int batch_size = 0);
+  ~DirectionBatch(){};
+
+  void SetSize(unsigned int batch_size);
+  unsigned int GetSize() const { return size; };
+
+  // Fill the buffer with GetSize() directions, using at most max_rounds batches of candidates.
+  // If evaluate is empty, all proposed candidates are accepted.
+  // Returns false if not a single direction was found.
+  bool Fill(const UniformFunction &uniform, const ProposalFunction &propose, const EvaluationFunction &evaluate, unsigned int max_rounds);
+  // Propose isotropic candidates, i.e. uniformly distributed cos(theta) and phi.
+  // The envelope is set to the constant value envelope_value.
+  static void ProposeIsotropic(const UniformFunction &uniform, unsigned int n, double *theta, double *phi, double *envelope, double envelope_value);
+
+  bool Empty() const { return next == n_directions; };
+  void Clear() { next = n_directions = 0; };
+  void Pop(double &x, double &y, double &z) {
+    x = direction_x[next];
+    y = direction_y[next];
+    z = direction_z[next];
+    ++next;
+  };
+
+  // Number of proposed and accepted candidates since the last call of SetSize()
+  unsigned long GetNProposed() const { return n_proposed; };
+  unsigned long GetNAccepted() const { return n_accepted; };
+
+  private:
+  unsigned int size;
+  unsigned int next;
+  unsigned int n_directions;
+
+  // Candidates
+  vector<double> theta;
+  vector<double> phi;
+  vector<double> envelope;
+  vector<double> w;
+  vector<double> u_w;
+
+  // Accepted directions
+  vector<double> accepted_theta;
+  vector<double> accepted_phi;
+  vector<double> direction_x;
+  vector<double> direction_y;
+  vector<double> direction_z;
+
+  unsigned long n_proposed;
+  unsigned long n_accepted;
+};
@@ -0,0 +1,43 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include "G4VPhysicsConstructor.hh"
+#include "globals.hh"
+
+// Minimal EM physics for photon beams and gamma-ray sources below about 20 MeV (PHYSICS_LEAN).
+// Only gamma, e- and e+ get physics processes, since no other particle is created by the
+// electromagnetic interactions of photons at these energies. The photons use the same models
+// as G4EmLivermorePolarizedPhysics, i.e. the polarized Livermore models for Compton and
+// Rayleigh scattering, the Livermore photoelectric effect and the 5D Bethe-Heitler pair
+// production. Electrons and positrons use the standard models for multiple scattering,
+// ionisation, bremsstrahlung and annihilation, and atomic deexcitation is active, so the
+// X-rays of the shielding are still produced.
+// Compared to the combination of a complete EM physics list with the hadronic physics lists,
+// no tables are built for the muons, hadrons and ions, and no process is attached to them,
+// which reduces the initialization time and the memory of each thread.
+class EmLeanPhysics : public G4VPhysicsConstructor {
+  public:
+  EmLeanPhysics(G4int ver = 1);
+  virtual ~EmLeanPhysics();
+
+  virtual void ConstructParticle();
+  virtual void ConstructProcess();
+};
@@ -0,0 +1,54 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include "G4EmStandardPhysics_option1.hh"
+#include "globals.hh"
+
+#include <vector>
+
+using std::vector;
+
+// Mixed EM physics: the fast G4EmStandardPhysics_option1 in the whole geometry, and the
+// polarized Livermore models of G4EmLivermorePolarizedPhysics for Compton scattering, Rayleigh
+// scattering and the photoelectric effect of photons in a list of regions (see utrRegions).
+// In the regions where the photons are expected to interact before they are detected, e.g.
+// the target and the detectors, the polarization and the low-energy cross sections are treated
+// as with EM_LIVERMORE_POLARIZED, while the bulk shielding uses the cheaper standard models.
+// The models are added with the G4EmConfigurator, which replaces the standard models in the
+// given regions when the physics tables are built at the beginning of the first run.
+class EmRegionalPhysics : public G4EmStandardPhysics_option1 {
+  public:
+  EmRegionalPhysics(G4int ver = 1);
+  virtual ~EmRegionalPhysics();
+
+  virtual void ConstructProcess();
+
+  // Regions which use the polarized Livermore models. Regions which are not created by utrRegions
+  // are created empty. The region 'DefaultRegionForTheWorld' selects the whole geometry.
+  static void SetPolarizedRegions(const vector<G4String> &regions) { polarized_regions = regions; };
+  static const vector<G4String> &GetPolarizedRegions() { return polarized_regions; };
+  // Warn about polarized regions without any volumes, in which the standard models are used.
+  // Called on the master thread by Physics::SetCuts(), after utrRegions::Setup().
+  static void CheckRegions();
+
+  private:
+  static vector<G4String> polarized_regions;
+};
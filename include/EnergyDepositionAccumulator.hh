@@ -0,0 +1,73 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "G4ThreeVector.hh"
+#include "globals.hh"
+
+using std::vector;
+
+// Per-event sums of the energy deposition in all EnergyDepositionSDs of a thread, together
+// with the properties of the first step in each detector. The data of all detectors are
+// stored as a struct of arrays, in which each EnergyDepositionSD owns one slot.
+//
+// Instead of clearing all slots at the beginning of each event, the slots are tagged with the
+// epoch, a number which is unique for each event of the thread (see GetEpoch()). A slot whose
+// epoch differs from the current one has not been hit in the current event, and it is reset
+// by the first step in the detector.
+class EnergyDepositionAccumulator {
+  public:
+  static EnergyDepositionAccumulator *Instance();
+
+  unsigned int AddSlot();
+  static uint64_t GetEpoch(G4int run_id, G4int event_id) { return ((uint64_t)(uint32_t)run_id << 32) | (uint32_t)event_id; };
+
+  G4bool IsHit(unsigned int slot, uint64_t epoch) const { return slot_epoch[slot] == epoch; };
+  void SetFirstHit(unsigned int slot, uint64_t epoch, G4double ekin, G4int particle, const G4ThreeVector &position, const G4ThreeVector &momentum) {
+    slot_epoch[slot] = epoch;
+    edep[slot] = 0.;
+    first_ekin[slot] = ekin;
+    first_particle[slot] = particle;
+    first_position[slot] = position;
+    first_momentum[slot] = momentum;
+  };
+  void AddEnergyDeposition(unsigned int slot, G4double e) { edep[slot] += e; };
+
+  G4double GetEnergyDeposition(unsigned int slot) const { return edep[slot]; };
+  G4double GetKineticEnergy(unsigned int slot) const { return first_ekin[slot]; };
+  G4int GetParticleType(unsigned int slot) const { return first_particle[slot]; };
+  const G4ThreeVector &GetPosition(unsigned int slot) const { return first_position[slot]; };
+  const G4ThreeVector &GetMomentum(unsigned int slot) const { return first_momentum[slot]; };
+
+  private:
+  EnergyDepositionAccumulator(){};
+
+  static G4ThreadLocal EnergyDepositionAccumulator *instance;
+
+  vector<uint64_t> slot_epoch;
+  vector<G4double> edep;
+  vector<G4double> first_ekin;
+  vector<G4int> first_particle;
+  vector<G4ThreeVector> first_position;
+  vector<G4ThreeVector> first_momentum;
+};
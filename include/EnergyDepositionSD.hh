@@ -27,6 +27,7 @@ along with utr.  If not, see <http://www.gnu.org/licenses/>.
 
 class G4Step;
 class G4HCofThisEvent;
+class EnergyDepositionAccumulator;
 
 class EnergyDepositionSD : public G4VSensitiveDetector {
   public:
@@ -40,10 +41,15 @@ class EnergyDepositionSD : public G4VSensitiveDetector {
   virtual void EndOfEvent(G4HCofThisEvent *hitCollection);
   unsigned int GetDetectorID() { return detectorID; };
   void SetDetectorID(unsigned int detID) { detectorID = detID; };
-  static std::vector<bool> anyDetectorHitInEvent; // Needed for EVENT_EVENTWISE mode, signals whether an entry (row) needs to be written to the root file for the current event (or whether the row would be zeroes only)
 
   private:
+  // Only used with the EDEP_HITS_COLLECTION build option, which stores every step as a TargetHit
   TargetHitsCollection *hitsCollection;
   G4int detectorID;
   G4int eventID;
+
+  // Energy deposition and first hit in the current event
+  EnergyDepositionAccumulator *accumulator;
+  unsigned int slot;
+  uint64_t epoch;
 };
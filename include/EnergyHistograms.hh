@@ -0,0 +1,85 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+using std::vector;
+
+// Histograms of the energy deposition in detectors 0 to n_detectors - 1 with 64-bit integer
+// bin contents. The binning is the same as in OutputProcessing/GetHistogram.cpp: the first
+// bin is centered around 0, and e_max is rounded up to a multiple of the bin width.
+// Bin 0 is the underflow bin, and bin GetNBins() + 1 the overflow bin, like in ROOT.
+//
+// Filling is not synchronized. Each thread fills its own instance, and the instances are
+// added up at the end of a run.
+class EnergyHistograms {
+  public:
+  EnergyHistograms() : n_detectors(0), n_bins(0), e_min(0.), e_max(0.), n_skipped(0){};
+  ~EnergyHistograms(){};
+
+  // Sets all bin contents to zero
+  void SetBinning(unsigned int n_det, double bin_width, double e_maximum);
+  unsigned int GetNDetectors() const { return n_detectors; };
+  unsigned int GetNBins() const { return n_bins; };
+  double GetEMin() const { return e_min; };
+  double GetEMax() const { return e_max; };
+  bool SameBinning(const EnergyHistograms &other) const {
+    return n_detectors == other.n_detectors && n_bins == other.n_bins && e_min == other.e_min && e_max == other.e_max;
+  };
+
+  // Same bin as TH1::FindBin()
+  unsigned int FindBin(double e) const {
+    if (e < e_min) {
+      return 0;
+    }
+    if (e >= e_max) {
+      return n_bins + 1;
+    }
+    return 1 + (unsigned int)(n_bins * (e - e_min) / (e_max - e_min));
+  };
+  // Energy depositions in detectors with IDs larger than GetNDetectors() - 1 are only counted
+  void Fill(int detector, double e) {
+    if (detector < 0 || (unsigned int)detector >= n_detectors) {
+      ++n_skipped;
+      return;
+    }
+    ++counts[(unsigned int)detector * (n_bins + 2) + FindBin(e)];
+  };
+
+  // Requires the same binning
+  void Add(const EnergyHistograms &other);
+  void Reset();
+
+  uint64_t GetCount(unsigned int detector, unsigned int bin) const { return counts[detector * (n_bins + 2) + bin]; };
+  // Sum of all detectors
+  uint64_t GetSumCount(unsigned int bin) const;
+  uint64_t GetNSkipped() const { return n_skipped; };
+
+  private:
+  unsigned int n_detectors;
+  unsigned int n_bins;
+  double e_min;
+  double e_max;
+
+  vector<uint64_t> counts;
+  uint64_t n_skipped;
+};
@@ -19,20 +19,39 @@ along with utr.  If not, see <http://www.gnu.org/licenses/>.
 */
 #pragma once
 
-#include <time.h>
+#include <vector>
 
 #include "G4UserEventAction.hh"
 #include "globals.hh"
 
+using std::vector;
+
 class EventAction : public G4UserEventAction {
   public:
   EventAction();
   virtual ~EventAction();
 
+  virtual void BeginOfEventAction(const G4Event *);
   virtual void EndOfEventAction(const G4Event *);
 
-  void setNThreads(const int nt) { n_threads = (G4double)nt; };
+  // EVENT_EVENTWISE mode: called by the EnergyDepositionSDs at the end of an event with their
+  // total energy deposition. A single row is written in EndOfEventAction() if any detector was hit.
+  void AddEventwiseEnergyDeposition(G4int detector, G4double edep) {
+    if (detector < 0 || detector >= (G4int)eventwise_edep.size()) {
+      skipped_eventwise_detector = detector;
+      return;
+    }
+    if (eventwise_edep[detector] == 0.) {
+      eventwise_hit_detectors.push_back(detector);
+    }
+    eventwise_edep[detector] += edep;
+  };
 
   private:
-  G4int n_threads;
+  // Energy deposition in detectors 0 to Max_Sensitive_Detector_ID in the current event, and
+  // the IDs of the detectors with a nonzero energy deposition, so that only those entries
+  // need to be reset
+  vector<G4double> eventwise_edep;
+  vector<G4int> eventwise_hit_detectors;
+  G4int skipped_eventwise_detector;
 };
@@ -0,0 +1,124 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+#include "G4Event.hh"
+#include "G4ThreeVector.hh"
+#include "globals.hh"
+
+using std::vector;
+
+// Wall time of the events, and capture and replay of slow events.
+//
+// The time between BeginOfEventAction and EndOfEventAction of each event is filled into a
+// histogram with logarithmic bins (/utr/eventTiming/histogram), which is merged from all
+// threads and printed at the end of the run. Events which take longer than a threshold
+// (/utr/eventTiming/slowThreshold) are captured with the state of the random number engine at
+// the beginning of the event, after the primaries were generated, and with their primary
+// particles. The master thread writes the slowest events to '<prefix><ID>_slow_events.txt'.
+//
+// /utr/replayEvent FILE EVENT simulates captured events again, with verbose tracking. The
+// generators call Replay() at the beginning of GeneratePrimaries(), which replaces the primaries
+// by the captured ones and restores the state of the engine. Therefore, the replay does not
+// depend on the state of the generator, for example on the buffers of the batched sampling.
+// It has to be run with the same geometry, physics and macro settings as the original run.
+class EventTimer {
+  public:
+  static void SetHistogram(G4bool h) { histogram = h; };
+  static G4bool GetHistogram() { return histogram; };
+  // Events which take longer than the threshold are captured, 0 to disable the capture
+  static void SetSlowThreshold(G4double t) { slow_threshold = t; };
+  static G4double GetSlowThreshold() { return slow_threshold; };
+  // Maximum number of captured events per run, the slowest events are kept
+  static void SetMaxSlowEvents(G4int n) { max_slow_events = n; };
+  static G4int GetMaxSlowEvents() { return max_slow_events; };
+
+  static void BeginOfEvent(const G4Event *event);
+  static void EndOfEvent(const G4Event *event);
+  // The worker threads add their histograms and slow events to the total in their EndOfRunAction,
+  // which is printed and written by the master thread after the workers have finished.
+  static void MergeStatistics();
+  static void PrintStatistics();
+
+  // Queue the events of a file written at the end of a run for a replay. EVENT is an event ID or
+  // 'all'. Returns the number of queued events.
+  static G4int LoadReplay(const G4String &filename, const G4String &event);
+  static void SetReplaying(G4bool r) { replaying = r; };
+  // Called at the beginning of GeneratePrimaries(). If an event is queued for a replay, the
+  // captured primaries are added to the event, the state of the engine is restored, and true is
+  // returned. In this case, the generator must not generate any primaries.
+  static G4bool Replay(G4Event *event);
+
+  private:
+  struct Primary {
+    G4String particle;
+    G4int encoding;
+    G4ThreeVector position;
+    G4double time;
+    G4double kinetic_energy;
+    G4ThreeVector direction;
+    G4ThreeVector polarization;
+    G4double charge;
+    G4double weight;
+  };
+  struct SlowEvent {
+    G4int run;
+    G4int event;
+    G4int thread;
+    G4double seconds;
+    G4String engine;
+    vector<unsigned long> engine_state;
+    vector<Primary> primaries;
+  };
+  struct ThreadTimer {
+    std::chrono::steady_clock::time_point start_time;
+    vector<unsigned long> n_events;
+    vector<G4double> seconds;
+    G4double max_seconds;
+    SlowEvent current;
+    vector<SlowEvent> slow_events;
+  };
+
+  static unsigned int bin(G4double seconds);
+  static void keep_slowest(vector<SlowEvent> &slow_events, const SlowEvent &slow_event);
+  static void write_slow_events();
+
+  static G4bool histogram;
+  static G4double slow_threshold;
+  static G4int max_slow_events;
+  static std::atomic<G4bool> replaying;
+
+  static G4ThreadLocal ThreadTimer *timer;
+
+  static vector<unsigned long> total_events;
+  static vector<G4double> total_seconds;
+  static G4double total_max_seconds;
+  static vector<SlowEvent> total_slow_events;
+  static std::mutex statistics_mutex;
+
+  static std::deque<SlowEvent> replay_queue;
+  static std::mutex replay_mutex;
+};
@@ -0,0 +1,60 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include "globals.hh"
+
+// Level of detail of distant support structures (wheel, tables, ...)
+// FULL_DETAIL: all parts are constructed as they are
+// HOMOGENIZED_DETAIL: the parts of a structure are replaced by a single volume, which is filled
+//                     with a mixture of their materials with the same total mass (see BrickEnvelope)
+enum detail_level { FULL_DETAIL,
+                    HOMOGENIZED_DETAIL };
+
+// Options for the construction of the geometry, which have to be set before /run/initialize.
+// The defaults are given by the CMake options GEOMETRY_DETAIL, USE_G3_SETUP and USE_SECOND_SETUP.
+//
+// The g3 setup consists of the detectors and the target at the g3 target position and the wheel,
+// the second setup of the detectors and the target at the second target position and table 2.
+// If only one target position is studied, the other setup can be left out. Beam pipes, walls and
+// the zero-degree detector are always constructed. The DetectorConstructions which support this
+// are listed in README.md. They announce it with SetSetupSwitchesSupported(true) in their
+// constructor, so that the commands which change the switches can warn in all other geometries.
+class GeometryDetail {
+  public:
+  static void SetLevel(detail_level lvl) { level = lvl; };
+  static detail_level GetLevel() { return level; };
+  // Accepts the names 'full' and 'homogenized'. Returns false for an unknown name.
+  static G4bool SetLevel(const G4String &level_name);
+  static G4String GetLevelName(detail_level lvl);
+
+  static void SetG3Setup(G4bool use) { g3_setup = use; };
+  static G4bool GetG3Setup() { return g3_setup; };
+  static void SetSecondSetup(G4bool use) { second_setup = use; };
+  static G4bool GetSecondSetup() { return second_setup; };
+  static void SetSetupSwitchesSupported(G4bool supported) { setup_switches_supported = supported; };
+  static G4bool GetSetupSwitchesSupported() { return setup_switches_supported; };
+
+  private:
+  static detail_level level;
+  static G4bool g3_setup;
+  static G4bool second_setup;
+  static G4bool setup_switches_supported;
+};
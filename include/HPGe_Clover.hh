@@ -42,5 +42,7 @@ class HPGe_Clover : public Detector {
   private:
   HPGe_Clover_Properties properties;
   bool use_dewar;
+  // Key of the shared model (see Detector::useModelCache())
+  G4String model_key() const;
   G4VSolid *rounded_box(const G4String name, const G4double side_length, const G4double length, const G4double rounding_radius, const G4int n_points_per_corner) const;
 };
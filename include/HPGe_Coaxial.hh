@@ -25,15 +25,17 @@ along with utr.  If not, see <http://www.gnu.org/licenses/>.
 #include <vector>
 
 #include "G4LogicalVolume.hh"
+#include "G4SystemOfUnits.hh"
 
 #include "Detector.hh"
 #include "HPGe_Coaxial_Properties.hh"
+#include "PolyconeProfile.hh"
 
 using std::vector;
 
 class HPGe_Coaxial : public Detector {
   public:
-  HPGe_Coaxial(G4LogicalVolume *World_Logical, G4String name) : Detector(World_Logical, name), use_filter_case(false), use_filter_case_ring(false), use_dewar(false){};
+  HPGe_Coaxial(G4LogicalVolume *World_Logical, G4String name) : Detector(World_Logical, name), use_filter_case(false), use_filter_case_ring(false), use_dewar(false), max_profile_deviation(10. * um){};
   ~HPGe_Coaxial(){};
 
   void Construct(G4ThreeVector global_coordinates, G4double theta, G4double phi,
@@ -45,10 +47,20 @@ class HPGe_Coaxial : public Detector {
   void useFilterCase() { use_filter_case = true; };
   void useFilterCaseRing() { use_filter_case_ring = true; };
   void useDewar() { use_dewar = true; };
+  // Maximum radial deviation of the polycones of the crystal and the cold finger from their
+  // rounded shapes. The number of z-planes is chosen adaptively (see PolyconeProfile).
+  void setMaxProfileDeviation(G4double max_deviation) { max_profile_deviation = max_deviation; };
+
+  // Profiles of the polycones, which are public for benchmarks
+  static PolyconeProfile CrystalProfile(const HPGe_Coaxial_Properties &properties, G4double max_deviation);
+  static PolyconeProfile ColdFingerProfile(const HPGe_Coaxial_Properties &properties, G4double cold_finger_length, G4double max_deviation);
 
   private:
   HPGe_Coaxial_Properties properties;
   bool use_filter_case;
   bool use_filter_case_ring;
   bool use_dewar;
+  G4double max_profile_deviation;
+  // Key of the shared model (see Detector::useModelCache())
+  G4String model_key(G4double filter_position_z) const;
 };
@@ -50,4 +50,6 @@ class LaBr_3x3 : public Detector {
   bool use_filter_case;
   bool use_filter_case_ring;
   bool use_housing;
+  // Key of the shared model (see Detector::useModelCache())
+  G4String model_key(G4double filter_position_z) const;
 };
@@ -0,0 +1,32 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+// Measures the speed of the navigation in the geometry, independent of the physics:
+// A number of random points in the bounding box of the world volume is located with
+// G4Navigator::LocateGlobalPointAndSetup(), and geantinos are transported from the same points
+// in random directions until they leave the world volume.
+// The points and directions are the same in each call, so that different geometries, for example
+// with and without brick envelopes (see BrickEnvelope.hh), can be compared.
+class NavigationBenchmark {
+  public:
+  // Can only be used after the geometry has been initialized
+  static void Run(unsigned int n_points);
+};
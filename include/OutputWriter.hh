@@ -0,0 +1,120 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include "G4ThreeVector.hh"
+#include "globals.hh"
+
+#include <mutex>
+#include <vector>
+
+#include "ColumnarWriter.hh"
+#include "EnergyHistograms.hh"
+
+using std::vector;
+
+enum output_format : short {
+  ROOT_FORMAT = 0,
+  COLUMNAR_FORMAT = 1,
+  HISTOGRAM_FORMAT = 2
+};
+
+// Quantities of a single hit, i.e. a row of the output n-tuple.
+// Which of them are written is determined by the EVENT_* build options.
+struct OutputRow {
+  G4int event;
+  G4double edep;
+  G4double ekin;
+  G4int particle;
+  G4int volume;
+  G4ThreeVector position;
+  G4ThreeVector momentum;
+};
+
+// Writes the output n-tuple of a thread in the format which was selected with
+// /utr/output/format:
+//
+// root:     an n-tuple of double values via the G4RootAnalysisManager
+// columnar: a binary file with typed columns (see ColumnarWriter), i.e. 64-bit integers for the
+//           event number, 32-bit integers for the particle type and volume, and 32-bit
+//           floating-point numbers for all other quantities
+// histogram: no n-tuple at all. The energy depositions are sorted into one histogram per
+//           detector (see EnergyHistograms) in each thread. At the end of the run, the worker
+//           threads add their histograms to a shared one, which the master thread writes to a
+//           ROOT file with the same histograms as the output of getHistogram.
+//
+// Each thread has its own instance. The format is fixed at the beginning of each run by
+// CreateColumns(), so that it can be changed between runs.
+class OutputWriter {
+  public:
+  static OutputWriter *Instance();
+
+  static void SetFormat(output_format fmt) { format = fmt; };
+  static output_format GetFormat() { return format; };
+  // Accepts the names 'root', 'columnar' and 'histogram'. Returns false for an unknown name.
+  static G4bool SetFormat(const G4String &format_name);
+  static G4String GetFormatName(output_format fmt);
+  // Extension of the output files in the given format, including the dot
+  static G4String GetFileExtension(output_format fmt);
+
+  // Binning of the histogram format, see EnergyHistograms
+  static void SetHistogramBinWidth(G4double bin_width) { histogram_bin_width = bin_width; };
+  static G4double GetHistogramBinWidth() { return histogram_bin_width; };
+  static void SetHistogramEMax(G4double e_max) { histogram_e_max = e_max; };
+  static G4double GetHistogramEMax() { return histogram_e_max; };
+  // A negative max_id selects the highest ID of the sensitive detectors in the DetectorConstruction
+  static void SetHistogramMaxID(G4int max_id) { histogram_max_id = max_id; };
+  static G4int GetHistogramMaxID() { return histogram_max_id; };
+
+  void CreateColumns();
+  // For the root format, Geant4 appends the thread ID to the filename of the worker threads,
+  // while the columnar format uses the filename as it is.
+  // For the histogram format, only the master thread has a file, which is written in CloseFile().
+  void OpenFile(const G4String &filename);
+  void CloseFile();
+
+  void AddRow(const OutputRow &row);
+  // EVENT_EVENTWISE mode: write the total energy depositions in all detectors in an event,
+  // edep is indexed by the detector ID, and hit_detectors lists the detectors with edep > 0.
+  // With EVENT_EVENTWISE_SPARSE, one (event, volume, edep) row per hit detector is written instead.
+  void AddEventwiseRow(G4int event, const vector<G4double> &edep, const vector<G4int> &hit_detectors);
+
+  private:
+  OutputWriter();
+
+  template <typename T>
+  void fill(unsigned int column, T value);
+  void write_histograms();
+
+  static output_format format;
+  static G4ThreadLocal OutputWriter *instance;
+
+  static G4double histogram_bin_width;
+  static G4double histogram_e_max;
+  static G4int histogram_max_id;
+  // Sum of the histograms of all worker threads
+  static EnergyHistograms merged_histograms;
+  static std::mutex merged_histograms_mutex;
+
+  output_format run_format;
+  ColumnarWriter columnar_writer;
+  EnergyHistograms histograms;
+  G4String histogram_filename;
+};
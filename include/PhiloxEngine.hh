@@ -0,0 +1,74 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "CLHEP/Random/RandomEngine.h"
+
+// Counter-based random number engine Philox4x32-10 (Salmon et al., "Parallel random numbers:
+// as easy as 1, 2, 3", SC11). The n-th block of four 32 bit random numbers is a bijective
+// function of the counter n, keyed with the 64 bit seed. Streams with different keys do not
+// overlap by construction, and there is no state besides the key and the counter.
+//
+// Each call of flat() uses two 32 bit numbers to give a double with 53 random bits in (0, 1).
+// setSeeds() uses the first two seeds as the key and resets the counter, so that every event,
+// which Geant4 or utrRandom seeds individually, gets its own stream.
+class PhiloxEngine : public CLHEP::HepRandomEngine {
+  public:
+  PhiloxEngine();
+  explicit PhiloxEngine(long seed);
+  virtual ~PhiloxEngine(){};
+
+  double flat() override;
+  void flatArray(const int size, double *vect) override;
+
+  void setSeed(long seed, int dummy = 0) override;
+  void setSeeds(const long *seeds, int dummy = 0) override;
+
+  void saveStatus(const char filename[] = "Philox.conf") const override;
+  void restoreStatus(const char filename[] = "Philox.conf") override;
+  void showStatus() const override;
+
+  std::string name() const override { return engineName(); };
+  static std::string engineName() { return "PhiloxEngine"; };
+  static std::string beginTag() { return "PhiloxEngine-begin"; };
+
+  std::ostream &put(std::ostream &os) const override;
+  std::istream &get(std::istream &is) override;
+  std::istream &getState(std::istream &is) override;
+  std::vector<unsigned long> put() const override;
+  bool get(const std::vector<unsigned long> &v) override;
+  bool getState(const std::vector<unsigned long> &v) override;
+
+  // Philox4x32-10 block function, exposed for the known-answer tests
+  static void Block(const uint32_t counter[4], const uint32_t key[2], uint32_t result[4]);
+
+  private:
+  void next_block();
+
+  uint32_t key[2];
+  uint32_t counter[4];
+  uint32_t block[4];
+  unsigned int position; // Next unused number in block
+};
@@ -27,4 +27,7 @@ class Physics : public G4VModularPhysicsList {
 
   public:
   Physics();
+
+  // Called after the geometry has been constructed, sets up the regions of utrRegions and the PhysicsTableCache
+  virtual void SetCuts();
 };
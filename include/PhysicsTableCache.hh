@@ -0,0 +1,67 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include "G4VModularPhysicsList.hh"
+#include "globals.hh"
+
+#include <chrono>
+
+// Cache of the physics tables, which are otherwise rebuilt at every start of utr.
+// After the first initialization, the master thread stores the tables in a subdirectory of the
+// cache directory (default: $XDG_CACHE_HOME/utr or ~/.cache/utr), whose name is a hash of
+// everything the tables depend on: the Geant4 version and data, the registered physics
+// constructors, the EM parameters, the production cuts of all regions and the definitions of
+// all materials, including the isotopic compositions. Later starts with the same key retrieve
+// the tables with the mechanism of G4VUserPhysicsList::SetPhysicsTableRetrieved().
+// Geant4 checks the retrieved production cuts against the current geometry itself, and builds
+// the tables from scratch if they are inconsistent, in which case the cache entry is renewed.
+// Only tables of processes which support StorePhysicsTable(), i.e. mainly the EM processes, are cached.
+class PhysicsTableCache {
+  public:
+  static void SetEnabled(G4bool e) { enabled = e; };
+  static G4bool GetEnabled() { return enabled; };
+  static void SetDirectory(const G4String &d) { directory = d; };
+  static G4String GetDirectory();
+
+  // Determine the key and request the retrieval of the tables if they are in the cache.
+  // Called on the master thread by Physics::SetCuts(), i.e. at /run/initialize, after the
+  // geometry, the materials and the regions have been set up.
+  static void Prepare(G4VUserPhysicsList *physics_list);
+  // Store the tables after they have been built, and print the startup time together with the
+  // status of the cache. Called on the master thread at the beginning of each run, does
+  // nothing after the first call.
+  static void BeginOfRun();
+
+  private:
+  static G4String get_key_description(const G4VUserPhysicsList *physics_list);
+  static G4String hash(const G4String &text);
+  static void store();
+
+  static G4bool enabled;
+  static G4String directory;
+
+  static G4VUserPhysicsList *cached_physics_list;
+  static G4String key;
+  static G4String key_description;
+  static G4bool hit;
+  static G4bool done;
+  static std::chrono::steady_clock::time_point start_time;
+};
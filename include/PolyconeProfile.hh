@@ -0,0 +1,69 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include <functional>
+#include <vector>
+
+using std::vector;
+
+// Builds the z-planes of a G4Polycone from the inner and outer radius of a rotationally symmetric
+// body as a function of z. Instead of sampling the profile on a uniform grid, the planes are
+// placed adaptively: starting at a plane, the next plane is placed as far away as possible, as long
+// as the linear interpolation between both deviates from the true radii by at most max_deviation.
+// Cylindrical parts therefore need no planes in between, and curved parts only as many as their
+// curvature requires.
+//
+// The deviation is measured radially at a fixed z, which is an upper bound for the geometric
+// distance between the polycone and the true surface. The profile must be continuous, and planes
+// are always placed at the breakpoints, which should include all points where the derivative of
+// the profile is not continuous (for example, where a rounded face meets a cylinder).
+class PolyconeProfile {
+  public:
+  PolyconeProfile(const std::function<double(double)> &r_inner, const std::function<double(double)> &r_outer);
+  ~PolyconeProfile(){};
+
+  // Sample the profile from breakpoints.front() to breakpoints.back(). The breakpoints may be
+  // given in ascending or descending order, which is also the order of the planes.
+  void Build(const vector<double> &breakpoints, double max_deviation);
+
+  unsigned int GetNPlanes() const { return (unsigned int)z_planes.size(); };
+  const double *GetZPlanes() const { return z_planes.data(); };
+  const double *GetRInner() const { return r_inner_planes.data(); };
+  const double *GetROuter() const { return r_outer_planes.data(); };
+  // Radii of the true profile
+  double RInner(double z) const { return r_inner(z); };
+  double ROuter(double z) const { return r_outer(z); };
+  // Largest radial deviation between the planes which was observed during Build()
+  double GetMaxDeviation() const { return max_observed_deviation; };
+
+  private:
+  // Largest deviation of the linear interpolation between z_1 and z_2 from the profile
+  double deviation(double z_1, double z_2) const;
+  void add_plane(double z);
+
+  std::function<double(double)> r_inner;
+  std::function<double(double)> r_outer;
+
+  vector<double> z_planes;
+  vector<double> r_inner_planes;
+  vector<double> r_outer_planes;
+  double max_observed_deviation;
+};
@@ -0,0 +1,85 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "globals.hh"
+
+using std::vector;
+
+// Progress and throughput reports of a run.
+//
+// Each thread counts its processed events in its own atomic counter, which is aligned to a cache
+// line so that the threads do not compete for it. A single reporter thread, which is started by
+// the master thread at the beginning of a run, sums the counters every /utr/progress/interval
+// seconds and prints the global progress, the event rate of all threads and of each thread, the
+// estimated remaining time and the resident memory of the process. Optionally, the same figures
+// are appended as JSON lines to '<prefix><ID>_progress.jsonl' in the output directory.
+class ProgressMonitor {
+  public:
+  static void SetInterval(G4double seconds) { interval = seconds; };
+  static G4double GetInterval() { return interval; };
+  static void SetJson(G4bool j) { json = j; };
+  static G4bool GetJson() { return json; };
+
+  // Called by the master thread before the worker threads start, and after they have finished
+  static void BeginOfRun(G4int run_id, G4long n_events, G4int n_threads);
+  static void EndOfRun();
+  // Called by the thread which processed an event at its end
+  static void CountEvent();
+
+  // Resident set size of the process in bytes, or 0 if it is not available
+  static size_t GetResidentMemory();
+
+  private:
+  struct alignas(64) Counter {
+    std::atomic<G4long> events;
+  };
+
+  static void run_reporter();
+  static void report(G4bool final);
+
+  static G4double interval;
+  static G4bool json;
+
+  static std::unique_ptr<Counter[]> counters;
+  static G4int n_counters;
+  static G4int run;
+  static G4long n_events_to_process;
+
+  static std::thread reporter;
+  static std::mutex reporter_mutex;
+  static std::condition_variable reporter_condition;
+  static G4bool stop_reporter;
+
+  // State of the reporter thread
+  static std::chrono::steady_clock::time_point start_time;
+  static std::chrono::steady_clock::time_point last_time;
+  static vector<G4long> last_events;
+  static std::ofstream json_file;
+};
@@ -22,6 +22,7 @@ along with utr.  If not, see <http://www.gnu.org/licenses/>.
 #include "G4UserRunAction.hh"
 #include "globals.hh"
 
+#include <functional>
 #include <string>
 
 using std::string;
@@ -50,4 +51,11 @@ class RunAction : public G4UserRunAction {
   virtual void EndOfRunAction(const G4Run *);
 
   G4String GetOutputFlagName(unsigned int n);
+
+  // Function which is called on the master thread at the beginning of each run,
+  // before the worker threads start to process events
+  void SetPreRunValidation(std::function<void()> validation) { pre_run_validation = validation; };
+
+  private:
+  std::function<void()> pre_run_validation;
 };
@@ -0,0 +1,74 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include "G4UserStackingAction.hh"
+#include "globals.hh"
+
+#include <mutex>
+
+#include "DetectorAcceptance.hh"
+
+// Optional culling of secondary photons which cannot contribute to the signal of any detector.
+// A secondary photon is killed when it is created if its energy is below a threshold and if
+// its straight path from the point of creation does not intersect the sphere around any
+// sensitive volume (see DetectorAcceptance). Photons above the threshold are always tracked,
+// because they may still reach a detector after a scattering. The threshold should be
+// chosen such that scattered photons would be absorbed in the shielding anyway.
+// The number and energy of the killed photons are reported at the end of each run, so the
+// effect of the culling can be checked by comparing them to a run without culling.
+class StackingAction : public G4UserStackingAction {
+  public:
+  StackingAction();
+  virtual ~StackingAction();
+
+  virtual G4ClassificationOfNewTrack ClassifyNewTrack(const G4Track *track);
+  virtual void PrepareNewEvent();
+
+  static void SetCulling(G4bool c) { culling = c; };
+  static G4bool GetCulling() { return culling; };
+  static void SetCullingEnergy(G4double e) { culling_energy = e; };
+  static G4double GetCullingEnergy() { return culling_energy; };
+  static void SetCullingMargin(G4double m) { culling_margin = m; };
+  static G4double GetCullingMargin() { return culling_margin; };
+
+  // The worker threads add their statistics to the total in their EndOfRunAction,
+  // which is printed and reset by the master thread after the workers have finished.
+  static void MergeStatistics();
+  static void PrintStatistics();
+
+  private:
+  static G4bool culling;
+  static G4double culling_energy;
+  static G4double culling_margin;
+
+  static G4ThreadLocal unsigned long n_examined;
+  static G4ThreadLocal unsigned long n_killed;
+  static G4ThreadLocal G4double killed_energy;
+
+  static unsigned long total_examined;
+  static unsigned long total_killed;
+  static G4double total_killed_energy;
+  static size_t n_detectors;
+  static std::mutex statistics_mutex;
+
+  DetectorAcceptance acceptance;
+  G4int acceptance_run_ID;
+};
@@ -0,0 +1,87 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include "G4UserSteppingAction.hh"
+#include "globals.hh"
+
+#include <chrono>
+#include <cfloat>
+#include <mutex>
+
+#include "DetectorAcceptance.hh"
+
+// Optional range rejection of electrons (and positrons) outside of the sensitive volumes.
+// After each step of an electron in a non-sensitive volume, its range in the current material
+// (G4LossTableManager::GetRange(), from the restricted stopping power, which is at least the
+// CSDA range) is compared to the distance to the spheres around the sensitive volumes
+// (see DetectorAcceptance). If the electron cannot reach any detector, it is killed, and its
+// kinetic energy is counted as deposited at its current position, outside of any detector.
+// Electrons above a maximum energy are not killed, to preserve their bremsstrahlung photons.
+class SteppingAction : public G4UserSteppingAction {
+  public:
+  SteppingAction();
+  virtual ~SteppingAction();
+
+  virtual void UserSteppingAction(const G4Step *step);
+
+  static void SetRangeRejection(G4bool r) { range_rejection = r; };
+  static G4bool GetRangeRejection() { return range_rejection; };
+  static void SetRangeRejectionMaxEnergy(G4double e) { max_energy = e; };
+  static G4double GetRangeRejectionMaxEnergy() { return max_energy; };
+  static void SetRangeRejectionPositrons(G4bool p) { reject_positrons = p; };
+  static G4bool GetRangeRejectionPositrons() { return reject_positrons; };
+
+  // The worker threads add their statistics to the total in their EndOfRunAction,
+  // which is printed and reset by the master thread after the workers have finished.
+  static void MergeStatistics();
+  static void PrintStatistics();
+
+  private:
+  static G4bool range_rejection;
+  static G4double max_energy;
+  static G4bool reject_positrons;
+
+  // Statistics of the current run of this thread. The saved CPU time is estimated from the
+  // number of steps the killed particles would still have needed, i.e. their range divided by
+  // the mean step length of electrons and positrons, and the mean time per step.
+  static G4ThreadLocal unsigned long n_steps;
+  static G4ThreadLocal unsigned long n_electron_steps;
+  static G4ThreadLocal G4double electron_step_length;
+  static G4ThreadLocal unsigned long n_rejected;
+  static G4ThreadLocal G4double rejected_energy;
+  static G4ThreadLocal G4double rejected_range;
+  // Time of the first step of this thread in the run, in seconds of std::chrono::steady_clock.
+  // A plain value, since G4ThreadLocal variables can not have a constructor.
+  static G4ThreadLocal G4double start_time;
+  static G4double now() { return std::chrono::duration<G4double>(std::chrono::steady_clock::now().time_since_epoch()).count(); };
+
+  static unsigned long total_steps;
+  static unsigned long total_electron_steps;
+  static G4double total_electron_step_length;
+  static unsigned long total_rejected;
+  static G4double total_rejected_energy;
+  static G4double total_rejected_range;
+  static G4double total_seconds;
+  static size_t n_detectors;
+  static std::mutex statistics_mutex;
+
+  DetectorAcceptance acceptance;
+};
@@ -0,0 +1,96 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <unordered_map>
+
+#include "G4LogicalVolume.hh"
+#include "G4Material.hh"
+#include "G4ParticleDefinition.hh"
+#include "G4Step.hh"
+#include "G4VProcess.hh"
+#include "globals.hh"
+
+// Optional profile of the steps of a run (/utr/profile/enable).
+//
+// Each thread counts the steps and the wall time between two calls of the SteppingAction for each
+// combination of logical volume, material and particle before the step, and the process which
+// limited the step. The time of a step is the time since the previous step of the thread, or since
+// the beginning of the event for the first step, so it includes the tracking and stacking of the
+// new track. The counts are kept in a hash table of the thread, which needs no locks, and are
+// added to the total in the EndOfRunAction. The master thread prints the steps and the time by
+// logical volume, material, particle and process, and the combinations with the most steps.
+//
+// When the profiler is disabled, the only overhead is the check of a static flag in the
+// SteppingAction and the EventAction.
+class SteppingProfiler {
+  public:
+  static void SetEnabled(G4bool e) { enabled = e; };
+  static G4bool GetEnabled() { return enabled; };
+  // Number of entries of each table in the report
+  static void SetNRows(G4int n) { n_rows = n; };
+  static G4int GetNRows() { return n_rows; };
+
+  static void BeginOfEvent();
+  static void CountStep(const G4Step *step);
+  // The worker threads add their counts to the total in their EndOfRunAction,
+  // which is printed and reset by the master thread after the workers have finished.
+  static void MergeStatistics();
+  static void PrintStatistics();
+
+  private:
+  struct Key {
+    const G4LogicalVolume *volume;
+    const G4Material *material;
+    const G4ParticleDefinition *particle;
+    const G4VProcess *process;
+
+    bool operator==(const Key &other) const { return volume == other.volume && material == other.material && particle == other.particle && process == other.process; };
+  };
+  struct KeyHash {
+    size_t operator()(const Key &key) const {
+      size_t hash = std::hash<const void *>()(key.volume);
+      hash = hash * 31 + std::hash<const void *>()(key.material);
+      hash = hash * 31 + std::hash<const void *>()(key.particle);
+      return hash * 31 + std::hash<const void *>()(key.process);
+    };
+  };
+  struct Counts {
+    unsigned long steps;
+    G4double seconds;
+  };
+  struct ThreadProfile {
+    std::unordered_map<Key, Counts, KeyHash> counts;
+    std::chrono::steady_clock::time_point last_time;
+  };
+
+  static G4bool enabled;
+  static G4int n_rows;
+
+  static G4ThreadLocal ThreadProfile *profile;
+
+  // The processes are objects of each thread, so they are merged by their name
+  static std::map<std::tuple<const G4LogicalVolume *, const G4Material *, const G4ParticleDefinition *, G4String>, Counts> total;
+  static std::mutex statistics_mutex;
+};
@@ -40,6 +40,10 @@ class utrFilenameTools {
   static void setUseFilenameID(unsigned int ufid) { useFilenameID = ufid; };
   static bool getUseFilenameID() { return useFilenameID; };
   static unsigned int findNextFreeFilenameID();
+  // Name of the output files of the current run without the thread ID and the extension:
+  // '{filenamePrefix}{filenameID}' followed by the shard tag of utrRandom, if any
+  static string getRunName();
+  static string getRunFilename() { return outputDir + "/" + getRunName(); };
   static string getMasterFilename();
   static void deleteMasterFilename();
 
@@ -20,6 +20,8 @@ along with utr.  If not, see <http://www.gnu.org/licenses/>.
 #pragma once
 
 #include "G4UIcmdWithABool.hh"
+#include "G4UIcmdWithADoubleAndUnit.hh"
+#include "G4UIcmdWithAnInteger.hh"
 #include "G4UIcmdWithAString.hh"
 #include "G4UIcommand.hh"
 #include "G4UIdirectory.hh"
@@ -42,4 +44,58 @@ class utrMessenger : public G4UImessenger {
   G4UIcmdWithAString *setFilenameCmd;
   G4UIcmdWithABool *setUseFilenameIDCmd;
   G4UIcmdWithAString *appendZerosToVarCmd;
+
+  G4UIdirectory *outputDirectory;
+  G4UIcmdWithAString *outputFormatCmd;
+
+  G4UIdirectory *histogramDirectory;
+  G4UIcmdWithADoubleAndUnit *histogramBinWidthCmd;
+  G4UIcmdWithADoubleAndUnit *histogramEMaxCmd;
+  G4UIcmdWithAnInteger *histogramMaxIDCmd;
+
+  G4UIdirectory *cullingDirectory;
+  G4UIcmdWithABool *cullingEnableCmd;
+  G4UIcmdWithADoubleAndUnit *cullingEnergyCmd;
+  G4UIcmdWithADoubleAndUnit *cullingMarginCmd;
+
+  G4UIdirectory *rangeRejectionDirectory;
+  G4UIcmdWithABool *rangeRejectionEnableCmd;
+  G4UIcmdWithADoubleAndUnit *rangeRejectionMaxEnergyCmd;
+  G4UIcmdWithABool *rangeRejectionPositronsCmd;
+
+  G4UIdirectory *regionDirectory;
+  G4UIcmdWithAString *regionAddVolumesCmd;
+  G4UIcmdWithAString *regionAddMaterialCmd;
+  G4UIcmdWithAString *regionSetCutCmd;
+  G4UIcmdWithABool *regionDetectorsCmd;
+  G4UIcmdWithABool *regionStatisticsCmd;
+
+  G4UIdirectory *physicsDirectory;
+  G4UIcmdWithAString *polarizedRegionsCmd;
+  G4UIcmdWithABool *tableCacheCmd;
+  G4UIcmdWithAString *tableCacheDirectoryCmd;
+
+  G4UIdirectory *geometryDirectory;
+  G4UIcmdWithABool *brickEnvelopesCmd;
+  G4UIcmdWithAString *detailCmd;
+  G4UIcmdWithABool *g3SetupCmd;
+  G4UIcmdWithABool *secondSetupCmd;
+  G4UIcmdWithAnInteger *navigationBenchmarkCmd;
+
+  G4UIdirectory *randomDirectory;
+  G4UIcmdWithAString *randomEngineCmd;
+
+  G4UIdirectory *progressDirectory;
+  G4UIcmdWithADoubleAndUnit *progressIntervalCmd;
+  G4UIcmdWithABool *progressJsonCmd;
+
+  G4UIdirectory *profileDirectory;
+  G4UIcmdWithABool *profileEnableCmd;
+  G4UIcmdWithAnInteger *profileRowsCmd;
+
+  G4UIdirectory *eventTimingDirectory;
+  G4UIcmdWithABool *eventTimingHistogramCmd;
+  G4UIcmdWithADoubleAndUnit *eventTimingSlowThresholdCmd;
+  G4UIcmdWithAnInteger *eventTimingMaxSlowEventsCmd;
+  G4UIcmdWithAString *replayEventCmd;
 };
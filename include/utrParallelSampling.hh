@@ -0,0 +1,36 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include "CLHEP/Random/RandomEngine.h"
+#include "G4Types.hh"
+
+#include <functional>
+
+// Distributes the Monte-Carlo samples of a self-check over several threads.
+// Each thread gets its own random number engine, which is seeded with random numbers
+// from the engine of the calling thread. This way, the result is reproducible for a
+// given seed and number of threads.
+class utrParallelSampling {
+  public:
+  // Call sample(n_thread, n_samples_of_thread, engine) once in each of n_threads threads.
+  // The numbers of samples of all threads add up to n_samples.
+  static void run(G4int n_threads, G4long n_samples, const std::function<void(G4int, G4long, CLHEP::HepRandomEngine *)> &sample);
+};
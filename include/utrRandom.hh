@@ -0,0 +1,100 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include "CLHEP/Random/RandomEngine.h"
+#include "G4Event.hh"
+#include "G4Run.hh"
+#include "globals.hh"
+
+#include <cstdint>
+#include <string>
+
+using std::string;
+
+enum random_engine { RANECU_ENGINE,
+                     MIXMAX_ENGINE,
+                     RANLUXPP_ENGINE,
+                     PHILOX_ENGINE };
+
+// Random number engines and their seeds for reproducible and sharded simulations.
+//
+// The type of the engines is selected with /utr/random/engine (default: MixMax). Each worker
+// thread creates its own engine of this type (see utrWorkerThreadInitialization). Since every
+// event is seeded individually, either by Geant4 from the engine of the master thread or by
+// utrRandom, the random numbers of the threads are split into one stream per event.
+//
+// By default, the engine of the master thread is seeded from the time, the process ID and the
+// random device of the system, so that jobs which are started at the same time differ. If a seed S is given (utr --seed S), every event is
+// seeded at the beginning of GeneratePrimaries() with seeds derived from (S, shard, run ID,
+// event ID) by the splitmix64 hash. The random numbers of an event therefore neither depend on
+// the number of threads nor on the distribution of the events over the threads.
+//
+// A large simulation can be split into N shards (utr --shard i/N --seed S) which are run as
+// separate processes, for example on different machines. Each shard simulates the events of the
+// macro with its own independent seeds, writes output files which are tagged with
+// '_shard<i>of<N>', and a manifest '<prefix><ID>_shard<i>of<N>.manifest' at the end of each run.
+// The outputs of all shards are verified and combined with OutputProcessing/mergeShards.
+class utrRandom {
+  public:
+  static void SetEngine(random_engine e) { engine = e; };
+  // Returns false for an unknown engine, or one which is not available in this version of Geant4
+  static G4bool SetEngine(const G4String &name);
+  static random_engine GetEngine() { return engine; };
+  static G4String GetEngineName(random_engine e);
+  static G4String GetEngineName() { return GetEngineName(engine); };
+  // A new, unseeded engine of the given type
+  static CLHEP::HepRandomEngine *CreateEngine(random_engine e);
+  // Replace the engine of the calling thread by a new engine of the selected type, and seed it with SeedMaster()
+  static void SetupMasterEngine();
+
+  static void SetSeed(uint64_t s) {
+    seed = s;
+    per_event_seeds = true;
+  };
+  static uint64_t GetSeed() { return seed; };
+  // Per-event seeds are used if a seed or a shard was given
+  static G4bool GetPerEventSeeds() { return per_event_seeds; };
+
+  // Parse a shard given as 'i/N' with 0 <= i < N. Returns false for an invalid shard.
+  static G4bool SetShard(const string &shard);
+  static unsigned int GetShardIndex() { return shard_index; };
+  static unsigned int GetShardCount() { return shard_count; };
+  static G4bool IsSharded() { return shard_count > 1; };
+  // '_shard<i>of<N>' for sharded simulations, empty otherwise
+  static string GetShardTag();
+
+  // Seed the master engine with a seed derived from (S, shard), or from the time, process ID and random device if no seed was given.
+  static void SeedMaster();
+  // Seed the engine of the current thread for the given event, if per-event seeds are used
+  static void SeedEvent(const G4Event *event);
+  // Derive the seed of an event. Seeds of different (seed, shard, run, event) are independent.
+  static uint64_t EventSeed(uint64_t s, unsigned int shard, G4int run_id, G4int event_id);
+
+  // Write the manifest of a shard. Called by the master thread at the end of each run.
+  static void WriteManifest(const G4Run *run);
+
+  private:
+  static random_engine engine;
+  static uint64_t seed;
+  static G4bool per_event_seeds;
+  static unsigned int shard_index;
+  static unsigned int shard_count;
+};
@@ -0,0 +1,88 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include "G4LogicalVolume.hh"
+#include "G4Step.hh"
+#include "globals.hh"
+
+#include <mutex>
+#include <vector>
+
+using std::vector;
+
+// Assignment of logical volumes to G4Regions, to be able to use different production cuts in
+// the detectors, the targets and the bulk shielding.
+// Volumes can be assigned by a DetectorConstruction with AddVolume() in Construct(), or by
+// macro commands which select the volumes by their name or material before /run/initialize.
+// By default, all volumes with a sensitive detector are assigned to the region 'detectors'.
+// A volume can only be the root volume of a single region, so the first assignment wins:
+// AddVolume(), then the sensitive volumes, then the macro commands in the order of the macro.
+// All regions inherit the default production cuts (/run/setCut), unless a specific cut is set.
+class utrRegions {
+  public:
+  // Assign a logical volume (and its daughters) to a region, which is created if necessary
+  static void AddVolume(const G4String &region_name, G4LogicalVolume *logical_volume);
+  // Assign all logical volumes whose name or whose material name matches a pattern
+  // with shell-style wildcards, for example '*Brick*' or 'G4_Pb'
+  static void AddVolumesByName(const G4String &region_name, const G4String &pattern);
+  static void AddVolumesByMaterial(const G4String &region_name, const G4String &pattern);
+  // Use the same production cut for all particles in a region
+  static void SetProductionCut(const G4String &region_name, G4double cut);
+  static void SetAssignDetectors(G4bool a) { assign_detectors = a; };
+  static G4bool GetAssignDetectors() { return assign_detectors; };
+
+  // Apply all assignments and production cuts. Called on the master thread by Physics::SetCuts(),
+  // after the geometry and the sensitive detectors have been constructed.
+  static void Setup();
+
+  // Count the steps and secondaries in each region. The worker threads add their counts to the
+  // total in their EndOfRunAction, which is printed by the master thread at the end of the run.
+  static void SetStatistics(G4bool s) { statistics = s; };
+  static G4bool GetStatistics() { return statistics; };
+  static void CountStep(const G4Step *step);
+  static void MergeStatistics();
+  static void PrintStatistics();
+
+  private:
+  struct Assignment {
+    G4String region_name;
+    G4String pattern;
+    G4bool by_material;
+  };
+  struct Cut {
+    G4String region_name;
+    G4double cut;
+  };
+
+  static void assign(const G4String &region_name, G4LogicalVolume *logical_volume);
+  static void find_sensitive_volumes(G4LogicalVolume *logical_volume, vector<G4LogicalVolume *> &sensitive_volumes);
+
+  static G4bool assign_detectors;
+  static vector<Assignment> assignments;
+  static vector<Cut> cuts;
+
+  static G4bool statistics;
+  static G4ThreadLocal vector<unsigned long> *n_steps;
+  static G4ThreadLocal vector<unsigned long> *n_secondaries;
+  static vector<unsigned long> total_steps;
+  static vector<unsigned long> total_secondaries;
+  static std::mutex statistics_mutex;
+};
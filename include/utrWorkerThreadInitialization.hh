@@ -0,0 +1,34 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include "CLHEP/Random/RandomEngine.h"
+#include "G4UserWorkerThreadInitialization.hh"
+
+// Creates the random number engine of each worker thread with the type which was selected with
+// /utr/random/engine. The default implementation of Geant4 uses the type of the engine of the
+// master thread when the run manager was constructed, and only knows the engines of CLHEP.
+class utrWorkerThreadInitialization : public G4UserWorkerThreadInitialization {
+  public:
+  utrWorkerThreadInitialization(){};
+  ~utrWorkerThreadInitialization(){};
+
+  void SetupRNGEngine(const CLHEP::HepRandomEngine *master_engine) const override;
+};
@@ -18,6 +18,7 @@ You should have received a copy of the GNU General Public License
 along with utr.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <memory>
 #include <vector>
 
 #include "ActionInitialization.hh"
@@ -32,6 +33,8 @@ along with utr.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "EventAction.hh"
 #include "RunAction.hh"
+#include "StackingAction.hh"
+#include "SteppingAction.hh"
 
 using std::vector;
 
@@ -41,7 +44,21 @@ ActionInitialization::ActionInitialization() : G4VUserActionInitialization(),
 ActionInitialization::~ActionInitialization() {}
 
 void ActionInitialization::BuildForMaster() const {
-  SetUserAction(new RunAction);
+  RunAction *runAction = new RunAction();
+
+  // The master thread owns an instance of the generator which receives the same macro commands as
+  // the generators of the worker threads. It is only used to run the self-checks once per run.
+#ifdef GENERATOR_ANGDIST
+  std::shared_ptr<AngularDistributionGenerator> generator(new AngularDistributionGenerator);
+  G4int n_validation_threads = n_threads;
+  runAction->SetPreRunValidation([generator, n_validation_threads]() { generator->ValidateOnMaster(n_validation_threads); });
+#elif defined GENERATOR_ANGCORR
+  std::shared_ptr<AngularCorrelationGenerator> generator(new AngularCorrelationGenerator);
+  G4int n_validation_threads = n_threads;
+  runAction->SetPreRunValidation([generator, n_validation_threads]() { generator->ValidateOnMaster(n_validation_threads); });
+#endif
+
+  SetUserAction(runAction);
 }
 
 void ActionInitialization::Build() const {
@@ -53,11 +70,10 @@ void ActionInitialization::Build() const {
   SetUserAction(new GeneralParticleSource);
 #endif
 
-  EventAction *eventAction = new EventAction();
-#ifdef G4MULTITHREADED
-  eventAction->setNThreads(n_threads);
-#endif
-  SetUserAction(eventAction);
+  SetUserAction(new EventAction());
+
+  SetUserAction(new StackingAction());
+  SetUserAction(new SteppingAction());
 
   RunAction *runAction = new RunAction();
 
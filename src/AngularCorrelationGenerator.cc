@@ -21,7 +21,6 @@ along with utr.  If not, see <http://www.gnu.org/licenses/>.
 #include "G4Event.hh"
 #include "G4ParticleGun.hh"
 #include "G4ParticleTable.hh"
-#include "G4TransportationManager.hh"
 #include "G4VUserPrimaryGeneratorAction.hh"
 #include "Randomize.hh"
 
@@ -30,10 +29,24 @@ along with utr.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "AngularCorrelationGenerator.hh"
 #include "AngularCorrelationMessenger.hh"
+#include "EventTimer.hh"
+#include "utrParallelSampling.hh"
+#include "utrRandom.hh"
+
+std::mutex AngularCorrelationGenerator::master_validation_mutex;
+G4bool AngularCorrelationGenerator::master_checked_position_generator = false;
+G4bool AngularCorrelationGenerator::master_checked_momentum_generator = false;
+G4double AngularCorrelationGenerator::master_position_acceptance = 0.;
+vector<G4double> AngularCorrelationGenerator::master_momentum_acceptance;
+vector<G4double> AngularCorrelationGenerator::master_envelope_margins;
 
 AngularCorrelationGenerator::AngularCorrelationGenerator()
     : G4VUserPrimaryGeneratorAction(), particleGun(0),
       angdist(0),
+      resolved_angular_distributions(false),
+      tabulated_envelopes(false),
+      batch_size(0),
+      next_position(0),
       MAX_TRIES_POSITION(1e4),
       MAX_TRIES_MOMENTUM(1e4),
       direction_given(false),
@@ -44,9 +57,6 @@ AngularCorrelationGenerator::AngularCorrelationGenerator()
 
   particleGun = new G4ParticleGun(1);
   particleTable = G4ParticleTable::GetParticleTable();
-
-  navi = G4TransportationManager::GetTransportationManager()
-             ->GetNavigatorForTracking();
 }
 
 AngularCorrelationGenerator::~AngularCorrelationGenerator() {
@@ -56,6 +66,15 @@ AngularCorrelationGenerator::~AngularCorrelationGenerator() {
 
 void AngularCorrelationGenerator::GeneratePrimaries(G4Event *anEvent) {
 
+  if (!resolved_angular_distributions)
+    resolve_angular_distributions();
+  if (!tabulated_envelopes)
+    tabulate_envelopes();
+  if (!source_sampler.IsInitialized())
+    source_sampler.Initialize(source_PV_names, G4ThreeVector(source_x, source_y, source_z), G4ThreeVector(range_x, range_y, range_z));
+
+  use_master_validation();
+
 #ifdef CHECK_POSITION_GENERATOR
   check_position_generator();
 #endif
@@ -64,6 +83,12 @@ void AngularCorrelationGenerator::GeneratePrimaries(G4Event *anEvent) {
   check_momentum_generator();
 #endif
 
+  // Seed the event after the initialization, which is only done in the first event of each thread
+  utrRandom::SeedEvent(anEvent);
+  if (EventTimer::Replay(anEvent)) {
+    return;
+  }
+
   G4ThreeVector randomPosition = G4ThreeVector(0., 0., 0.);
   randomPosition = generate_position();
 
@@ -102,131 +127,75 @@ void AngularCorrelationGenerator::GeneratePrimaries(G4Event *anEvent) {
 
 G4ThreeVector AngularCorrelationGenerator::generate_position() {
 
-  for (int i = 0; i < MAX_TRIES_POSITION; i++) {
-    random_x = (G4UniformRand() - 0.5) * range_x + source_x;
-    random_y = (G4UniformRand() - 0.5) * range_y + source_y;
-    random_z = (G4UniformRand() - 0.5) * range_z + source_z;
-
-    pv = navi->LocateGlobalPointAndSetup(
-                 G4ThreeVector(random_x, random_y, random_z))
-             ->GetName();
-
-    for (unsigned int j = 0; j < source_PV_names.size(); ++j) {
-      if (pv == source_PV_names[j]) {
-        return G4ThreeVector(random_x, random_y, random_z);
-      }
-    }
+  // With per-event seeds, each event has to use its own random numbers, so the buffers are not used
+  if (batch_size > 0 && !utrRandom::GetPerEventSeeds()) {
+    if (next_position == position_batch.size())
+      fill_position_batch();
+    if (next_position < position_batch.size())
+      return position_batch[next_position++];
   }
 
+  G4ThreeVector random_position;
+  if (source_sampler.Sample(random_position, MAX_TRIES_POSITION))
+    return random_position;
+
   G4cout << "Warning: AngularCorrelationGenerator: Monte-Carlo method "
             "could not determine a starting point after "
          << MAX_TRIES_POSITION << " iterations" << G4endl;
   return G4ThreeVector();
 }
 
-void AngularCorrelationGenerator::check_position_generator() {
+void AngularCorrelationGenerator::check_position_generator(G4int n_threads) {
 
   if (!checked_position_generator) {
-    G4int position_success = 0;
-
-    G4int max_x = 0;
-    G4int max_y = 0;
-    G4int max_z = 0;
-
-    for (unsigned int j = 0; j < source_PV_names.size(); ++j) {
-
-      position_success = 0;
-
-      G4cout << "========================================================"
-                "===="
-                "============"
-             << G4endl;
-      G4cout << "Checking Monte-Carlo position generator with "
-             << MAX_TRIES_POSITION << " 3D points for volume "
-             << source_PV_names[j] << " ..." << G4endl;
-
-      for (int i = 0; i < MAX_TRIES_POSITION; i++) {
-        random_x = (G4UniformRand() - 0.5) * range_x + source_x;
-        random_y = (G4UniformRand() - 0.5) * range_y + source_y;
-        random_z = (G4UniformRand() - 0.5) * range_z + source_z;
-
-        pv = navi->LocateGlobalPointAndSetup(
-                     G4ThreeVector(random_x, random_y, random_z))
-                 ->GetName();
-        pvx = navi->LocateGlobalPointAndSetup(
-                      G4ThreeVector(0.5 * range_x + source_x, random_y, random_z))
-                  ->GetName();
-        pvmx = navi->LocateGlobalPointAndSetup(
-                       G4ThreeVector(-0.5 * range_x + source_x, random_y, random_z))
-                   ->GetName();
-        pvy = navi->LocateGlobalPointAndSetup(
-                      G4ThreeVector(random_x, 0.5 * range_y + source_y, random_z))
-                  ->GetName();
-        pvmy = navi->LocateGlobalPointAndSetup(
-                       G4ThreeVector(random_x, -0.5 * range_y + source_y, random_z))
-                   ->GetName();
-        pvz = navi->LocateGlobalPointAndSetup(
-                      G4ThreeVector(random_x, random_y, 0.5 * range_z + source_z))
-                  ->GetName();
-        pvmz = navi->LocateGlobalPointAndSetup(
-                       G4ThreeVector(random_x, random_y, -0.5 * range_z + source_z))
-                   ->GetName();
-
-        if (pv == source_PV_names[j]) {
-          ++position_success;
-        }
-        if (pvx == source_PV_names[j] || pvmx == source_PV_names[j]) {
-          ++max_x;
-        }
-        if (pvy == source_PV_names[j] || pvmy == source_PV_names[j]) {
-          ++max_y;
-        }
-        if (pvz == source_PV_names[j] || pvmz == source_PV_names[j]) {
-          ++max_z;
-        }
+    G4cout << "========================================================"
+              "===="
+              "============"
+           << G4endl;
+    G4cout << "Checking Monte-Carlo position generator with "
+           << MAX_TRIES_POSITION << " 3D points";
+    if (n_threads > 1)
+      G4cout << " in " << n_threads << " threads";
+    G4cout << " ..." << G4endl;
+
+    vector<SourceVolumeSampler> source_samplers(n_threads, source_sampler);
+    utrParallelSampling::run(n_threads, MAX_TRIES_POSITION, [&source_samplers](G4int n_thread, G4long n_samples, CLHEP::HepRandomEngine *engine) {
+      G4ThreeVector random_position;
+      source_samplers[n_thread].SetEngine(engine);
+      source_samplers[n_thread].ResetStatistics();
+      for (G4long i = 0; i < n_samples; i++) {
+        source_samplers[n_thread].TrySample(random_position);
       }
-
-      G4double p = (G4double)position_success / MAX_TRIES_POSITION;
-      G4double pnot = 1. - p;
-
-      G4cout << "Check finished. Of " << MAX_TRIES_POSITION
-             << " random 3D points, " << position_success
-             << " were inside volume " << source_PV_names[j] << " ( "
-             << p / perCent << " % )" << G4endl;
-      G4cout << "Probability of failure:\tpow( " << pnot << ", "
-             << MAX_TRIES_POSITION
-             << " ) = " << pow(pnot, MAX_TRIES_POSITION) / perCent << " %"
-             << G4endl;
-
-      if (max_x == 0) {
-        G4cout << "X range " << source_x << " +- " << 0.5 * range_x << " seems to be large enough." << G4endl;
-      } else {
-        G4double p_max_x = (double)max_x / MAX_TRIES_POSITION;
-        G4cout << G4endl;
-        G4cout << "In " << max_x << " out of " << MAX_TRIES_POSITION << " cases (" << p_max_x / perCent << " % ) the randomly sampled point (sourceX +- sourceDX, sourceY + randomY, sourceZ + randomZ) was still inside the source volume. This may mean that the x range does not encompass the whole source volume." << G4endl;
-      }
-
-      if (max_y == 0) {
-        G4cout << "Y range " << source_y << " +- " << 0.5 * range_y << " seems to be large enough." << G4endl;
-      } else {
-        G4double p_max_y = (double)max_y / MAX_TRIES_POSITION;
-        G4cout << G4endl;
-        G4cout << "In " << max_y << " out of " << MAX_TRIES_POSITION << " cases (" << p_max_y / perCent << " % ) the randomly sampled point (sourceX + randomX, sourceY +- sourceDY, sourceZ + randomZ) was still inside the source volume. This may mean that the y range does not encompass the whole source volume." << G4endl;
-      }
-
-      if (max_z == 0) {
-        G4cout << "Z range " << source_z << " +- " << 0.5 * range_z << " seems to be large enough." << G4endl;
-      } else {
-        G4double p_max_z = (double)max_z / MAX_TRIES_POSITION;
-        G4cout << G4endl;
-        G4cout << "In " << max_z << " out of " << MAX_TRIES_POSITION << " cases (" << p_max_z / perCent << " % ) the randomly sampled point (sourceX + randomX, sourceY + randomY, sourceZ +- sourceDZ) was still inside the source volume. This may mean that the z range does not encompass the whole source volume." << G4endl;
-      }
-
-      G4cout << "========================================================"
-                "===="
-                "============"
-             << G4endl << G4endl;
+    });
+
+    source_sampler.ResetStatistics();
+    for (auto &copy : source_samplers)
+      source_sampler.AddStatistics(copy);
+    source_sampler.PrintStatistics();
+
+    G4double p = source_sampler.GetAcceptance();
+    G4double pnot = 1. - p;
+
+    G4cout << "Check finished. Of " << MAX_TRIES_POSITION
+           << " random 3D points, " << source_sampler.GetNAccepted()
+           << " were inside the source volumes ( "
+           << p / perCent << " % )" << G4endl;
+    G4cout << "Probability of failure:\tpow( " << pnot << ", "
+           << MAX_TRIES_POSITION
+           << " ) = " << pow(pnot, MAX_TRIES_POSITION) / perCent << " %"
+           << G4endl;
+
+    if (!source_sampler.IsClipped()) {
+      G4cout << "Container box " << source_x << " +- " << 0.5 * range_x << ", " << source_y << " +- " << 0.5 * range_y << ", " << source_z << " +- " << 0.5 * range_z << " seems to be large enough." << G4endl;
+    } else {
+      G4cout << G4endl;
+      G4cout << "The container box (sourceX +- sourceDX/2, sourceY +- sourceDY/2, sourceZ +- sourceDZ/2) cuts away parts of the extent of at least one source volume. This may mean that the container box does not encompass the whole source volume." << G4endl;
     }
+
+    G4cout << "========================================================"
+              "===="
+              "============"
+           << G4endl << G4endl;
   }
   checked_position_generator = true;
 }
@@ -250,101 +219,159 @@ G4ThreeVector AngularCorrelationGenerator::generate_direction(unsigned long n_pa
   } else {
     G4ThreeVector randomDirection(0., 0., 1.);
 
+    if (batch_size > 0 && !utrRandom::GetPerEventSeeds()) {
+      if (direction_batches[n_particle].Empty())
+        fill_direction_batch(n_particle);
+      if (!direction_batches[n_particle].Empty()) {
+        G4double x, y, z;
+        direction_batches[n_particle].Pop(x, y, z);
+        return G4ThreeVector(x, y, z);
+      }
+    }
+
     for (int i = 0; i < MAX_TRIES_MOMENTUM; i++) {
-      random_theta = acos(2. * G4UniformRand() - 1.);
-      random_phi = twopi * G4UniformRand();
-      random_w = G4UniformRand() * MAX_W;
-
-      if (!is_polarized[n_particle]) {
-        if (random_w <= angdist->AngDist(random_theta, random_phi, &states[n_particle][0],
-                                         nstates[n_particle], &mixing_ratios[n_particle][0]) +
-                            angdist->AngDist(random_theta,
-                                             random_phi, &alt_states[n_particle][0], nstates[n_particle], &mixing_ratios[n_particle][0])) {
-          randomDirection.setTheta(random_theta);
-          randomDirection.setPhi(random_phi);
-          return randomDirection;
-        }
-      } else {
-        if (random_w <= angdist->AngDist(random_theta, random_phi, &states[n_particle][0],
-                                         nstates[n_particle], &mixing_ratios[n_particle][0])) {
-          randomDirection.setTheta(random_theta);
-          randomDirection.setPhi(random_phi);
-          return randomDirection;
-        }
+      const G4double u_cell = G4UniformRand();
+      const G4double u_cos_theta = G4UniformRand();
+      const G4double u_phi = G4UniformRand();
+      random_w = G4UniformRand() * envelopes[n_particle].Sample(u_cell, u_cos_theta, u_phi, random_theta, random_phi);
+
+      if (random_w <= angular_distribution(n_particle, random_theta, random_phi)) {
+        randomDirection.setTheta(random_theta);
+        randomDirection.setPhi(random_phi);
+        return randomDirection;
       }
     }
   }
   return G4ThreeVector();
 }
 
-void AngularCorrelationGenerator::check_momentum_generator() {
+void AngularCorrelationGenerator::fill_position_batch() {
+
+  position_batch.clear();
+  next_position = 0;
+  G4ThreeVector random_position;
+  for (unsigned int i = 0; i < batch_size; ++i) {
+    if (source_sampler.Sample(random_position, MAX_TRIES_POSITION))
+      position_batch.push_back(random_position);
+  }
+}
+
+void AngularCorrelationGenerator::fill_direction_batch(unsigned long n_particle) {
+
+  CLHEP::HepRandomEngine *engine = G4Random::getTheEngine();
+
+  direction_batches[n_particle].Fill(
+      [engine](unsigned int n, double *u) { engine->flatArray((G4int)n, u); },
+      [this, engine, n_particle](unsigned int n, double *theta, double *phi, double *envelope) {
+        for (unsigned int i = 0; i < n; ++i) {
+          const G4double u_cell = engine->flat();
+          const G4double u_cos_theta = engine->flat();
+          const G4double u_phi = engine->flat();
+          envelope[i] = envelopes[n_particle].Sample(u_cell, u_cos_theta, u_phi, theta[i], phi[i]);
+        }
+      },
+      [this, n_particle](const double *theta, const double *phi, double *w, unsigned int n) {
+        ang_dist_batch_states[n_particle](theta, phi, &mixing_ratios[n_particle][0], w, n);
+        if (!is_polarized[n_particle]) {
+          w_alt_batch.resize(n);
+          ang_dist_batch_alt_states[n_particle](theta, phi, &mixing_ratios[n_particle][0], &w_alt_batch[0], n);
+          for (unsigned int i = 0; i < n; ++i)
+            w[i] += w_alt_batch[i];
+        }
+      },
+      MAX_TRIES_MOMENTUM);
+}
+
+void AngularCorrelationGenerator::fill_polarization_batch(unsigned long n_particle) {
+
+  CLHEP::HepRandomEngine *engine = G4Random::getTheEngine();
+  DirectionBatch::UniformFunction uniform = [engine](unsigned int n, double *u) { engine->flatArray((G4int)n, u); };
+
+  // Isotropic polarization vectors, which are all accepted
+  polarization_batches[n_particle].Fill(
+      uniform,
+      [&uniform](unsigned int n, double *theta, double *phi, double *envelope) {
+        DirectionBatch::ProposeIsotropic(uniform, n, theta, phi, envelope, 1.);
+      },
+      DirectionBatch::EvaluationFunction(), 1);
+}
+
+void AngularCorrelationGenerator::check_momentum_generator(G4int n_threads) {
 
   if (!checked_momentum_generator) {
 
-    G4int momentum_success = 0;
-    unsigned int max_w = 0;
-    double p_max_w = 0.;
+    momentum_acceptance.assign(particles.size(), 1.);
 
     for (unsigned long n_particle = 0; n_particle < particles.size(); ++n_particle) {
 
-      momentum_success = 0;
-      max_w = 0;
-      p_max_w = 0.;
-
       G4cout << "============================================================"
                 "============"
              << G4endl;
       G4cout << "Monte-Carlo momentum generator with "
-             << MAX_TRIES_MOMENTUM << " 3D vectors for" << G4endl;
+             << MAX_TRIES_MOMENTUM << " 3D vectors";
+      if (n_threads > 1)
+        G4cout << " in " << n_threads << " threads";
+      G4cout << " for" << G4endl;
       G4cout << "Cascade step #" << n_particle + 1 << " ( Particle: " << particles[n_particle]->GetParticleName() << " ) " << G4endl;
 
       if (!momentum_generator_check_unnecessary(n_particle)) {
-        for (int i = 0; i < MAX_TRIES_MOMENTUM; i++) {
-          random_theta = acos(2. * G4UniformRand() - 1.);
-          random_phi = twopi * G4UniformRand();
-          random_w = G4UniformRand() * MAX_W;
-
-          if (!is_polarized[n_particle]) {
-            if (random_w <= angdist->AngDist(random_theta, random_phi, &states[n_particle][0],
-                                             nstates[n_particle], &mixing_ratios[n_particle][0]) +
-                                angdist->AngDist(random_theta,
-                                                 random_phi, &alt_states[n_particle][0], nstates[n_particle], &mixing_ratios[n_particle][0]))
-              ++momentum_success;
-          } else {
-            if (random_w <= angdist->AngDist(random_theta, random_phi, &states[n_particle][0],
-                                             nstates[n_particle], &mixing_ratios[n_particle][0]))
-              ++momentum_success;
+        vector<G4long> momentum_success(n_threads, 0);
+        vector<G4long> envelope_overflow_counter(n_threads, 0);
+        G4long n_momentum_success = 0;
+
+        for (G4int n_enlargements = 0;; ++n_enlargements) {
+          momentum_success.assign(n_threads, 0);
+          envelope_overflow_counter.assign(n_threads, 0);
+          utrParallelSampling::run(n_threads, MAX_TRIES_MOMENTUM, [&](G4int n_thread, G4long n_samples, CLHEP::HepRandomEngine *engine) {
+            for (G4long i = 0; i < n_samples; i++) {
+              G4double theta, phi;
+              const G4double u_cell = engine->flat();
+              const G4double u_cos_theta = engine->flat();
+              const G4double u_phi = engine->flat();
+              G4double envelope = envelopes[n_particle].Sample(u_cell, u_cos_theta, u_phi, theta, phi);
+              G4double w = angular_distribution(n_particle, theta, phi);
+
+              if (engine->flat() * envelope <= w)
+                ++momentum_success[n_thread];
+              if (envelope < w)
+                ++envelope_overflow_counter[n_thread];
+            }
+          });
+
+          n_momentum_success = 0;
+          G4long n_envelope_overflow = 0;
+          for (G4int n_thread = 0; n_thread < n_threads; ++n_thread) {
+            n_momentum_success += momentum_success[n_thread];
+            n_envelope_overflow += envelope_overflow_counter[n_thread];
           }
-          if (!is_polarized[n_particle]) {
-            if (MAX_W <= angdist->AngDist(random_theta, random_phi, &states[n_particle][0],
-                                          nstates[n_particle], &mixing_ratios[n_particle][0]) +
-                             angdist->AngDist(random_theta,
-                                              random_phi, &alt_states[n_particle][0], nstates[n_particle], &mixing_ratios[n_particle][0]))
-              ++max_w;
-          } else {
-            if (MAX_W <= angdist->AngDist(random_theta, random_phi, &states[n_particle][0],
-                                          nstates[n_particle], &mixing_ratios[n_particle][0]))
-              ++max_w;
+
+          if (n_envelope_overflow == 0)
+            break;
+
+          G4double p_envelope = (double)n_envelope_overflow / MAX_TRIES_MOMENTUM;
+          G4cout << "In " << n_envelope_overflow << " out of " << MAX_TRIES_MOMENTUM << " cases (" << p_envelope / perCent << " % ) W(random_theta, random_phi) was larger than the envelope with a margin of " << envelope_margins[n_particle] << "." << G4endl;
+          if (n_enlargements == ENVELOPE_MAX_ENLARGEMENTS) {
+            G4cerr << "ERROR: AngularCorrelationGenerator: The envelope of cascade step #" << n_particle + 1 << " is still too low after " << ENVELOPE_MAX_ENLARGEMENTS << " enlargements, so the angular distribution would be truncated. Aborting..." << G4endl;
+            throw std::exception();
           }
+          envelope_margins[n_particle] *= ENVELOPE_ENLARGEMENT_FACTOR;
+          G4cout << "Enlarging the margin to " << envelope_margins[n_particle] << " and repeating the check." << G4endl;
+          tabulate_envelope(n_particle);
         }
 
-        G4double p = (double)momentum_success / MAX_TRIES_MOMENTUM;
+        G4double p = (double)n_momentum_success / MAX_TRIES_MOMENTUM;
         G4double pnot = (double)1. - p;
 
         G4cout << "Check finished. Of " << MAX_TRIES_MOMENTUM
-               << " random 3D momentum vectors, " << momentum_success
+               << " random 3D momentum vectors, " << n_momentum_success
                << " were valid ( " << p / perCent << " % )" << G4endl;
+        G4cout << "Expected acceptance of the " << ENVELOPE_N_COS_THETA << " x " << ENVELOPE_N_PHI << " envelope: " << envelopes[n_particle].GetMajorantAcceptance() / perCent << " %" << G4endl;
         G4cout << "Probability of failure:\tpow( " << pnot << ", "
                << MAX_TRIES_MOMENTUM
                << " ) = " << pow(pnot, MAX_TRIES_MOMENTUM) / perCent << " %"
                << G4endl;
-        if (max_w == 0) {
-          G4cout << "MAX_W == " << MAX_W << " seems to be high enough." << G4endl;
-        } else {
-          p_max_w = (double)max_w / MAX_TRIES_MOMENTUM;
-          G4cout << G4endl;
-          G4cout << "In " << max_w << " out of " << MAX_TRIES_MOMENTUM << " cases (" << p_max_w / perCent << " % ) W(random_theta, random_phi) == MAX_W == " << MAX_W << " was valid. This may mean that MAX_W is set too low and the angular distribution is truncated." << G4endl;
-        }
+        G4cout << "The envelope seems to be high enough." << G4endl;
+        momentum_acceptance[n_particle] = p;
         G4cout << "============================================================"
                   "============"
                << G4endl << G4endl;
@@ -360,6 +387,103 @@ void AngularCorrelationGenerator::check_momentum_generator() {
   }
 }
 
+void AngularCorrelationGenerator::ValidateOnMaster(G4int n_threads) {
+
+  if (!resolved_angular_distributions)
+    resolve_angular_distributions();
+  if (!tabulated_envelopes)
+    tabulate_envelopes();
+  if (!source_sampler.IsInitialized())
+    source_sampler.Initialize(source_PV_names, G4ThreeVector(source_x, source_y, source_z), G4ThreeVector(range_x, range_y, range_z));
+
+#ifdef CHECK_POSITION_GENERATOR
+  check_position_generator(n_threads);
+#endif
+
+#ifdef CHECK_MOMENTUM_GENERATOR
+  check_momentum_generator(n_threads);
+#endif
+
+  std::lock_guard<std::mutex> lock(master_validation_mutex);
+  master_checked_position_generator = checked_position_generator;
+  master_checked_momentum_generator = checked_momentum_generator;
+  master_position_acceptance = source_sampler.GetAcceptance();
+  master_momentum_acceptance = momentum_acceptance;
+  master_envelope_margins = envelope_margins;
+}
+
+void AngularCorrelationGenerator::use_master_validation() {
+
+  if (checked_position_generator && checked_momentum_generator)
+    return;
+
+  std::lock_guard<std::mutex> lock(master_validation_mutex);
+  if (!checked_position_generator && master_checked_position_generator) {
+    if (G4Threading::G4GetThreadId() == 0)
+      G4cout << "AngularCorrelationGenerator: Using the check of the position generator on the master thread (acceptance " << master_position_acceptance / perCent << " %)" << G4endl;
+    checked_position_generator = true;
+  }
+  if (!checked_momentum_generator && master_checked_momentum_generator && master_momentum_acceptance.size() == particles.size()) {
+    if (G4Threading::G4GetThreadId() == 0) {
+      G4cout << "AngularCorrelationGenerator: Using the check of the momentum generator on the master thread (acceptance";
+      for (auto acceptance : master_momentum_acceptance)
+        G4cout << " " << acceptance / perCent << " %";
+      G4cout << ")" << G4endl;
+    }
+    momentum_acceptance = master_momentum_acceptance;
+    // Use the envelopes which passed the check on the master thread
+    if (master_envelope_margins != envelope_margins) {
+      envelope_margins = master_envelope_margins;
+      tabulate_envelopes();
+    }
+    checked_momentum_generator = true;
+  }
+}
+
+void AngularCorrelationGenerator::resolve_angular_distributions() {
+
+  for (unsigned long n_particle = 0; n_particle < particles.size(); ++n_particle) {
+    ang_dist_states[n_particle] = nullptr;
+    ang_dist_alt_states[n_particle] = nullptr;
+    ang_dist_batch_states[n_particle] = nullptr;
+    ang_dist_batch_alt_states[n_particle] = nullptr;
+
+    // No angular distribution is needed if the direction is fixed
+    if ((n_particle == 0 && direction_given) || (n_particle > 0 && relative_angle_given[n_particle]))
+      continue;
+
+    ang_dist_states[n_particle] = angdist->GetAngDistFunction(&states[n_particle][0], nstates[n_particle]);
+    ang_dist_alt_states[n_particle] = angdist->GetAngDistFunction(&alt_states[n_particle][0], nstates[n_particle]);
+    if (ang_dist_states[n_particle] == nullptr || (!is_polarized[n_particle] && ang_dist_alt_states[n_particle] == nullptr)) {
+      G4cerr << "ERROR: AngularCorrelationGenerator: Required spin sequence of cascade step #" << n_particle + 1 << " not found." << G4endl;
+      throw std::exception();
+    }
+    ang_dist_batch_states[n_particle] = angdist->GetAngDistBatchFunction(&states[n_particle][0], nstates[n_particle]);
+    ang_dist_batch_alt_states[n_particle] = angdist->GetAngDistBatchFunction(&alt_states[n_particle][0], nstates[n_particle]);
+  }
+  resolved_angular_distributions = true;
+}
+
+void AngularCorrelationGenerator::tabulate_envelopes() {
+
+  for (unsigned long n_particle = 0; n_particle < particles.size(); ++n_particle)
+    tabulate_envelope(n_particle);
+  tabulated_envelopes = true;
+}
+
+void AngularCorrelationGenerator::tabulate_envelope(unsigned long n_particle) {
+
+  envelopes[n_particle].Clear();
+
+  if (ang_dist_states[n_particle] == nullptr)
+    return;
+
+  if (!envelopes[n_particle].TabulateMajorant([this, n_particle](double theta, double phi) { return angular_distribution(n_particle, theta, phi); }, envelope_margins[n_particle])) {
+    G4cerr << "ERROR: AngularCorrelationGenerator: Angular distribution of cascade step #" << n_particle + 1 << " is nowhere positive." << G4endl;
+    throw std::exception();
+  }
+}
+
 bool AngularCorrelationGenerator::momentum_generator_check_unnecessary(unsigned long n_particle) {
 
   G4bool unnecessary = false;
@@ -392,6 +516,16 @@ bool AngularCorrelationGenerator::momentum_generator_check_unnecessary(unsigned
 
 G4ThreeVector AngularCorrelationGenerator::generate_polarization(unsigned long n_particle) {
   if (!is_polarized[n_particle]) {
+    if (batch_size > 0 && !utrRandom::GetPerEventSeeds()) {
+      if (polarization_batches[n_particle].Empty())
+        fill_polarization_batch(n_particle);
+      if (!polarization_batches[n_particle].Empty()) {
+        G4double x, y, z;
+        polarization_batches[n_particle].Pop(x, y, z);
+        return G4ThreeVector(x, y, z);
+      }
+    }
+
     random_theta = acos(2. * G4UniformRand() - 1.);
     random_phi = twopi * G4UniformRand();
 
@@ -163,6 +163,13 @@ AngularCorrelationMessenger::AngularCorrelationMessenger(
   sourcePVCmd->SetGuidance("Add physical volume as a particle source.");
   sourcePVCmd->SetParameterName("sourcePV", true);
   sourcePVCmd->SetDefaultValue("");
+
+  batchSizeCmd = new G4UIcmdWithAnInteger("/angcorr/batchSize", this);
+  batchSizeCmd->SetGuidance("Sample starting points, momentum directions and polarizations for this number of events at once and buffer them. 0 means that they are sampled event by event.");
+  batchSizeCmd->SetGuidance("Default: 0");
+  batchSizeCmd->SetParameterName("batch_size", true);
+  batchSizeCmd->SetDefaultValue(0);
+  batchSizeCmd->SetRange("batch_size >= 0");
 }
 
 AngularCorrelationMessenger::~AngularCorrelationMessenger() {
@@ -274,6 +281,10 @@ void AngularCorrelationMessenger::SetNewValue(G4UIcommand *command,
   if (command == sourcePVCmd) {
     angularCorrelationGenerator->AddSourcePV(newValues);
   }
+  if (command == batchSizeCmd) {
+    angularCorrelationGenerator->SetBatchSize(
+        batchSizeCmd->GetNewIntValue(newValues));
+  }
 }
 
 G4String AngularCorrelationMessenger::GetCurrentValue(G4UIcommand *command) {
@@ -357,6 +368,10 @@ G4String AngularCorrelationMessenger::GetCurrentValue(G4UIcommand *command) {
     return polarizationCmd->ConvertToString(
         angularCorrelationGenerator->GetPolarization());
   }
+  if (command == batchSizeCmd) {
+    return batchSizeCmd->ConvertToString(
+        angularCorrelationGenerator->GetBatchSize());
+  }
 
   return cv;
 }
@@ -9,942 +9,1487 @@ using std::endl;
 // PI/(180 DEGREE_TO_RAD)
 #define DEGREE_TO_RAD 0.017453292519943295
 
-double AngularDistribution::AngDist(
-    double theta, double phi, double *st,
-    int nst, double *mix) const {
+// One function per implemented spin cascade. They are selected once by
+// AngularDistribution::GetAngDistFunction(), so that the evaluation of W(theta, phi)
+// does not have to look up the cascade again.
+namespace {
+
+// 0.1^+ -> 0.1^+ -> 0.1^+
+// Wildcard for test distributions
+double ang_dist_3_000(double theta, double phi, const double *mix) {
+  if (theta >= 85. * DEGREE_TO_RAD && theta <= 95. * DEGREE_TO_RAD &&
+      ((phi >= 355. * DEGREE_TO_RAD && phi <= 360. * DEGREE_TO_RAD) ||
+       (phi >= 0. * DEGREE_TO_RAD && phi <= 5. * DEGREE_TO_RAD))) {
+    return 1.;
+  }
+
+  return 0.;
+}
+
+// 0^+ -> 0^+ -> 0^+
+// Isotropic distribution
+double ang_dist_3_001(double theta, double phi, const double *mix) {
+  return 1.;
+}
+
+// 0^+ -> 1^+ -> 0^+ or 0^- -> 1^- -> 0^-
+double ang_dist_3_002(double theta, double phi, const double *mix) {
+  return 0.75 * (1 + pow(cos(theta), 2) +
+                 pow(sin(theta), 2) * cos(2 * phi));
+}
+
+// 0^+ -> 1^- -> 0^+ or 0^- -> 1^- -> 0^-
+double ang_dist_3_003(double theta, double phi, const double *mix) {
+  return 0.75 * (1 + pow(cos(theta), 2) -
+                 pow(sin(theta), 2) * cos(2 * phi));
+}
+
+// 0^+ -> 2^+ -> 0^+ or 0^- -> 2^- -> 0^-
+double ang_dist_3_004(double theta, double phi, const double *mix) {
+  return 0.625 * (2. + cos(2. * theta) + cos(4. * theta) -
+                  2. * cos(2. * phi) * (1. + 2. * cos(2. * theta)) *
+                      pow(sin(theta), 2.));
+}
+
+// 0^+ -> 2^- -> 0^+ or 0^- -> 2^+ -> 0^-
+double ang_dist_3_005(double theta, double phi, const double *mix) {
+  return (10.0 * pow(sin(phi), 2) * pow(sin(theta), 4) -
+          7.5 * pow(sin(phi), 2) * pow(sin(theta), 2) -
+          2.5 * pow(sin(theta), 2) + 2.5);
+}
+
+// 0^+ -> 2^+ -> 2^+ or 0^- -> 2^- -> 2^-
+double ang_dist_3_006(double theta, double phi, const double *mix) {
+  return 1. / (56. * (1. + mix[1] * mix[1])) * (49. - 20.4939 * mix[1] + 65. * mix[1] * mix[1] + pow(cos(theta), 2) * (21. + 61.4817 * mix[1] + 5. * mix[1] * mix[1] * (-7. + 8. * cos(2. * theta))) + cos(2. * phi) * (21. + 61.4817 * mix[1] - 5. * mix[1] * mix[1] * (7. + 8. * cos(2. * theta))) * pow(sin(theta), 2));
+}
+
+// 0^+ -> 1^- -> 2^+ or 0^- -> 1^+ -> 2^-
+double ang_dist_3_007(double theta, double phi, const double *mix) {
+  return 1. + ((0.07071067811865475 + 0.9486832980505138 * mix[1] + 0.35355339059327373 * pow(mix[1], 2)) *
+               (1.0606601717798212 * cos(2. * phi) * (-1. + pow(cos(theta), 2)) + 0.35355339059327373 * (-1. + 3. * pow(cos(theta), 2)))) /
+                  (1. + pow(mix[1], 2));
+}
+
+// 0^+ -> 1^+ -> 2^+ or 0^- -> 1^- -> 2^-
+double ang_dist_3_008(double theta, double phi, const double *mix) {
+  return 1. + ((0.07071067811865475 + 0.9486832980505138 * mix[1] + 0.35355339059327373 * pow(mix[1], 2)) *
+               (-1.0606601717798212 * cos(2. * phi) * (-1. + pow(cos(theta), 2)) + 0.35355339059327373 * (-1. + 3. * pow(cos(theta), 2)))) /
+                  (1. + pow(mix[1], 2));
+}
+
+// 0^+ -> 1^- -> 1^p or 0^- -> 1^+ -> 1^p
+double ang_dist_3_009(double theta, double phi, const double *mix) {
+  return (pow(mix[1], 2) - 1.0 / 8.0 * (pow(mix[1], 2) + 6 * mix[1] + 1) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1) + 1) / (pow(mix[1], 2) + 1);
+}
+
+// 1.5^+ -> 2.5^- -> 1.5^+ or 1.5^- -> 2.5^+ -> 1.5^-
+double ang_dist_3_010(double theta, double phi, const double *mix) {
+  return ((1. + 0.9999999999999998 * pow(mix[0], 2)) * (1. + 0.9999999999999998 * pow(mix[1], 2)) -
+          0.5 * (0.37416573867739406 + (-1.8973665961010275 - 0.19090088708030317 * mix[1]) * mix[1]) *
+              ((0.37416573867739406 + (1.8973665961010275 - 0.19090088708030317 * mix[0]) * mix[0]) * (1. - 3. * pow(cos(theta), 2)) +
+               0.5727026612409095 * (-1.959999999999999 + mix[0] * (3.313004678535784 + 1. * mix[0])) * cos(2. * phi) * (-1. + pow(cos(theta), 2))) -
+          0.31098153547133134 * pow(mix[0], 2) * pow(mix[1], 2) *
+              (-0.6000000000000001 + 6. * pow(cos(theta), 2) - 7. * pow(cos(theta), 4) +
+               cos(2. * phi) * (1. - 8. * pow(cos(theta), 2) + 7. * pow(cos(theta), 4)))) /
+         ((1. + pow(mix[0], 2)) * (1. + pow(mix[1], 2)));
+}
+
+// 1.5^+ -> 2.5^+ -> 1.5^+ or 1.5^- -> 2.5^- -> 1.5^-
+double ang_dist_3_011(double theta, double phi, const double *mix) {
+  return ((1. + 0.9999999999999998 * pow(mix[0], 2)) * (1. + 0.9999999999999998 * pow(mix[1], 2)) -
+          0.5 * (0.37416573867739406 + (-1.8973665961010275 - 0.19090088708030317 * mix[1]) * mix[1]) *
+              ((0.37416573867739406 + (1.8973665961010275 - 0.19090088708030317 * mix[0]) * mix[0]) * (1. - 3. * pow(cos(theta), 2)) -
+               0.5727026612409095 * (-1.959999999999999 + mix[0] * (3.313004678535784 + 1. * mix[0])) * cos(2. * phi) * (-1. + pow(cos(theta), 2))) +
+          0.31098153547133134 * pow(mix[0], 2) * pow(mix[1], 2) *
+              (0.6000000000000001 - 6. * pow(cos(theta), 2) + 7. * pow(cos(theta), 4) +
+               cos(2. * phi) * (1. - 8. * pow(cos(theta), 2) + 7. * pow(cos(theta), 4)))) /
+         ((1. + pow(mix[0], 2)) * (1. + pow(mix[1], 2)));
+}
+
+// 1.5^+ -> 1.5^+ -> 1.5^+ or 1.5^- -> 1.5^- -> 1.5^-
+double ang_dist_3_012(double theta, double phi, const double *mix) {
+  return 1. + (0.04 * (1. + 3.872983346207417 * mix[1]) * (-1. * (-1. + 3.872983346207417 * mix[0]) * (1. + 3. * cos(2. * theta)) + 2. * (3. + 3.872983346207417 * mix[0]) * cos(2. * phi) * pow(sin(theta), 2))) / ((1. + pow(mix[0], 2)) * (1. + pow(mix[1], 2)));
+}
+
+// 1.5^+ -> 1.5^- -> 1.5^+ or 1.5^- -> 1.5^+ -> 1.5^-
+double ang_dist_3_013(double theta, double phi, const double *mix) {
+  return 1. + (0.04 * (1. + 3.872983346207417 * mix[1]) * (-1. * (-1. + 3.872983346207417 * mix[0]) * (1. + 3. * cos(2. * theta)) - 2. * (3. + 3.872983346207417 * mix[0]) * cos(2. * phi) * pow(sin(theta), 2))) / ((1. + pow(mix[0], 2)) * (1. + pow(mix[1], 2)));
+}
+
+// 0.5^- -> 1.5^- -> 0.5^- or 0.5^+ -> 1.5^+ -> 0.5^+
+double ang_dist_3_014(double theta, double phi, const double *mix) {
+  return 1. + (0.125 * (-1. + 3.4641016151377544 * mix[1] + pow(mix[1], 2)) *
+               (-1. * (1. + 3.4641016151377544 * mix[0] - 1. * pow(mix[0], 2)) * (-1. + 3. * pow(cos(theta), 2)) +
+                (-3. + 3.4641016151377544 * mix[0] + 3. * pow(mix[0], 2)) * cos(2. * phi) * pow(sin(theta), 2))) /
+                  ((1. + pow(mix[0], 2)) * (1. + pow(mix[1], 2)));
+}
+
+// 0.5^- -> 1.5^+ -> 0.5^- or 0.5^+ -> 1.5^- -> 0.5^+
+double ang_dist_3_015(double theta, double phi, const double *mix) {
+  return 1. - (0.125 * (-1. + 3.4641016151377544 * mix[1] + pow(mix[1], 2)) *
+               ((1. + 3.4641016151377544 * mix[0] - 1. * pow(mix[0], 2)) * (-1. + 3. * pow(cos(theta), 2)) +
+                (-3. + 3.4641016151377544 * mix[0] + 3. * pow(mix[0], 2)) * cos(2. * phi) * pow(sin(theta), 2))) /
+                  ((1. + pow(mix[0], 2)) * (1. + pow(mix[1], 2)));
+}
+
+// 2.5^+ -> 1.5^- -> 2.5^+ or 2.5^- -> 1.5^+ -> 2.5^-
+double ang_dist_3_016(double theta, double phi, const double *mix) {
+  return (0.5 * (2. * (1.0000000000000002 + 1. * pow(mix[0], 2)) * (1.0000000000000002 + 1. * pow(mix[1], 2)) -
+                 1. * (0.10000000000000002 + (1.1832159566199234 + 0.3571428571428572 * mix[1]) * mix[1]) *
+                     ((0.10000000000000002 + (-1.1832159566199234 + 0.3571428571428572 * mix[0]) * mix[0]) * (1. - 3. * pow(cos(theta), 2)) -
+                      1.0714285714285716 * (0.28 + mix[0] * (1.1043348928452617 + 1. * mix[0])) * cos(2. * phi) * (-1. + pow(cos(theta), 2))))) /
+         ((1. + pow(mix[0], 2)) * (1. + pow(mix[1], 2)));
+}
+
+// 2.5^+ -> 1.5^+ -> 2.5^+ or 2.5^- -> 1.5^- -> 2.5^-
+double ang_dist_3_017(double theta, double phi, const double *mix) {
+  return (0.5 * (2. * (1.0000000000000002 + 1. * pow(mix[0], 2)) * (1.0000000000000002 + 1. * pow(mix[1], 2)) -
+                 1. * (0.10000000000000002 + (1.1832159566199234 + 0.3571428571428572 * mix[1]) * mix[1]) *
+                     ((0.10000000000000002 + (-1.1832159566199234 + 0.3571428571428572 * mix[0]) * mix[0]) * (1. - 3. * pow(cos(theta), 2)) +
+                      1.0714285714285716 * (0.28 + mix[0] * (1.1043348928452617 + 1. * mix[0])) * cos(2. * phi) * (-1. + pow(cos(theta), 2))))) /
+         ((1. + pow(mix[0], 2)) * (1. + pow(mix[1], 2)));
+}
+
+// 2.5^+ -> 2.5^+ -> 2.5^+ or 2.5^- -> 2.5^- -> 2.5^-
+double ang_dist_3_018(double theta, double phi, const double *mix) {
+  return (1.0 / 2.0) * (14 * pow(mix[0], 2) * pow(mix[1], 2) * (-0.014056643065389425 * (7 * pow(cos(theta), 2) - 1) * pow(sin(theta), 2) * cos(2 * phi) + 0.098396501457725979 * pow(cos(theta), 4) - 0.08433985839233657 * pow(cos(theta), 2) + 0.0084339858392336545) + 12 * (0.40824829046386302 * pow(mix[0], 2) + 0.40824829046386296) * (0.40824829046386302 * pow(mix[1], 2) + 0.40824829046386296) + ((3 * pow(cos(theta), 2) - 1) * (0.018630018962760751 * sqrt(105) * pow(mix[0], 2) + 0.12121830534626531 * sqrt(70) * mix[0] - 0.041731242476584086 * sqrt(105)) + (0.055890056888282233 * sqrt(105) * pow(mix[0], 2) - 0.12121830534626531 * sqrt(70) * mix[0] - 0.12519372742975224 * sqrt(105)) * pow(sin(theta), 2) * cos(2 * phi)) * (0.018630018962760751 * sqrt(105) * pow(mix[1], 2) - 0.12121830534626531 * sqrt(70) * mix[1] - 0.041731242476584086 * sqrt(105))) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1));
+}
+
+// 2.5^+ -> 2.5^- -> 2.5^+ or 2.5^- -> 2.5^+ -> 2.5^-
+double ang_dist_3_019(double theta, double phi, const double *mix) {
+  return (1.0 / 2.0) * (14 * pow(mix[0], 2) * pow(mix[1], 2) * (0.19679300291545196 * pow(sin(phi), 2) * pow(sin(theta), 4) - 0.16867971678467311 * pow(sin(phi), 2) * pow(sin(theta), 2) - 0.028113286130778833 * pow(sin(theta), 2) + 0.022490628904623076) + 12 * (0.40824829046386302 * pow(mix[0], 2) + 0.40824829046386296) * (0.40824829046386302 * pow(mix[1], 2) + 0.40824829046386296) + ((3 * pow(cos(theta), 2) - 1) * (0.018630018962760751 * sqrt(105) * pow(mix[0], 2) + 0.12121830534626531 * sqrt(70) * mix[0] - 0.041731242476584086 * sqrt(105)) + (-0.055890056888282233 * sqrt(105) * pow(mix[0], 2) + 0.12121830534626531 * sqrt(70) * mix[0] + 0.12519372742975224 * sqrt(105)) * pow(sin(theta), 2) * cos(2 * phi)) * (0.018630018962760751 * sqrt(105) * pow(mix[1], 2) - 0.12121830534626531 * sqrt(70) * mix[1] - 0.041731242476584086 * sqrt(105))) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1));
+}
+
+// 2.5^+ -> 3.5^+ -> 2.5^+ or 2.5^- -> 3.5^- -> 2.5^-
+double ang_dist_3_020(double theta, double phi, const double *mix) {
+  return (1.0 / 2.0) * (308 * pow(mix[0], 2) * pow(mix[1], 2) * (-0.0016454049495837645 * (7 * pow(cos(theta), 2) - 1) * pow(sin(theta), 2) * cos(2 * phi) + 0.011517834647086349 * pow(cos(theta), 4) - 0.0098724296975025837 * pow(cos(theta), 2) + 0.00098724296975025833) + 4 * (0.70710678118654768 * pow(mix[0], 2) + 0.70710678118654746) * (0.70710678118654768 * pow(mix[1], 2) + 0.70710678118654746) + ((3 * pow(cos(theta), 2) - 1) * (-0.0053780232315788759 * sqrt(210) * pow(mix[0], 2) + 0.29160592175990219 * sqrt(42) * mix[0] + 0.02258769757263128 * sqrt(210)) + (-0.016134069694736623 * sqrt(210) * pow(mix[0], 2) - 0.29160592175990208 * sqrt(42) * mix[0] + 0.067763092717893825 * sqrt(210)) * pow(sin(theta), 2) * cos(2 * phi)) * (-0.0053780232315788759 * sqrt(210) * pow(mix[1], 2) - 0.29160592175990219 * sqrt(42) * mix[1] + 0.02258769757263128 * sqrt(210))) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1));
+}
+
+// 2.5^+ -> 3.5^- -> 2.5^+ or 2.5^- -> 3.5^+ -> 2.5^-
+double ang_dist_3_021(double theta, double phi, const double *mix) {
+  return (1.0 / 2.0) * (308 * pow(mix[0], 2) * pow(mix[1], 2) * (0.0016454049495837645 * (7 * pow(cos(theta), 2) - 1) * pow(sin(theta), 2) * cos(2 * phi) + 0.011517834647086349 * pow(cos(theta), 4) - 0.0098724296975025837 * pow(cos(theta), 2) + 0.00098724296975025833) + 4 * (0.70710678118654768 * pow(mix[0], 2) + 0.70710678118654746) * (0.70710678118654768 * pow(mix[1], 2) + 0.70710678118654746) + ((3 * pow(cos(theta), 2) - 1) * (-0.0053780232315788759 * sqrt(210) * pow(mix[0], 2) + 0.29160592175990219 * sqrt(42) * mix[0] + 0.02258769757263128 * sqrt(210)) + (0.016134069694736623 * sqrt(210) * pow(mix[0], 2) + 0.29160592175990208 * sqrt(42) * mix[0] - 0.067763092717893825 * sqrt(210)) * pow(sin(theta), 2) * cos(2 * phi)) * (-0.0053780232315788759 * sqrt(210) * pow(mix[1], 2) - 0.29160592175990219 * sqrt(42) * mix[1] + 0.02258769757263128 * sqrt(210))) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1));
+}
+
+// 3.5^+ -> 4.5^+ -> 3.5^+ or 3.5^- -> 4.5^- -> 3.5^-
+double ang_dist_3_022(double theta, double phi, const double *mix) {
+  return (pow(mix[1], 2) + (1.0 / 554400.0) * sqrt(330) * (6.0 * pow(sin(phi), 2) * pow(sin(theta), 2) - 2.0) * (5 * sqrt(330) * pow(mix[1], 2) + 2310 * sqrt(14) * mix[1] - 77 * sqrt(330)) + 1) / (pow(mix[1], 2) + 1);
+}
+
+// 3.5^+ -> 4.5^- -> 3.5^+ or 3.5^- -> 4.5^+ -> 3.5^-
+double ang_dist_3_023(double theta, double phi, const double *mix) {
+  return (pow(mix[1], 2) + (1.0 / 554400.0) * sqrt(330) * (5 * sqrt(330) * pow(mix[1], 2) + 2310 * sqrt(14) * mix[1] - 77 * sqrt(330)) * (2.9999999999999991 * pow(sin(theta), 2) * cos(2 * phi) - 3 * pow(cos(theta), 2) + 1) + 1) / (pow(mix[1], 2) + 1);
+}
+
+// 1^+ -> 2^+ -> 0^+ or 1^- -> 2^- -> 0^-
+double ang_dist_3_024(double theta, double phi, const double *mix) {
+  return (80 * pow(mix[0], 2) * pow(sin(theta), 2) * cos(2 * phi) * pow(cos(theta), 2) - 5 * pow(mix[0], 2) * pow(sin(theta), 2) * cos(2 * phi) - 80 * pow(mix[0], 2) * pow(cos(theta), 4) + 75 * pow(mix[0], 2) * pow(cos(theta), 2) + 15 * pow(mix[0], 2) + 6 * sqrt(5) * mix[0] * pow(sin(theta), 2) * cos(2 * phi) - 18 * sqrt(5) * mix[0] * pow(cos(theta), 2) + 6 * sqrt(5) * mix[0] - 9 * pow(sin(theta), 2) * cos(2 * phi) - 9 * pow(cos(theta), 2) + 27) / (24 * pow(mix[0], 2) + 24);
+}
+
+// 1^- -> 2^+ -> 0^+ or 1^+ -> 2^- -> 0^-
+double ang_dist_3_025(double theta, double phi, const double *mix) {
+  return (1.0 / 11760.0) * (1120 * pow(mix[0], 2) * (-70 * pow(sin(phi), 2) * pow(sin(theta), 4) + 60 * pow(sin(phi), 2) * pow(sin(theta), 2) + 10 * pow(sin(theta), 2) - 8) + 11760 * pow(mix[0], 2) - 3 * sqrt(70) * ((3 * pow(cos(theta), 2) - 1) * (-5 * sqrt(70) * pow(mix[0], 2) + 70 * sqrt(14) * mix[0] + 7 * sqrt(70)) + (15 * sqrt(70) * pow(mix[0], 2) + 70 * sqrt(14) * mix[0] - 21 * sqrt(70)) * pow(sin(theta), 2) * cos(2 * phi)) + 11760) / (pow(mix[0], 2) + 1);
+}
+
+// 0^+ → 1^- → 0 → 1
+double ang_dist_4_000(double theta, double phi, const double *mix) {
+  return 1 / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^- → 0 → 2
+double ang_dist_4_001(double theta, double phi, const double *mix) {
+  return 1 / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^- → 0 → 3
+double ang_dist_4_002(double theta, double phi, const double *mix) {
+  return 1 / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^- → 0 → 4
+double ang_dist_4_003(double theta, double phi, const double *mix) {
+  return 1 / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^- → 0 → 5
+double ang_dist_4_004(double theta, double phi, const double *mix) {
+  return 1 / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^- → 0 → 6
+double ang_dist_4_005(double theta, double phi, const double *mix) {
+  return 1 / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^- → 1 → 0
+double ang_dist_4_006(double theta, double phi, const double *mix) {
+  return (pow(mix[1], 2) + (1.0 / 40.0) * (pow(mix[1], 2) - 5) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1) + 1) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^- → 1 → 1
+double ang_dist_4_007(double theta, double phi, const double *mix) {
+  return (-1.0 / 80.0 * (pow(mix[1], 2) - 5) * (pow(mix[2], 2) + 6 * mix[2] + 1) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^- → 1 → 2
+double ang_dist_4_008(double theta, double phi, const double *mix) {
+  return ((1.0 / 800.0) * M_SQRT2 * (pow(mix[1], 2) - 5) * (5 * M_SQRT2 * pow(mix[2], 2) + 6 * sqrt(10) * mix[2] + M_SQRT2) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^- → 1 → 3
+double ang_dist_4_009(double theta, double phi, const double *mix) {
+  return ((1.0 / 2240.0) * M_SQRT2 * (pow(mix[1], 2) - 5) * (21 * M_SQRT2 * pow(mix[2], 2) + 16 * sqrt(7) * mix[2] - 4 * M_SQRT2) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^- → 1 → 4
+double ang_dist_4_010(double theta, double phi, const double *mix) {
+  return ((1.0 / 1600.0) * M_SQRT2 * (pow(mix[1], 2) - 5) * (17 * M_SQRT2 * pow(mix[2], 2) + 10 * sqrt(6) * mix[2] - 5 * M_SQRT2) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^- → 1 → 5
+double ang_dist_4_011(double theta, double phi, const double *mix) {
+  return ((1.0 / 8800.0) * M_SQRT2 * (pow(mix[1], 2) - 5) * (99 * M_SQRT2 * pow(mix[2], 2) + 24 * sqrt(22) * mix[2] - 34 * M_SQRT2) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^- → 1 → 6
+double ang_dist_4_012(double theta, double phi, const double *mix) {
+  return ((1.0 / 14560.0) * M_SQRT2 * (pow(mix[1], 2) - 5) * (169 * M_SQRT2 * pow(mix[2], 2) + 14 * sqrt(130) * mix[2] - 63 * M_SQRT2) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^- → 2 → 0
+double ang_dist_4_013(double theta, double phi, const double *mix) {
+  return (pow(mix[1], 2) + (1.0 / 8.0) * (pow(mix[1], 2) - 1) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1) + 1) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^- → 2 → 1
+double ang_dist_4_014(double theta, double phi, const double *mix) {
+  return ((1.0 / 5600.0) * sqrt(70) * (pow(mix[1], 2) - 1) * (5 * sqrt(70) * pow(mix[2], 2) + 70 * sqrt(14) * mix[2] - 7 * sqrt(70)) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^- → 2 → 2
+double ang_dist_4_015(double theta, double phi, const double *mix) {
+  return ((1.0 / 39200.0) * sqrt(70) * (pow(mix[1], 2) - 1) * (-15 * sqrt(70) * pow(mix[2], 2) + 490 * sqrt(6) * mix[2] + 49 * sqrt(70)) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^- → 2 → 3
+double ang_dist_4_016(double theta, double phi, const double *mix) {
+  return (-1.0 / 19600.0 * sqrt(70) * (pow(mix[1], 2) - 1) * (20 * sqrt(70) * pow(mix[2], 2) + 140 * sqrt(21) * mix[2] + 7 * sqrt(70)) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^- → 2 → 4
+double ang_dist_4_017(double theta, double phi, const double *mix) {
+  return (-1.0 / 15680.0 * sqrt(70) * (pow(mix[1], 2) - 1) * (21 * sqrt(70) * pow(mix[2], 2) + 280 * M_SQRT2 * mix[2] - 8 * sqrt(70)) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^- → 2 → 5
+double ang_dist_4_018(double theta, double phi, const double *mix) {
+  return (-1.0 / 12320.0 * sqrt(70) * (pow(mix[1], 2) - 1) * (17 * sqrt(70) * pow(mix[2], 2) + 66 * sqrt(14) * mix[2] - 11 * sqrt(70)) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^- → 2 → 6
+double ang_dist_4_019(double theta, double phi, const double *mix) {
+  return (-1.0 / 800800.0 * sqrt(70) * (pow(mix[1], 2) - 1) * (1089 * sqrt(70) * pow(mix[2], 2) + 728 * sqrt(330) * mix[2] - 884 * sqrt(70)) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^- → 3 → 0
+double ang_dist_4_020(double theta, double phi, const double *mix) {
+  return (pow(mix[1], 2) + (1.0 / 80.0) * (15 * pow(mix[1], 2) - 12) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1) + 1) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^- → 3 → 1
+double ang_dist_4_021(double theta, double phi, const double *mix) {
+  return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + (1.0 / 2240.0) * sqrt(3) * (5 * pow(mix[1], 2) - 4) * (21 * sqrt(3) * pow(mix[2], 2) + 8 * sqrt(42) * mix[2] + 16 * sqrt(3)) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^- → 3 → 2
+double ang_dist_4_022(double theta, double phi, const double *mix) {
+  return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + (1.0 / 2800.0) * sqrt(3) * (5 * pow(mix[1], 2) - 4) * (5 * sqrt(3) * pow(mix[2], 2) + 42 * sqrt(10) * mix[2] - 14 * sqrt(3)) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^- → 3 → 3
+double ang_dist_4_023(double theta, double phi, const double *mix) {
+  return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + (1.0 / 1120.0) * (5 * pow(mix[1], 2) - 4) * (-11 * pow(mix[2], 2) + 42 * mix[2] + 21) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^- → 3 → 4
+double ang_dist_4_024(double theta, double phi, const double *mix) {
+  return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) - 1.0 / 1120.0 * (5 * pow(mix[1], 2) - 4) * (15 * pow(mix[2], 2) + 70 * mix[2] + 7) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^- → 3 → 5
+double ang_dist_4_025(double theta, double phi, const double *mix) {
+  return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) - 1.0 / 1344.0 * sqrt(3) * (5 * pow(mix[1], 2) - 4) * (7 * sqrt(3) * pow(mix[2], 2) + 8 * sqrt(21) * mix[2] - 4 * sqrt(3)) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^- → 3 → 6
+double ang_dist_4_026(double theta, double phi, const double *mix) {
+  return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) - 1.0 / 10560.0 * sqrt(3) * (5 * pow(mix[1], 2) - 4) * (51 * sqrt(3) * pow(mix[2], 2) + 22 * sqrt(105) * mix[2] - 55 * sqrt(3)) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^- → 4 → 0
+double ang_dist_4_027(double theta, double phi, const double *mix) {
+  return (pow(mix[1], 2) + (1.0 / 560.0) * (119 * pow(mix[1], 2) - 85) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1) + 1) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^- → 4 → 1
+double ang_dist_4_028(double theta, double phi, const double *mix) {
+  return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + (1.0 / 862400.0) * sqrt(77) * (7 * pow(mix[1], 2) - 5) * (289 * sqrt(77) * pow(mix[2], 2) + 110 * sqrt(231) * mix[2] + 275 * sqrt(77)) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^- → 4 → 2
+double ang_dist_4_029(double theta, double phi, const double *mix) {
+  return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + (1.0 / 109760.0) * sqrt(77) * (7 * pow(mix[1], 2) - 5) * (21 * sqrt(77) * pow(mix[2], 2) + 56 * sqrt(55) * mix[2] + 20 * sqrt(77)) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^- → 4 → 3
+double ang_dist_4_030(double theta, double phi, const double *mix) {
+  return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + (11.0 / 7840.0) * (7 * pow(mix[1], 2) - 5) * (pow(mix[2], 2) + 42 * mix[2] - 7) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^- → 4 → 4
+double ang_dist_4_031(double theta, double phi, const double *mix) {
+  return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + (1.0 / 3018400.0) * sqrt(77) * (7 * pow(mix[1], 2) - 5) * (-325 * sqrt(77) * pow(mix[2], 2) + 3234 * sqrt(5) * mix[2] + 539 * sqrt(77)) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^- → 4 → 5
+double ang_dist_4_032(double theta, double phi, const double *mix) {
+  return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) - 1.0 / 215600.0 * sqrt(77) * (7 * pow(mix[1], 2) - 5) * (25 * sqrt(77) * pow(mix[2], 2) + 42 * sqrt(770) * mix[2] + 14 * sqrt(77)) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^- → 4 → 6
+double ang_dist_4_033(double theta, double phi, const double *mix) {
+  return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) - 1.0 / 172480.0 * sqrt(77) * (7 * pow(mix[1], 2) - 5) * (21 * sqrt(77) * pow(mix[2], 2) + 56 * sqrt(154) * mix[2] - 16 * sqrt(77)) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^+ → 0 → 1
+double ang_dist_4_034(double theta, double phi, const double *mix) {
+  return 1 / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^+ → 0 → 2
+double ang_dist_4_035(double theta, double phi, const double *mix) {
+  return 1 / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^+ → 0 → 3
+double ang_dist_4_036(double theta, double phi, const double *mix) {
+  return 1 / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^+ → 0 → 4
+double ang_dist_4_037(double theta, double phi, const double *mix) {
+  return 1 / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^+ → 0 → 5
+double ang_dist_4_038(double theta, double phi, const double *mix) {
+  return 1 / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^+ → 0 → 6
+double ang_dist_4_039(double theta, double phi, const double *mix) {
+  return 1 / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^+ → 1 → 0
+double ang_dist_4_040(double theta, double phi, const double *mix) {
+  return (pow(mix[1], 2) + (1.0 / 40.0) * (pow(mix[1], 2) - 5) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) + 1) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^+ → 1 → 1
+double ang_dist_4_041(double theta, double phi, const double *mix) {
+  return (-1.0 / 80.0 * (pow(mix[1], 2) - 5) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (pow(mix[2], 2) + 6 * mix[2] + 1) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^+ → 1 → 2
+double ang_dist_4_042(double theta, double phi, const double *mix) {
+  return ((1.0 / 800.0) * M_SQRT2 * (pow(mix[1], 2) - 5) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (5 * M_SQRT2 * pow(mix[2], 2) + 6 * sqrt(10) * mix[2] + M_SQRT2) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^+ → 1 → 3
+double ang_dist_4_043(double theta, double phi, const double *mix) {
+  return ((1.0 / 2240.0) * M_SQRT2 * (pow(mix[1], 2) - 5) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (21 * M_SQRT2 * pow(mix[2], 2) + 16 * sqrt(7) * mix[2] - 4 * M_SQRT2) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^+ → 1 → 4
+double ang_dist_4_044(double theta, double phi, const double *mix) {
+  return ((1.0 / 1600.0) * M_SQRT2 * (pow(mix[1], 2) - 5) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (17 * M_SQRT2 * pow(mix[2], 2) + 10 * sqrt(6) * mix[2] - 5 * M_SQRT2) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^+ → 1 → 5
+double ang_dist_4_045(double theta, double phi, const double *mix) {
+  return ((1.0 / 8800.0) * M_SQRT2 * (pow(mix[1], 2) - 5) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (99 * M_SQRT2 * pow(mix[2], 2) + 24 * sqrt(22) * mix[2] - 34 * M_SQRT2) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^+ → 1 → 6
+double ang_dist_4_046(double theta, double phi, const double *mix) {
+  return ((1.0 / 14560.0) * M_SQRT2 * (pow(mix[1], 2) - 5) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (169 * M_SQRT2 * pow(mix[2], 2) + 14 * sqrt(130) * mix[2] - 63 * M_SQRT2) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^+ → 2 → 0
+double ang_dist_4_047(double theta, double phi, const double *mix) {
+  return (pow(mix[1], 2) + (1.0 / 8.0) * (pow(mix[1], 2) - 1) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) + 1) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^+ → 2 → 1
+double ang_dist_4_048(double theta, double phi, const double *mix) {
+  return ((1.0 / 5600.0) * sqrt(70) * (pow(mix[1], 2) - 1) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (5 * sqrt(70) * pow(mix[2], 2) + 70 * sqrt(14) * mix[2] - 7 * sqrt(70)) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^+ → 2 → 2
+double ang_dist_4_049(double theta, double phi, const double *mix) {
+  return ((1.0 / 39200.0) * sqrt(70) * (pow(mix[1], 2) - 1) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (-15 * sqrt(70) * pow(mix[2], 2) + 490 * sqrt(6) * mix[2] + 49 * sqrt(70)) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^+ → 2 → 3
+double ang_dist_4_050(double theta, double phi, const double *mix) {
+  return (-1.0 / 19600.0 * sqrt(70) * (pow(mix[1], 2) - 1) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (20 * sqrt(70) * pow(mix[2], 2) + 140 * sqrt(21) * mix[2] + 7 * sqrt(70)) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^+ → 2 → 4
+double ang_dist_4_051(double theta, double phi, const double *mix) {
+  return (-1.0 / 15680.0 * sqrt(70) * (pow(mix[1], 2) - 1) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (21 * sqrt(70) * pow(mix[2], 2) + 280 * M_SQRT2 * mix[2] - 8 * sqrt(70)) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^+ → 2 → 5
+double ang_dist_4_052(double theta, double phi, const double *mix) {
+  return (-1.0 / 12320.0 * sqrt(70) * (pow(mix[1], 2) - 1) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (17 * sqrt(70) * pow(mix[2], 2) + 66 * sqrt(14) * mix[2] - 11 * sqrt(70)) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^+ → 2 → 6
+double ang_dist_4_053(double theta, double phi, const double *mix) {
+  return (-1.0 / 800800.0 * sqrt(70) * (pow(mix[1], 2) - 1) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (1089 * sqrt(70) * pow(mix[2], 2) + 728 * sqrt(330) * mix[2] - 884 * sqrt(70)) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^+ → 3 → 0
+double ang_dist_4_054(double theta, double phi, const double *mix) {
+  return (pow(mix[1], 2) + (1.0 / 80.0) * (15 * pow(mix[1], 2) - 12) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) + 1) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^+ → 3 → 1
+double ang_dist_4_055(double theta, double phi, const double *mix) {
+  return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + (1.0 / 2240.0) * sqrt(3) * (5 * pow(mix[1], 2) - 4) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (21 * sqrt(3) * pow(mix[2], 2) + 8 * sqrt(42) * mix[2] + 16 * sqrt(3))) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^+ → 3 → 2
+double ang_dist_4_056(double theta, double phi, const double *mix) {
+  return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + (1.0 / 2800.0) * sqrt(3) * (5 * pow(mix[1], 2) - 4) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (5 * sqrt(3) * pow(mix[2], 2) + 42 * sqrt(10) * mix[2] - 14 * sqrt(3))) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^+ → 3 → 3
+double ang_dist_4_057(double theta, double phi, const double *mix) {
+  return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + (1.0 / 1120.0) * (5 * pow(mix[1], 2) - 4) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (-11 * pow(mix[2], 2) + 42 * mix[2] + 21)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^+ → 3 → 4
+double ang_dist_4_058(double theta, double phi, const double *mix) {
+  return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) - 1.0 / 1120.0 * (5 * pow(mix[1], 2) - 4) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (15 * pow(mix[2], 2) + 70 * mix[2] + 7)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^+ → 3 → 5
+double ang_dist_4_059(double theta, double phi, const double *mix) {
+  return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) - 1.0 / 1344.0 * sqrt(3) * (5 * pow(mix[1], 2) - 4) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (7 * sqrt(3) * pow(mix[2], 2) + 8 * sqrt(21) * mix[2] - 4 * sqrt(3))) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^+ → 3 → 6
+double ang_dist_4_060(double theta, double phi, const double *mix) {
+  return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) - 1.0 / 10560.0 * sqrt(3) * (5 * pow(mix[1], 2) - 4) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (51 * sqrt(3) * pow(mix[2], 2) + 22 * sqrt(105) * mix[2] - 55 * sqrt(3))) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^+ → 4 → 0
+double ang_dist_4_061(double theta, double phi, const double *mix) {
+  return (pow(mix[1], 2) + (1.0 / 560.0) * (119 * pow(mix[1], 2) - 85) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) + 1) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^+ → 4 → 1
+double ang_dist_4_062(double theta, double phi, const double *mix) {
+  return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + (1.0 / 862400.0) * sqrt(77) * (7 * pow(mix[1], 2) - 5) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (289 * sqrt(77) * pow(mix[2], 2) + 110 * sqrt(231) * mix[2] + 275 * sqrt(77))) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^+ → 4 → 2
+double ang_dist_4_063(double theta, double phi, const double *mix) {
+  return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + (1.0 / 109760.0) * sqrt(77) * (7 * pow(mix[1], 2) - 5) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (21 * sqrt(77) * pow(mix[2], 2) + 56 * sqrt(55) * mix[2] + 20 * sqrt(77))) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^+ → 4 → 3
+double ang_dist_4_064(double theta, double phi, const double *mix) {
+  return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + (11.0 / 7840.0) * (7 * pow(mix[1], 2) - 5) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (pow(mix[2], 2) + 42 * mix[2] - 7)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^+ → 4 → 4
+double ang_dist_4_065(double theta, double phi, const double *mix) {
+  return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + (1.0 / 3018400.0) * sqrt(77) * (7 * pow(mix[1], 2) - 5) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (-325 * sqrt(77) * pow(mix[2], 2) + 3234 * sqrt(5) * mix[2] + 539 * sqrt(77))) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^+ → 4 → 5
+double ang_dist_4_066(double theta, double phi, const double *mix) {
+  return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) - 1.0 / 215600.0 * sqrt(77) * (7 * pow(mix[1], 2) - 5) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (25 * sqrt(77) * pow(mix[2], 2) + 42 * sqrt(770) * mix[2] + 14 * sqrt(77))) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 1^+ → 4 → 6
+double ang_dist_4_067(double theta, double phi, const double *mix) {
+  return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) - 1.0 / 172480.0 * sqrt(77) * (7 * pow(mix[1], 2) - 5) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (21 * sqrt(77) * pow(mix[2], 2) + 56 * sqrt(154) * mix[2] - 16 * sqrt(77))) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 2^+ → 0 → 1
+double ang_dist_4_068(double theta, double phi, const double *mix) {
+  return 1 / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 2^+ → 0 → 2
+double ang_dist_4_069(double theta, double phi, const double *mix) {
+  return 1 / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 2^+ → 0 → 3
+double ang_dist_4_070(double theta, double phi, const double *mix) {
+  return 1 / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 2^+ → 0 → 4
+double ang_dist_4_071(double theta, double phi, const double *mix) {
+  return 1 / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 2^+ → 0 → 5
+double ang_dist_4_072(double theta, double phi, const double *mix) {
+  return 1 / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 2^+ → 0 → 6
+double ang_dist_4_073(double theta, double phi, const double *mix) {
+  return 1 / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 2^+ → 1 → 0
+double ang_dist_4_074(double theta, double phi, const double *mix) {
+  return (pow(mix[1], 2) + (1.0 / 8.0) * (pow(mix[1], 2) - 1) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) + 1) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 2^+ → 1 → 1
+double ang_dist_4_075(double theta, double phi, const double *mix) {
+  return (-1.0 / 16.0 * (pow(mix[1], 2) - 1) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (pow(mix[2], 2) + 6 * mix[2] + 1) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 2^+ → 1 → 2
+double ang_dist_4_076(double theta, double phi, const double *mix) {
+  return ((1.0 / 160.0) * M_SQRT2 * (pow(mix[1], 2) - 1) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (5 * M_SQRT2 * pow(mix[2], 2) + 6 * sqrt(10) * mix[2] + M_SQRT2) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 2^+ → 1 → 3
+double ang_dist_4_077(double theta, double phi, const double *mix) {
+  return ((1.0 / 448.0) * M_SQRT2 * (pow(mix[1], 2) - 1) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (21 * M_SQRT2 * pow(mix[2], 2) + 16 * sqrt(7) * mix[2] - 4 * M_SQRT2) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 2^+ → 1 → 4
+double ang_dist_4_078(double theta, double phi, const double *mix) {
+  return ((1.0 / 320.0) * M_SQRT2 * (pow(mix[1], 2) - 1) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (17 * M_SQRT2 * pow(mix[2], 2) + 10 * sqrt(6) * mix[2] - 5 * M_SQRT2) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 2^+ → 1 → 5
+double ang_dist_4_079(double theta, double phi, const double *mix) {
+  return ((1.0 / 1760.0) * M_SQRT2 * (pow(mix[1], 2) - 1) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (99 * M_SQRT2 * pow(mix[2], 2) + 24 * sqrt(22) * mix[2] - 34 * M_SQRT2) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 2^+ → 1 → 6
+double ang_dist_4_080(double theta, double phi, const double *mix) {
+  return ((1.0 / 2912.0) * M_SQRT2 * (pow(mix[1], 2) - 1) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (169 * M_SQRT2 * pow(mix[2], 2) + 14 * sqrt(130) * mix[2] - 63 * M_SQRT2) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 2^+ → 2 → 0
+double ang_dist_4_081(double theta, double phi, const double *mix) {
+  return (1.0 / 1176.0) * (1176 * pow(mix[1], 2) + (-45 * pow(mix[1], 2) + 105) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) + (48 * pow(mix[1], 2) - 112) * (-5 * (7 * pow(cos(theta), 2) - 1) * pow(sin(theta), 2) * cos(2 * phi) + 35 * pow(cos(theta), 4) - 30 * pow(cos(theta), 2) + 3) + 1176) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 2^+ → 2 → 1
+double ang_dist_4_082(double theta, double phi, const double *mix) {
+  return (-4.0 / 441.0 * pow(mix[2], 2) * (3 * pow(mix[1], 2) - 7) * (-5 * (7 * pow(cos(theta), 2) - 1) * pow(sin(theta), 2) * cos(2 * phi) + 35 * pow(cos(theta), 4) - 30 * pow(cos(theta), 2) + 3) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) - 1.0 / 54880.0 * sqrt(70) * (3 * pow(mix[1], 2) - 7) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (5 * sqrt(70) * pow(mix[2], 2) + 70 * sqrt(14) * mix[2] - 7 * sqrt(70))) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 2^+ → 2 → 2
+double ang_dist_4_083(double theta, double phi, const double *mix) {
+  return ((4.0 / 1029.0) * pow(mix[2], 2) * (3 * pow(mix[1], 2) - 7) * (-5 * (7 * pow(cos(theta), 2) - 1) * pow(sin(theta), 2) * cos(2 * phi) + 35 * pow(cos(theta), 4) - 30 * pow(cos(theta), 2) + 3) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) - 1.0 / 384160.0 * sqrt(70) * (3 * pow(mix[1], 2) - 7) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (-15 * sqrt(70) * pow(mix[2], 2) + 490 * sqrt(6) * mix[2] + 49 * sqrt(70))) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 2^+ → 2 → 3
+double ang_dist_4_084(double theta, double phi, const double *mix) {
+  return (-1.0 / 1029.0 * pow(mix[2], 2) * (3 * pow(mix[1], 2) - 7) * (-5 * (7 * pow(cos(theta), 2) - 1) * pow(sin(theta), 2) * cos(2 * phi) + 35 * pow(cos(theta), 4) - 30 * pow(cos(theta), 2) + 3) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + (1.0 / 192080.0) * sqrt(70) * (3 * pow(mix[1], 2) - 7) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (20 * sqrt(70) * pow(mix[2], 2) + 140 * sqrt(21) * mix[2] + 7 * sqrt(70))) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 2^+ → 2 → 4
+double ang_dist_4_085(double theta, double phi, const double *mix) {
+  return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + (1.0 / 153664.0) * sqrt(70) * (3 * pow(mix[1], 2) - 7) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (21 * sqrt(70) * pow(mix[2], 2) + 280 * M_SQRT2 * mix[2] - 8 * sqrt(70)) + (1.0 / 259308.0) * sqrt(14) * (3 * pow(mix[1], 2) - 7) * (7 * sqrt(14) * pow(mix[2], 2) + 35 * sqrt(10) * mix[2] + 2 * sqrt(14)) * (-5 * (7 * pow(cos(theta), 2) - 1) * pow(sin(theta), 2) * cos(2 * phi) + 35 * pow(cos(theta), 4) - 30 * pow(cos(theta), 2) + 3)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 2^+ → 2 → 5
+double ang_dist_4_086(double theta, double phi, const double *mix) {
+  return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + (1.0 / 120736.0) * sqrt(70) * (3 * pow(mix[1], 2) - 7) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (17 * sqrt(70) * pow(mix[2], 2) + 66 * sqrt(14) * mix[2] - 11 * sqrt(70)) + (1.0 / 271656.0) * sqrt(14) * (3 * pow(mix[1], 2) - 7) * (27 * sqrt(14) * pow(mix[2], 2) + 18 * sqrt(70) * mix[2] - sqrt(14)) * (-5 * (7 * pow(cos(theta), 2) - 1) * pow(sin(theta), 2) * cos(2 * phi) + 35 * pow(cos(theta), 4) - 30 * pow(cos(theta), 2) + 3)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 2^+ → 2 → 6
+double ang_dist_4_087(double theta, double phi, const double *mix) {
+  return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + (1.0 / 7847840.0) * sqrt(70) * (3 * pow(mix[1], 2) - 7) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (1089 * sqrt(70) * pow(mix[2], 2) + 728 * sqrt(330) * mix[2] - 884 * sqrt(70)) + (1.0 / 588588.0) * sqrt(14) * (3 * pow(mix[1], 2) - 7) * (88 * sqrt(14) * pow(mix[2], 2) + 42 * sqrt(66) * mix[2] - 9 * sqrt(14)) * (-5 * (7 * pow(cos(theta), 2) - 1) * pow(sin(theta), 2) * cos(2 * phi) + 35 * pow(cos(theta), 4) - 30 * pow(cos(theta), 2) + 3)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 2^+ → 3 → 0
+double ang_dist_4_088(double theta, double phi, const double *mix) {
+  return (1.0 / 168.0) * (168 * pow(mix[1], 2) + (3 * pow(mix[1], 2) - 2) * (-5 * (7 * pow(cos(theta), 2) - 1) * pow(sin(theta), 2) * cos(2 * phi) + 35 * pow(cos(theta), 4) - 30 * pow(cos(theta), 2) + 3) + (9 * pow(mix[1], 2) + 36) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) + 168) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 2^+ → 3 → 1
+double ang_dist_4_089(double theta, double phi, const double *mix) {
+  return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + (1.0 / 1568.0) * sqrt(3) * (pow(mix[1], 2) + 4) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (21 * sqrt(3) * pow(mix[2], 2) + 8 * sqrt(42) * mix[2] + 16 * sqrt(3)) + (1.0 / 155232.0) * sqrt(22) * (3 * pow(mix[1], 2) - 2) * (7 * sqrt(22) * pow(mix[2], 2) + 220 * sqrt(77) * mix[2] - 88 * sqrt(22)) * (-5 * (7 * pow(cos(theta), 2) - 1) * pow(sin(theta), 2) * cos(2 * phi) + 35 * pow(cos(theta), 4) - 30 * pow(cos(theta), 2) + 3)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 2^+ → 3 → 2
+double ang_dist_4_090(double theta, double phi, const double *mix) {
+  return ((11.0 / 588.0) * pow(mix[2], 2) * (3 * pow(mix[1], 2) - 2) * (-5 * (7 * pow(cos(theta), 2) - 1) * pow(sin(theta), 2) * cos(2 * phi) + 35 * pow(cos(theta), 4) - 30 * pow(cos(theta), 2) + 3) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + (1.0 / 1960.0) * sqrt(3) * (pow(mix[1], 2) + 4) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (5 * sqrt(3) * pow(mix[2], 2) + 42 * sqrt(10) * mix[2] - 14 * sqrt(3))) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 2^+ → 3 → 3
+double ang_dist_4_091(double theta, double phi, const double *mix) {
+  return (-11.0 / 882.0 * pow(mix[2], 2) * (3 * pow(mix[1], 2) - 2) * (-5 * (7 * pow(cos(theta), 2) - 1) * pow(sin(theta), 2) * cos(2 * phi) + 35 * pow(cos(theta), 4) - 30 * pow(cos(theta), 2) + 3) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + (1.0 / 784.0) * (pow(mix[1], 2) + 4) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (-11 * pow(mix[2], 2) + 42 * mix[2] + 21)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 2^+ → 3 → 4
+double ang_dist_4_092(double theta, double phi, const double *mix) {
+  return ((11.0 / 2646.0) * pow(mix[2], 2) * (3 * pow(mix[1], 2) - 2) * (-5 * (7 * pow(cos(theta), 2) - 1) * pow(sin(theta), 2) * cos(2 * phi) + 35 * pow(cos(theta), 4) - 30 * pow(cos(theta), 2) + 3) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) - 1.0 / 784.0 * (pow(mix[1], 2) + 4) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (15 * pow(mix[2], 2) + 70 * mix[2] + 7)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 2^+ → 3 → 5
+double ang_dist_4_093(double theta, double phi, const double *mix) {
+  return (1.0 / 1707552.0) * (1707552 * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) - 1815 * sqrt(3) * (pow(mix[1], 2) + 4) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (7 * sqrt(3) * pow(mix[2], 2) + 8 * sqrt(21) * mix[2] - 4 * sqrt(3)) - sqrt(22) * (3 * pow(mix[1], 2) - 2) * (119 * sqrt(22) * pow(mix[2], 2) + 220 * sqrt(154) * mix[2] + 44 * sqrt(22)) * (-5 * (7 * pow(cos(theta), 2) - 1) * pow(sin(theta), 2) * cos(2 * phi) + 35 * pow(cos(theta), 4) - 30 * pow(cos(theta), 2) + 3)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 2^+ → 3 → 6
+double ang_dist_4_094(double theta, double phi, const double *mix) {
+  return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) - 1.0 / 7392.0 * sqrt(3) * (pow(mix[1], 2) + 4) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (51 * sqrt(3) * pow(mix[2], 2) + 22 * sqrt(105) * mix[2] - 55 * sqrt(3)) - 1.0 / 1057056.0 * sqrt(22) * (3 * pow(mix[1], 2) - 2) * (261 * sqrt(22) * pow(mix[2], 2) + 78 * sqrt(770) * mix[2] - 13 * sqrt(22)) * (-5 * (7 * pow(cos(theta), 2) - 1) * pow(sin(theta), 2) * cos(2 * phi) + 35 * pow(cos(theta), 4) - 30 * pow(cos(theta), 2) + 3)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 2^+ → 4 → 0
+double ang_dist_4_095(double theta, double phi, const double *mix) {
+  return (1.0 / 784.0) * (784 * pow(mix[1], 2) + (17 * pow(mix[1], 2) + 170) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) + (36 * pow(mix[1], 2) - 18) * (-5 * (7 * pow(cos(theta), 2) - 1) * pow(sin(theta), 2) * cos(2 * phi) + 35 * pow(cos(theta), 4) - 30 * pow(cos(theta), 2) + 3) + 784) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 2^+ → 4 → 1
+double ang_dist_4_096(double theta, double phi, const double *mix) {
+  return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + (1.0 / 1207360.0) * sqrt(77) * (pow(mix[1], 2) + 10) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (289 * sqrt(77) * pow(mix[2], 2) + 110 * sqrt(231) * mix[2] + 275 * sqrt(77)) + (1.0 / 4708704.0) * sqrt(2002) * (2 * pow(mix[1], 2) - 1) * (27 * sqrt(2002) * pow(mix[2], 2) + 78 * sqrt(6006) * mix[2] + 13 * sqrt(2002)) * (-5 * (7 * pow(cos(theta), 2) - 1) * pow(sin(theta), 2) * cos(2 * phi) + 35 * pow(cos(theta), 4) - 30 * pow(cos(theta), 2) + 3)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 2^+ → 4 → 2
+double ang_dist_4_097(double theta, double phi, const double *mix) {
+  return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + (1.0 / 153664.0) * sqrt(77) * (pow(mix[1], 2) + 10) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (21 * sqrt(77) * pow(mix[2], 2) + 56 * sqrt(55) * mix[2] + 20 * sqrt(77)) - 1.0 / 7606368.0 * sqrt(2002) * (2 * pow(mix[1], 2) - 1) * (7 * sqrt(2002) * pow(mix[2], 2) - 308 * sqrt(1430) * mix[2] + 44 * sqrt(2002)) * (-5 * (7 * pow(cos(theta), 2) - 1) * pow(sin(theta), 2) * cos(2 * phi) + 35 * pow(cos(theta), 4) - 30 * pow(cos(theta), 2) + 3)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 2^+ → 4 → 3
+double ang_dist_4_098(double theta, double phi, const double *mix) {
+  return (1.0 / 98784.0) * (2288 * pow(mix[2], 2) * (2 * pow(mix[1], 2) - 1) * (-5 * (7 * pow(cos(theta), 2) - 1) * pow(sin(theta), 2) * cos(2 * phi) + 35 * pow(cos(theta), 4) - 30 * pow(cos(theta), 2) + 3) + 98784 * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + 99 * (pow(mix[1], 2) + 10) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (pow(mix[2], 2) + 42 * mix[2] - 7)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 2^+ → 4 → 4
+double ang_dist_4_099(double theta, double phi, const double *mix) {
+  return (1.0 / 4225760.0) * (-80080 * pow(mix[2], 2) * (2 * pow(mix[1], 2) - 1) * (-5 * (7 * pow(cos(theta), 2) - 1) * pow(sin(theta), 2) * cos(2 * phi) + 35 * pow(cos(theta), 4) - 30 * pow(cos(theta), 2) + 3) + 4225760 * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + sqrt(77) * (pow(mix[1], 2) + 10) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (-325 * sqrt(77) * pow(mix[2], 2) + 3234 * sqrt(5) * mix[2] + 539 * sqrt(77))) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 2^+ → 4 → 5
+double ang_dist_4_100(double theta, double phi, const double *mix) {
+  return ((13.0 / 1764.0) * pow(mix[2], 2) * (2 * pow(mix[1], 2) - 1) * (-5 * (7 * pow(cos(theta), 2) - 1) * pow(sin(theta), 2) * cos(2 * phi) + 35 * pow(cos(theta), 4) - 30 * pow(cos(theta), 2) + 3) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) - 1.0 / 301840.0 * sqrt(77) * (pow(mix[1], 2) + 10) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (25 * sqrt(77) * pow(mix[2], 2) + 42 * sqrt(770) * mix[2] + 14 * sqrt(77))) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// 0^+ → 2^+ → 4 → 6
+double ang_dist_4_101(double theta, double phi, const double *mix) {
+  return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) - 1.0 / 241472.0 * sqrt(77) * (pow(mix[1], 2) + 10) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (21 * sqrt(77) * pow(mix[2], 2) + 56 * sqrt(154) * mix[2] - 16 * sqrt(77)) - 1.0 / 155387232.0 * sqrt(2002) * (2 * pow(mix[1], 2) - 1) * (203 * sqrt(2002) * pow(mix[2], 2) + 1540 * sqrt(1001) * mix[2] + 88 * sqrt(2002)) * (-5 * (7 * pow(cos(theta), 2) - 1) * pow(sin(theta), 2) * cos(2 * phi) + 35 * pow(cos(theta), 4) - 30 * pow(cos(theta), 2) + 3)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
+}
+
+// Evaluate an angular distribution for a batch of directions.
+// Since the function is a template parameter, it can be inlined into the loop, which avoids an
+// indirect call per direction and allows the compiler to vectorize the loop.
+template <AngDistFunction ang_dist>
+void ang_dist_batch(const double *theta, const double *phi, const double *mix, double *w, unsigned int n) {
+  for (unsigned int i = 0; i < n; ++i)
+    w[i] = ang_dist(theta[i], phi[i], mix);
+}
+
+struct AngDistBatchEntry {
+  AngDistFunction ang_dist;
+  AngDistBatchFunction ang_dist_batch;
+};
+
+const AngDistBatchEntry ang_dist_batch_functions[] = {
+    {ang_dist_3_000, ang_dist_batch<ang_dist_3_000>},
+    {ang_dist_3_001, ang_dist_batch<ang_dist_3_001>},
+    {ang_dist_3_002, ang_dist_batch<ang_dist_3_002>},
+    {ang_dist_3_003, ang_dist_batch<ang_dist_3_003>},
+    {ang_dist_3_004, ang_dist_batch<ang_dist_3_004>},
+    {ang_dist_3_005, ang_dist_batch<ang_dist_3_005>},
+    {ang_dist_3_006, ang_dist_batch<ang_dist_3_006>},
+    {ang_dist_3_007, ang_dist_batch<ang_dist_3_007>},
+    {ang_dist_3_008, ang_dist_batch<ang_dist_3_008>},
+    {ang_dist_3_009, ang_dist_batch<ang_dist_3_009>},
+    {ang_dist_3_010, ang_dist_batch<ang_dist_3_010>},
+    {ang_dist_3_011, ang_dist_batch<ang_dist_3_011>},
+    {ang_dist_3_012, ang_dist_batch<ang_dist_3_012>},
+    {ang_dist_3_013, ang_dist_batch<ang_dist_3_013>},
+    {ang_dist_3_014, ang_dist_batch<ang_dist_3_014>},
+    {ang_dist_3_015, ang_dist_batch<ang_dist_3_015>},
+    {ang_dist_3_016, ang_dist_batch<ang_dist_3_016>},
+    {ang_dist_3_017, ang_dist_batch<ang_dist_3_017>},
+    {ang_dist_3_018, ang_dist_batch<ang_dist_3_018>},
+    {ang_dist_3_019, ang_dist_batch<ang_dist_3_019>},
+    {ang_dist_3_020, ang_dist_batch<ang_dist_3_020>},
+    {ang_dist_3_021, ang_dist_batch<ang_dist_3_021>},
+    {ang_dist_3_022, ang_dist_batch<ang_dist_3_022>},
+    {ang_dist_3_023, ang_dist_batch<ang_dist_3_023>},
+    {ang_dist_3_024, ang_dist_batch<ang_dist_3_024>},
+    {ang_dist_3_025, ang_dist_batch<ang_dist_3_025>},
+    {ang_dist_4_000, ang_dist_batch<ang_dist_4_000>},
+    {ang_dist_4_001, ang_dist_batch<ang_dist_4_001>},
+    {ang_dist_4_002, ang_dist_batch<ang_dist_4_002>},
+    {ang_dist_4_003, ang_dist_batch<ang_dist_4_003>},
+    {ang_dist_4_004, ang_dist_batch<ang_dist_4_004>},
+    {ang_dist_4_005, ang_dist_batch<ang_dist_4_005>},
+    {ang_dist_4_006, ang_dist_batch<ang_dist_4_006>},
+    {ang_dist_4_007, ang_dist_batch<ang_dist_4_007>},
+    {ang_dist_4_008, ang_dist_batch<ang_dist_4_008>},
+    {ang_dist_4_009, ang_dist_batch<ang_dist_4_009>},
+    {ang_dist_4_010, ang_dist_batch<ang_dist_4_010>},
+    {ang_dist_4_011, ang_dist_batch<ang_dist_4_011>},
+    {ang_dist_4_012, ang_dist_batch<ang_dist_4_012>},
+    {ang_dist_4_013, ang_dist_batch<ang_dist_4_013>},
+    {ang_dist_4_014, ang_dist_batch<ang_dist_4_014>},
+    {ang_dist_4_015, ang_dist_batch<ang_dist_4_015>},
+    {ang_dist_4_016, ang_dist_batch<ang_dist_4_016>},
+    {ang_dist_4_017, ang_dist_batch<ang_dist_4_017>},
+    {ang_dist_4_018, ang_dist_batch<ang_dist_4_018>},
+    {ang_dist_4_019, ang_dist_batch<ang_dist_4_019>},
+    {ang_dist_4_020, ang_dist_batch<ang_dist_4_020>},
+    {ang_dist_4_021, ang_dist_batch<ang_dist_4_021>},
+    {ang_dist_4_022, ang_dist_batch<ang_dist_4_022>},
+    {ang_dist_4_023, ang_dist_batch<ang_dist_4_023>},
+    {ang_dist_4_024, ang_dist_batch<ang_dist_4_024>},
+    {ang_dist_4_025, ang_dist_batch<ang_dist_4_025>},
+    {ang_dist_4_026, ang_dist_batch<ang_dist_4_026>},
+    {ang_dist_4_027, ang_dist_batch<ang_dist_4_027>},
+    {ang_dist_4_028, ang_dist_batch<ang_dist_4_028>},
+    {ang_dist_4_029, ang_dist_batch<ang_dist_4_029>},
+    {ang_dist_4_030, ang_dist_batch<ang_dist_4_030>},
+    {ang_dist_4_031, ang_dist_batch<ang_dist_4_031>},
+    {ang_dist_4_032, ang_dist_batch<ang_dist_4_032>},
+    {ang_dist_4_033, ang_dist_batch<ang_dist_4_033>},
+    {ang_dist_4_034, ang_dist_batch<ang_dist_4_034>},
+    {ang_dist_4_035, ang_dist_batch<ang_dist_4_035>},
+    {ang_dist_4_036, ang_dist_batch<ang_dist_4_036>},
+    {ang_dist_4_037, ang_dist_batch<ang_dist_4_037>},
+    {ang_dist_4_038, ang_dist_batch<ang_dist_4_038>},
+    {ang_dist_4_039, ang_dist_batch<ang_dist_4_039>},
+    {ang_dist_4_040, ang_dist_batch<ang_dist_4_040>},
+    {ang_dist_4_041, ang_dist_batch<ang_dist_4_041>},
+    {ang_dist_4_042, ang_dist_batch<ang_dist_4_042>},
+    {ang_dist_4_043, ang_dist_batch<ang_dist_4_043>},
+    {ang_dist_4_044, ang_dist_batch<ang_dist_4_044>},
+    {ang_dist_4_045, ang_dist_batch<ang_dist_4_045>},
+    {ang_dist_4_046, ang_dist_batch<ang_dist_4_046>},
+    {ang_dist_4_047, ang_dist_batch<ang_dist_4_047>},
+    {ang_dist_4_048, ang_dist_batch<ang_dist_4_048>},
+    {ang_dist_4_049, ang_dist_batch<ang_dist_4_049>},
+    {ang_dist_4_050, ang_dist_batch<ang_dist_4_050>},
+    {ang_dist_4_051, ang_dist_batch<ang_dist_4_051>},
+    {ang_dist_4_052, ang_dist_batch<ang_dist_4_052>},
+    {ang_dist_4_053, ang_dist_batch<ang_dist_4_053>},
+    {ang_dist_4_054, ang_dist_batch<ang_dist_4_054>},
+    {ang_dist_4_055, ang_dist_batch<ang_dist_4_055>},
+    {ang_dist_4_056, ang_dist_batch<ang_dist_4_056>},
+    {ang_dist_4_057, ang_dist_batch<ang_dist_4_057>},
+    {ang_dist_4_058, ang_dist_batch<ang_dist_4_058>},
+    {ang_dist_4_059, ang_dist_batch<ang_dist_4_059>},
+    {ang_dist_4_060, ang_dist_batch<ang_dist_4_060>},
+    {ang_dist_4_061, ang_dist_batch<ang_dist_4_061>},
+    {ang_dist_4_062, ang_dist_batch<ang_dist_4_062>},
+    {ang_dist_4_063, ang_dist_batch<ang_dist_4_063>},
+    {ang_dist_4_064, ang_dist_batch<ang_dist_4_064>},
+    {ang_dist_4_065, ang_dist_batch<ang_dist_4_065>},
+    {ang_dist_4_066, ang_dist_batch<ang_dist_4_066>},
+    {ang_dist_4_067, ang_dist_batch<ang_dist_4_067>},
+    {ang_dist_4_068, ang_dist_batch<ang_dist_4_068>},
+    {ang_dist_4_069, ang_dist_batch<ang_dist_4_069>},
+    {ang_dist_4_070, ang_dist_batch<ang_dist_4_070>},
+    {ang_dist_4_071, ang_dist_batch<ang_dist_4_071>},
+    {ang_dist_4_072, ang_dist_batch<ang_dist_4_072>},
+    {ang_dist_4_073, ang_dist_batch<ang_dist_4_073>},
+    {ang_dist_4_074, ang_dist_batch<ang_dist_4_074>},
+    {ang_dist_4_075, ang_dist_batch<ang_dist_4_075>},
+    {ang_dist_4_076, ang_dist_batch<ang_dist_4_076>},
+    {ang_dist_4_077, ang_dist_batch<ang_dist_4_077>},
+    {ang_dist_4_078, ang_dist_batch<ang_dist_4_078>},
+    {ang_dist_4_079, ang_dist_batch<ang_dist_4_079>},
+    {ang_dist_4_080, ang_dist_batch<ang_dist_4_080>},
+    {ang_dist_4_081, ang_dist_batch<ang_dist_4_081>},
+    {ang_dist_4_082, ang_dist_batch<ang_dist_4_082>},
+    {ang_dist_4_083, ang_dist_batch<ang_dist_4_083>},
+    {ang_dist_4_084, ang_dist_batch<ang_dist_4_084>},
+    {ang_dist_4_085, ang_dist_batch<ang_dist_4_085>},
+    {ang_dist_4_086, ang_dist_batch<ang_dist_4_086>},
+    {ang_dist_4_087, ang_dist_batch<ang_dist_4_087>},
+    {ang_dist_4_088, ang_dist_batch<ang_dist_4_088>},
+    {ang_dist_4_089, ang_dist_batch<ang_dist_4_089>},
+    {ang_dist_4_090, ang_dist_batch<ang_dist_4_090>},
+    {ang_dist_4_091, ang_dist_batch<ang_dist_4_091>},
+    {ang_dist_4_092, ang_dist_batch<ang_dist_4_092>},
+    {ang_dist_4_093, ang_dist_batch<ang_dist_4_093>},
+    {ang_dist_4_094, ang_dist_batch<ang_dist_4_094>},
+    {ang_dist_4_095, ang_dist_batch<ang_dist_4_095>},
+    {ang_dist_4_096, ang_dist_batch<ang_dist_4_096>},
+    {ang_dist_4_097, ang_dist_batch<ang_dist_4_097>},
+    {ang_dist_4_098, ang_dist_batch<ang_dist_4_098>},
+    {ang_dist_4_099, ang_dist_batch<ang_dist_4_099>},
+    {ang_dist_4_100, ang_dist_batch<ang_dist_4_100>},
+    {ang_dist_4_101, ang_dist_batch<ang_dist_4_101>},
+};
+
+} // namespace
+
+AngDistFunction AngularDistribution::GetAngDistFunction(const double *st, int nst) const {
 
   if (nst == 3) {
     // 0.1^+ -> 0.1^+ -> 0.1^+
     // Wildcard for test distributions
-    if (st[0] == 0.1 && st[1] == 0.1 && st[2] == 0.1) {
-      if (theta >= 85. * DEGREE_TO_RAD && theta <= 95. * DEGREE_TO_RAD &&
-          ((phi >= 355. * DEGREE_TO_RAD && phi <= 360. * DEGREE_TO_RAD) ||
-           (phi >= 0. * DEGREE_TO_RAD && phi <= 5. * DEGREE_TO_RAD))) {
-        return 1.;
-      }
-
-      return 0.;
-    }
-
+    if (st[0] == 0.1 && st[1] == 0.1 && st[2] == 0.1)
+      return ang_dist_3_000;
     // 0^+ -> 0^+ -> 0^+
     // Isotropic distribution
     if ((st[0] == 0. && st[1] == 0. && st[2] == 0.) ||
-        (st[0] == -0.1 && st[1] == -0.1 && st[2] == -0.1)) {
-      return 1.;
-    }
-
+        (st[0] == -0.1 && st[1] == -0.1 && st[2] == -0.1))
+      return ang_dist_3_001;
     // 0^+ -> 1^+ -> 0^+ or 0^- -> 1^- -> 0^-
     if ((st[0] == 0. && st[1] == 1. && st[2] == 0.) ||
-        (st[0] == -0.1 && st[1] == -1. && st[2] == -0.1)) {
-      return 0.75 * (1 + pow(cos(theta), 2) +
-                     pow(sin(theta), 2) * cos(2 * phi));
-    }
-
+        (st[0] == -0.1 && st[1] == -1. && st[2] == -0.1))
+      return ang_dist_3_002;
     // 0^+ -> 1^- -> 0^+ or 0^- -> 1^- -> 0^-
     if ((st[0] == 0. && st[1] == -1. && st[2] == 0.) ||
-        (st[0] == -0.1 && st[1] == 1. && st[2] == -0.1)) {
-      return 0.75 * (1 + pow(cos(theta), 2) -
-                     pow(sin(theta), 2) * cos(2 * phi));
-    }
-
+        (st[0] == -0.1 && st[1] == 1. && st[2] == -0.1))
+      return ang_dist_3_003;
     // 0^+ -> 2^+ -> 0^+ or 0^- -> 2^- -> 0^-
     if ((st[0] == 0. && st[1] == 2. && st[2] == 0.) ||
-        (st[0] == -0.1 && st[1] == -2. && st[2] == -0.1)) {
-      return 0.625 * (2. + cos(2. * theta) + cos(4. * theta) -
-                      2. * cos(2. * phi) * (1. + 2. * cos(2. * theta)) *
-                          pow(sin(theta), 2.));
-    }
-
+        (st[0] == -0.1 && st[1] == -2. && st[2] == -0.1))
+      return ang_dist_3_004;
     // 0^+ -> 2^- -> 0^+ or 0^- -> 2^+ -> 0^-
     if ((st[0] == 0. && st[1] == -2. && st[2] == 0.) ||
-        (st[0] == -0.1 && st[1] == 2. && st[2] == -0.1)) {
-      return (10.0 * pow(sin(phi), 2) * pow(sin(theta), 4) -
-              7.5 * pow(sin(phi), 2) * pow(sin(theta), 2) -
-              2.5 * pow(sin(theta), 2) + 2.5);
-    }
-
+        (st[0] == -0.1 && st[1] == 2. && st[2] == -0.1))
+      return ang_dist_3_005;
     // 0^+ -> 2^+ -> 2^+ or 0^- -> 2^- -> 2^-
     if ((st[0] == 0. && st[1] == 2. && st[2] == 2.) ||
-        (st[0] == -0.1 && st[1] == -2. && st[2] == -2.)) {
-      return 1. / (56. * (1. + mix[1] * mix[1])) * (49. - 20.4939 * mix[1] + 65. * mix[1] * mix[1] + pow(cos(theta), 2) * (21. + 61.4817 * mix[1] + 5. * mix[1] * mix[1] * (-7. + 8. * cos(2. * theta))) + cos(2. * phi) * (21. + 61.4817 * mix[1] - 5. * mix[1] * mix[1] * (7. + 8. * cos(2. * theta))) * pow(sin(theta), 2));
-    }
-
+        (st[0] == -0.1 && st[1] == -2. && st[2] == -2.))
+      return ang_dist_3_006;
     // 0^+ -> 1^- -> 2^+ or 0^- -> 1^+ -> 2^-
     if ((st[0] == 0. && st[1] == -1. && st[2] == 2.) ||
-        (st[0] == -0.1 && st[1] == 1. && st[2] == -2.)) {
-
-      return 1. + ((0.07071067811865475 + 0.9486832980505138 * mix[1] + 0.35355339059327373 * pow(mix[1], 2)) *
-                   (1.0606601717798212 * cos(2. * phi) * (-1. + pow(cos(theta), 2)) + 0.35355339059327373 * (-1. + 3. * pow(cos(theta), 2)))) /
-                      (1. + pow(mix[1], 2));
-    }
-
+        (st[0] == -0.1 && st[1] == 1. && st[2] == -2.))
+      return ang_dist_3_007;
     // 0^+ -> 1^+ -> 2^+ or 0^- -> 1^- -> 2^-
     if ((st[0] == 0. && st[1] == 1. && st[2] == 2.) ||
-        (st[0] == -0.1 && st[1] == -1. && st[2] == -2.)) {
-
-      return 1. + ((0.07071067811865475 + 0.9486832980505138 * mix[1] + 0.35355339059327373 * pow(mix[1], 2)) *
-                   (-1.0606601717798212 * cos(2. * phi) * (-1. + pow(cos(theta), 2)) + 0.35355339059327373 * (-1. + 3. * pow(cos(theta), 2)))) /
-                      (1. + pow(mix[1], 2));
-    }
-
+        (st[0] == -0.1 && st[1] == -1. && st[2] == -2.))
+      return ang_dist_3_008;
     // 0^+ -> 1^- -> 1^p or 0^- -> 1^+ -> 1^p
-    if (((st[0] == 0. && st[1] == -1.) || (st[0] == -0.1 && st[1] == 1.)) && std::abs(st[2]) == 1.) {
-      return (pow(mix[1], 2) - 1.0 / 8.0 * (pow(mix[1], 2) + 6 * mix[1] + 1) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1) + 1) / (pow(mix[1], 2) + 1);
-    }
-
+    if (((st[0] == 0. && st[1] == -1.) || (st[0] == -0.1 && st[1] == 1.)) && std::abs(st[2]) == 1.)
+      return ang_dist_3_009;
     // 1.5^+ -> 2.5^- -> 1.5^+ or 1.5^- -> 2.5^+ -> 1.5^-
     if ((st[0] == 1.5 && st[1] == -2.5 && st[2] == 1.5) ||
-        (st[0] == -1.5 && st[1] == 1.5 && st[2] == -1.5)) {
-
-      return ((1. + 0.9999999999999998 * pow(mix[0], 2)) * (1. + 0.9999999999999998 * pow(mix[1], 2)) -
-              0.5 * (0.37416573867739406 + (-1.8973665961010275 - 0.19090088708030317 * mix[1]) * mix[1]) *
-                  ((0.37416573867739406 + (1.8973665961010275 - 0.19090088708030317 * mix[0]) * mix[0]) * (1. - 3. * pow(cos(theta), 2)) +
-                   0.5727026612409095 * (-1.959999999999999 + mix[0] * (3.313004678535784 + 1. * mix[0])) * cos(2. * phi) * (-1. + pow(cos(theta), 2))) -
-              0.31098153547133134 * pow(mix[0], 2) * pow(mix[1], 2) *
-                  (-0.6000000000000001 + 6. * pow(cos(theta), 2) - 7. * pow(cos(theta), 4) +
-                   cos(2. * phi) * (1. - 8. * pow(cos(theta), 2) + 7. * pow(cos(theta), 4)))) /
-             ((1. + pow(mix[0], 2)) * (1. + pow(mix[1], 2)));
-    }
-
+        (st[0] == -1.5 && st[1] == 1.5 && st[2] == -1.5))
+      return ang_dist_3_010;
     // 1.5^+ -> 2.5^+ -> 1.5^+ or 1.5^- -> 2.5^- -> 1.5^-
     if ((st[0] == 1.5 && st[1] == 2.5 && st[2] == 1.5) ||
-        (st[0] == -1.5 && st[1] == -2.5 && st[2] == -1.5)) {
-
-      return ((1. + 0.9999999999999998 * pow(mix[0], 2)) * (1. + 0.9999999999999998 * pow(mix[1], 2)) -
-              0.5 * (0.37416573867739406 + (-1.8973665961010275 - 0.19090088708030317 * mix[1]) * mix[1]) *
-                  ((0.37416573867739406 + (1.8973665961010275 - 0.19090088708030317 * mix[0]) * mix[0]) * (1. - 3. * pow(cos(theta), 2)) -
-                   0.5727026612409095 * (-1.959999999999999 + mix[0] * (3.313004678535784 + 1. * mix[0])) * cos(2. * phi) * (-1. + pow(cos(theta), 2))) +
-              0.31098153547133134 * pow(mix[0], 2) * pow(mix[1], 2) *
-                  (0.6000000000000001 - 6. * pow(cos(theta), 2) + 7. * pow(cos(theta), 4) +
-                   cos(2. * phi) * (1. - 8. * pow(cos(theta), 2) + 7. * pow(cos(theta), 4)))) /
-             ((1. + pow(mix[0], 2)) * (1. + pow(mix[1], 2)));
-    }
-
+        (st[0] == -1.5 && st[1] == -2.5 && st[2] == -1.5))
+      return ang_dist_3_011;
     // 1.5^+ -> 1.5^+ -> 1.5^+ or 1.5^- -> 1.5^- -> 1.5^-
     if ((st[0] == 1.5 && st[1] == 1.5 && st[2] == 1.5) ||
-        (st[0] == -1.5 && st[1] == -1.5 && st[2] == -1.5)) {
-
-      return 1. + (0.04 * (1. + 3.872983346207417 * mix[1]) * (-1. * (-1. + 3.872983346207417 * mix[0]) * (1. + 3. * cos(2. * theta)) + 2. * (3. + 3.872983346207417 * mix[0]) * cos(2. * phi) * pow(sin(theta), 2))) / ((1. + pow(mix[0], 2)) * (1. + pow(mix[1], 2)));
-    }
-
+        (st[0] == -1.5 && st[1] == -1.5 && st[2] == -1.5))
+      return ang_dist_3_012;
     // 1.5^+ -> 1.5^- -> 1.5^+ or 1.5^- -> 1.5^+ -> 1.5^-
     if ((st[0] == 1.5 && st[1] == -1.5 && st[2] == 1.5) ||
-        (st[0] == -1.5 && st[1] == 1.5 && st[2] == -1.5)) {
-
-      return 1. + (0.04 * (1. + 3.872983346207417 * mix[1]) * (-1. * (-1. + 3.872983346207417 * mix[0]) * (1. + 3. * cos(2. * theta)) - 2. * (3. + 3.872983346207417 * mix[0]) * cos(2. * phi) * pow(sin(theta), 2))) / ((1. + pow(mix[0], 2)) * (1. + pow(mix[1], 2)));
-    }
-
+        (st[0] == -1.5 && st[1] == 1.5 && st[2] == -1.5))
+      return ang_dist_3_013;
     // 0.5^- -> 1.5^- -> 0.5^- or 0.5^+ -> 1.5^+ -> 0.5^+
     if ((st[0] == -0.5 && st[1] == -1.5 && st[2] == -0.5) ||
-        (st[0] == 0.5 && st[1] == 1.5 && st[2] == 0.5)) {
-
-      return 1. + (0.125 * (-1. + 3.4641016151377544 * mix[1] + pow(mix[1], 2)) *
-                   (-1. * (1. + 3.4641016151377544 * mix[0] - 1. * pow(mix[0], 2)) * (-1. + 3. * pow(cos(theta), 2)) +
-                    (-3. + 3.4641016151377544 * mix[0] + 3. * pow(mix[0], 2)) * cos(2. * phi) * pow(sin(theta), 2))) /
-                      ((1. + pow(mix[0], 2)) * (1. + pow(mix[1], 2)));
-    }
-
+        (st[0] == 0.5 && st[1] == 1.5 && st[2] == 0.5))
+      return ang_dist_3_014;
     // 0.5^- -> 1.5^+ -> 0.5^- or 0.5^+ -> 1.5^- -> 0.5^+
     if ((st[0] == -0.5 && st[1] == 1.5 && st[2] == -0.5) ||
-        (st[0] == 0.5 && st[1] == -1.5 && st[2] == 0.5)) {
-
-      return 1. - (0.125 * (-1. + 3.4641016151377544 * mix[1] + pow(mix[1], 2)) *
-                   ((1. + 3.4641016151377544 * mix[0] - 1. * pow(mix[0], 2)) * (-1. + 3. * pow(cos(theta), 2)) +
-                    (-3. + 3.4641016151377544 * mix[0] + 3. * pow(mix[0], 2)) * cos(2. * phi) * pow(sin(theta), 2))) /
-                      ((1. + pow(mix[0], 2)) * (1. + pow(mix[1], 2)));
-    }
-
+        (st[0] == 0.5 && st[1] == -1.5 && st[2] == 0.5))
+      return ang_dist_3_015;
     // 2.5^+ -> 1.5^- -> 2.5^+ or 2.5^- -> 1.5^+ -> 2.5^-
     if ((st[0] == 2.5 && st[1] == -1.5 && st[2] == 2.5) ||
-        (st[0] == -2.5 && st[1] == +1.5 && st[2] == -2.5)) {
-
-      return (0.5 * (2. * (1.0000000000000002 + 1. * pow(mix[0], 2)) * (1.0000000000000002 + 1. * pow(mix[1], 2)) -
-                     1. * (0.10000000000000002 + (1.1832159566199234 + 0.3571428571428572 * mix[1]) * mix[1]) *
-                         ((0.10000000000000002 + (-1.1832159566199234 + 0.3571428571428572 * mix[0]) * mix[0]) * (1. - 3. * pow(cos(theta), 2)) -
-                          1.0714285714285716 * (0.28 + mix[0] * (1.1043348928452617 + 1. * mix[0])) * cos(2. * phi) * (-1. + pow(cos(theta), 2))))) /
-             ((1. + pow(mix[0], 2)) * (1. + pow(mix[1], 2)));
-    }
-
+        (st[0] == -2.5 && st[1] == +1.5 && st[2] == -2.5))
+      return ang_dist_3_016;
     // 2.5^+ -> 1.5^+ -> 2.5^+ or 2.5^- -> 1.5^- -> 2.5^-
     if ((st[0] == 2.5 && st[1] == 1.5 && st[2] == 2.5) ||
-        (st[0] == -2.5 && st[1] == -1.5 && st[2] == -2.5)) {
-
-      return (0.5 * (2. * (1.0000000000000002 + 1. * pow(mix[0], 2)) * (1.0000000000000002 + 1. * pow(mix[1], 2)) -
-                     1. * (0.10000000000000002 + (1.1832159566199234 + 0.3571428571428572 * mix[1]) * mix[1]) *
-                         ((0.10000000000000002 + (-1.1832159566199234 + 0.3571428571428572 * mix[0]) * mix[0]) * (1. - 3. * pow(cos(theta), 2)) +
-                          1.0714285714285716 * (0.28 + mix[0] * (1.1043348928452617 + 1. * mix[0])) * cos(2. * phi) * (-1. + pow(cos(theta), 2))))) /
-             ((1. + pow(mix[0], 2)) * (1. + pow(mix[1], 2)));
-    }
-
+        (st[0] == -2.5 && st[1] == -1.5 && st[2] == -2.5))
+      return ang_dist_3_017;
     // 2.5^+ -> 2.5^+ -> 2.5^+ or 2.5^- -> 2.5^- -> 2.5^-
     if ((st[0] == 2.5 && st[1] == 2.5 && st[2] == 2.5) ||
-        (st[0] == -2.5 && st[1] == -2.5 && st[2] == -2.5)) {
-
-      return (1.0 / 2.0) * (14 * pow(mix[0], 2) * pow(mix[1], 2) * (-0.014056643065389425 * (7 * pow(cos(theta), 2) - 1) * pow(sin(theta), 2) * cos(2 * phi) + 0.098396501457725979 * pow(cos(theta), 4) - 0.08433985839233657 * pow(cos(theta), 2) + 0.0084339858392336545) + 12 * (0.40824829046386302 * pow(mix[0], 2) + 0.40824829046386296) * (0.40824829046386302 * pow(mix[1], 2) + 0.40824829046386296) + ((3 * pow(cos(theta), 2) - 1) * (0.018630018962760751 * sqrt(105) * pow(mix[0], 2) + 0.12121830534626531 * sqrt(70) * mix[0] - 0.041731242476584086 * sqrt(105)) + (0.055890056888282233 * sqrt(105) * pow(mix[0], 2) - 0.12121830534626531 * sqrt(70) * mix[0] - 0.12519372742975224 * sqrt(105)) * pow(sin(theta), 2) * cos(2 * phi)) * (0.018630018962760751 * sqrt(105) * pow(mix[1], 2) - 0.12121830534626531 * sqrt(70) * mix[1] - 0.041731242476584086 * sqrt(105))) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1));
-    }
-
+        (st[0] == -2.5 && st[1] == -2.5 && st[2] == -2.5))
+      return ang_dist_3_018;
     // 2.5^+ -> 2.5^- -> 2.5^+ or 2.5^- -> 2.5^+ -> 2.5^-
     if ((st[0] == 2.5 && st[1] == -2.5 && st[2] == 2.5) ||
-        (st[0] == -2.5 && st[1] == 2.5 && st[2] == -2.5)) {
-
-      return (1.0 / 2.0) * (14 * pow(mix[0], 2) * pow(mix[1], 2) * (0.19679300291545196 * pow(sin(phi), 2) * pow(sin(theta), 4) - 0.16867971678467311 * pow(sin(phi), 2) * pow(sin(theta), 2) - 0.028113286130778833 * pow(sin(theta), 2) + 0.022490628904623076) + 12 * (0.40824829046386302 * pow(mix[0], 2) + 0.40824829046386296) * (0.40824829046386302 * pow(mix[1], 2) + 0.40824829046386296) + ((3 * pow(cos(theta), 2) - 1) * (0.018630018962760751 * sqrt(105) * pow(mix[0], 2) + 0.12121830534626531 * sqrt(70) * mix[0] - 0.041731242476584086 * sqrt(105)) + (-0.055890056888282233 * sqrt(105) * pow(mix[0], 2) + 0.12121830534626531 * sqrt(70) * mix[0] + 0.12519372742975224 * sqrt(105)) * pow(sin(theta), 2) * cos(2 * phi)) * (0.018630018962760751 * sqrt(105) * pow(mix[1], 2) - 0.12121830534626531 * sqrt(70) * mix[1] - 0.041731242476584086 * sqrt(105))) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1));
-    }
-
+        (st[0] == -2.5 && st[1] == 2.5 && st[2] == -2.5))
+      return ang_dist_3_019;
     // 2.5^+ -> 3.5^+ -> 2.5^+ or 2.5^- -> 3.5^- -> 2.5^-
     if ((st[0] == 2.5 && st[1] == 3.5 && st[2] == 2.5) ||
-        (st[0] == -2.5 && st[1] == -3.5 && st[2] == -2.5)) {
-
-      return (1.0 / 2.0) * (308 * pow(mix[0], 2) * pow(mix[1], 2) * (-0.0016454049495837645 * (7 * pow(cos(theta), 2) - 1) * pow(sin(theta), 2) * cos(2 * phi) + 0.011517834647086349 * pow(cos(theta), 4) - 0.0098724296975025837 * pow(cos(theta), 2) + 0.00098724296975025833) + 4 * (0.70710678118654768 * pow(mix[0], 2) + 0.70710678118654746) * (0.70710678118654768 * pow(mix[1], 2) + 0.70710678118654746) + ((3 * pow(cos(theta), 2) - 1) * (-0.0053780232315788759 * sqrt(210) * pow(mix[0], 2) + 0.29160592175990219 * sqrt(42) * mix[0] + 0.02258769757263128 * sqrt(210)) + (-0.016134069694736623 * sqrt(210) * pow(mix[0], 2) - 0.29160592175990208 * sqrt(42) * mix[0] + 0.067763092717893825 * sqrt(210)) * pow(sin(theta), 2) * cos(2 * phi)) * (-0.0053780232315788759 * sqrt(210) * pow(mix[1], 2) - 0.29160592175990219 * sqrt(42) * mix[1] + 0.02258769757263128 * sqrt(210))) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1));
-    }
-
+        (st[0] == -2.5 && st[1] == -3.5 && st[2] == -2.5))
+      return ang_dist_3_020;
     // 2.5^+ -> 3.5^- -> 2.5^+ or 2.5^- -> 3.5^+ -> 2.5^-
     if ((st[0] == 2.5 && st[1] == -3.5 && st[2] == 2.5) ||
-        (st[0] == -2.5 && st[1] == 3.5 && st[2] == -2.5)) {
-
-      return (1.0 / 2.0) * (308 * pow(mix[0], 2) * pow(mix[1], 2) * (0.0016454049495837645 * (7 * pow(cos(theta), 2) - 1) * pow(sin(theta), 2) * cos(2 * phi) + 0.011517834647086349 * pow(cos(theta), 4) - 0.0098724296975025837 * pow(cos(theta), 2) + 0.00098724296975025833) + 4 * (0.70710678118654768 * pow(mix[0], 2) + 0.70710678118654746) * (0.70710678118654768 * pow(mix[1], 2) + 0.70710678118654746) + ((3 * pow(cos(theta), 2) - 1) * (-0.0053780232315788759 * sqrt(210) * pow(mix[0], 2) + 0.29160592175990219 * sqrt(42) * mix[0] + 0.02258769757263128 * sqrt(210)) + (0.016134069694736623 * sqrt(210) * pow(mix[0], 2) + 0.29160592175990208 * sqrt(42) * mix[0] - 0.067763092717893825 * sqrt(210)) * pow(sin(theta), 2) * cos(2 * phi)) * (-0.0053780232315788759 * sqrt(210) * pow(mix[1], 2) - 0.29160592175990219 * sqrt(42) * mix[1] + 0.02258769757263128 * sqrt(210))) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1));
-    }
-
+        (st[0] == -2.5 && st[1] == 3.5 && st[2] == -2.5))
+      return ang_dist_3_021;
     // 3.5^+ -> 4.5^+ -> 3.5^+ or 3.5^- -> 4.5^- -> 3.5^-
     if ((st[0] == 3.5 && st[1] == 4.5 && st[2] == 3.5) ||
-        (st[0] == -3.5 && st[1] == -4.5 && st[2] == -3.5)) {
-
-      return (pow(mix[1], 2) + (1.0 / 554400.0) * sqrt(330) * (6.0 * pow(sin(phi), 2) * pow(sin(theta), 2) - 2.0) * (5 * sqrt(330) * pow(mix[1], 2) + 2310 * sqrt(14) * mix[1] - 77 * sqrt(330)) + 1) / (pow(mix[1], 2) + 1);
-    }
-
+        (st[0] == -3.5 && st[1] == -4.5 && st[2] == -3.5))
+      return ang_dist_3_022;
     // 3.5^+ -> 4.5^- -> 3.5^+ or 3.5^- -> 4.5^+ -> 3.5^-
     if ((st[0] == 3.5 && st[1] == -4.5 && st[2] == 3.5) ||
-        (st[0] == -3.5 && st[1] == +4.5 && st[2] == -3.5)) {
-
-      return (pow(mix[1], 2) + (1.0 / 554400.0) * sqrt(330) * (5 * sqrt(330) * pow(mix[1], 2) + 2310 * sqrt(14) * mix[1] - 77 * sqrt(330)) * (2.9999999999999991 * pow(sin(theta), 2) * cos(2 * phi) - 3 * pow(cos(theta), 2) + 1) + 1) / (pow(mix[1], 2) + 1);
-    }
-
+        (st[0] == -3.5 && st[1] == +4.5 && st[2] == -3.5))
+      return ang_dist_3_023;
     // 1^+ -> 2^+ -> 0^+ or 1^- -> 2^- -> 0^-
     if ((st[0] == 1. && st[1] == 2. && st[2] == 0.) ||
-        (st[0] == -1. && st[1] == -2. && st[2] == -0.)) {
-      return (80 * pow(mix[0], 2) * pow(sin(theta), 2) * cos(2 * phi) * pow(cos(theta), 2) - 5 * pow(mix[0], 2) * pow(sin(theta), 2) * cos(2 * phi) - 80 * pow(mix[0], 2) * pow(cos(theta), 4) + 75 * pow(mix[0], 2) * pow(cos(theta), 2) + 15 * pow(mix[0], 2) + 6 * sqrt(5) * mix[0] * pow(sin(theta), 2) * cos(2 * phi) - 18 * sqrt(5) * mix[0] * pow(cos(theta), 2) + 6 * sqrt(5) * mix[0] - 9 * pow(sin(theta), 2) * cos(2 * phi) - 9 * pow(cos(theta), 2) + 27) / (24 * pow(mix[0], 2) + 24);
-    }
+        (st[0] == -1. && st[1] == -2. && st[2] == -0.))
+      return ang_dist_3_024;
     // 1^- -> 2^+ -> 0^+ or 1^+ -> 2^- -> 0^-
     if ((st[0] == -1. && st[1] == 2. && st[2] == 0.) ||
-        (st[0] == 1. && st[1] == -2. && st[2] == -0.)) {
-      return (1.0 / 11760.0) * (1120 * pow(mix[0], 2) * (-70 * pow(sin(phi), 2) * pow(sin(theta), 4) + 60 * pow(sin(phi), 2) * pow(sin(theta), 2) + 10 * pow(sin(theta), 2) - 8) + 11760 * pow(mix[0], 2) - 3 * sqrt(70) * ((3 * pow(cos(theta), 2) - 1) * (-5 * sqrt(70) * pow(mix[0], 2) + 70 * sqrt(14) * mix[0] + 7 * sqrt(70)) + (15 * sqrt(70) * pow(mix[0], 2) + 70 * sqrt(14) * mix[0] - 21 * sqrt(70)) * pow(sin(theta), 2) * cos(2 * phi)) + 11760) / (pow(mix[0], 2) + 1);
-    }
-
+        (st[0] == 1. && st[1] == -2. && st[2] == -0.))
+      return ang_dist_3_025;
   } else if (nst == 4) {
     // 0^+ → 1^- → 0 → 1
     if ((std::abs(st[2]) == 0.0 && std::abs(st[3]) == 1.0) &&
         ((st[0] == 0. && st[1] == -1.0) ||
-         (st[0] == -0.1 && st[1] == 1.0))) {
-
-      return 1 / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == 1.0)))
+      return ang_dist_4_000;
     // 0^+ → 1^- → 0 → 2
     if ((std::abs(st[2]) == 0.0 && std::abs(st[3]) == 2.0) &&
         ((st[0] == 0. && st[1] == -1.0) ||
-         (st[0] == -0.1 && st[1] == 1.0))) {
-
-      return 1 / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == 1.0)))
+      return ang_dist_4_001;
     // 0^+ → 1^- → 0 → 3
     if ((std::abs(st[2]) == 0.0 && std::abs(st[3]) == 3.0) &&
         ((st[0] == 0. && st[1] == -1.0) ||
-         (st[0] == -0.1 && st[1] == 1.0))) {
-
-      return 1 / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == 1.0)))
+      return ang_dist_4_002;
     // 0^+ → 1^- → 0 → 4
     if ((std::abs(st[2]) == 0.0 && std::abs(st[3]) == 4.0) &&
         ((st[0] == 0. && st[1] == -1.0) ||
-         (st[0] == -0.1 && st[1] == 1.0))) {
-
-      return 1 / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == 1.0)))
+      return ang_dist_4_003;
     // 0^+ → 1^- → 0 → 5
     if ((std::abs(st[2]) == 0.0 && std::abs(st[3]) == 5.0) &&
         ((st[0] == 0. && st[1] == -1.0) ||
-         (st[0] == -0.1 && st[1] == 1.0))) {
-
-      return 1 / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == 1.0)))
+      return ang_dist_4_004;
     // 0^+ → 1^- → 0 → 6
     if ((std::abs(st[2]) == 0.0 && std::abs(st[3]) == 6.0) &&
         ((st[0] == 0. && st[1] == -1.0) ||
-         (st[0] == -0.1 && st[1] == 1.0))) {
-
-      return 1 / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == 1.0)))
+      return ang_dist_4_005;
     // 0^+ → 1^- → 1 → 0
     if ((std::abs(st[2]) == 1.0 && std::abs(st[3]) == 0.0) &&
         ((st[0] == 0. && st[1] == -1.0) ||
-         (st[0] == -0.1 && st[1] == 1.0))) {
-
-      return (pow(mix[1], 2) + (1.0 / 40.0) * (pow(mix[1], 2) - 5) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1) + 1) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == 1.0)))
+      return ang_dist_4_006;
     // 0^+ → 1^- → 1 → 1
     if ((std::abs(st[2]) == 1.0 && std::abs(st[3]) == 1.0) &&
         ((st[0] == 0. && st[1] == -1.0) ||
-         (st[0] == -0.1 && st[1] == 1.0))) {
-
-      return (-1.0 / 80.0 * (pow(mix[1], 2) - 5) * (pow(mix[2], 2) + 6 * mix[2] + 1) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == 1.0)))
+      return ang_dist_4_007;
     // 0^+ → 1^- → 1 → 2
     if ((std::abs(st[2]) == 1.0 && std::abs(st[3]) == 2.0) &&
         ((st[0] == 0. && st[1] == -1.0) ||
-         (st[0] == -0.1 && st[1] == 1.0))) {
-
-      return ((1.0 / 800.0) * M_SQRT2 * (pow(mix[1], 2) - 5) * (5 * M_SQRT2 * pow(mix[2], 2) + 6 * sqrt(10) * mix[2] + M_SQRT2) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == 1.0)))
+      return ang_dist_4_008;
     // 0^+ → 1^- → 1 → 3
     if ((std::abs(st[2]) == 1.0 && std::abs(st[3]) == 3.0) &&
         ((st[0] == 0. && st[1] == -1.0) ||
-         (st[0] == -0.1 && st[1] == 1.0))) {
-
-      return ((1.0 / 2240.0) * M_SQRT2 * (pow(mix[1], 2) - 5) * (21 * M_SQRT2 * pow(mix[2], 2) + 16 * sqrt(7) * mix[2] - 4 * M_SQRT2) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == 1.0)))
+      return ang_dist_4_009;
     // 0^+ → 1^- → 1 → 4
     if ((std::abs(st[2]) == 1.0 && std::abs(st[3]) == 4.0) &&
         ((st[0] == 0. && st[1] == -1.0) ||
-         (st[0] == -0.1 && st[1] == 1.0))) {
-
-      return ((1.0 / 1600.0) * M_SQRT2 * (pow(mix[1], 2) - 5) * (17 * M_SQRT2 * pow(mix[2], 2) + 10 * sqrt(6) * mix[2] - 5 * M_SQRT2) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == 1.0)))
+      return ang_dist_4_010;
     // 0^+ → 1^- → 1 → 5
     if ((std::abs(st[2]) == 1.0 && std::abs(st[3]) == 5.0) &&
         ((st[0] == 0. && st[1] == -1.0) ||
-         (st[0] == -0.1 && st[1] == 1.0))) {
-
-      return ((1.0 / 8800.0) * M_SQRT2 * (pow(mix[1], 2) - 5) * (99 * M_SQRT2 * pow(mix[2], 2) + 24 * sqrt(22) * mix[2] - 34 * M_SQRT2) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == 1.0)))
+      return ang_dist_4_011;
     // 0^+ → 1^- → 1 → 6
     if ((std::abs(st[2]) == 1.0 && std::abs(st[3]) == 6.0) &&
         ((st[0] == 0. && st[1] == -1.0) ||
-         (st[0] == -0.1 && st[1] == 1.0))) {
-
-      return ((1.0 / 14560.0) * M_SQRT2 * (pow(mix[1], 2) - 5) * (169 * M_SQRT2 * pow(mix[2], 2) + 14 * sqrt(130) * mix[2] - 63 * M_SQRT2) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == 1.0)))
+      return ang_dist_4_012;
     // 0^+ → 1^- → 2 → 0
     if ((std::abs(st[2]) == 2.0 && std::abs(st[3]) == 0.0) &&
         ((st[0] == 0. && st[1] == -1.0) ||
-         (st[0] == -0.1 && st[1] == 1.0))) {
-
-      return (pow(mix[1], 2) + (1.0 / 8.0) * (pow(mix[1], 2) - 1) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1) + 1) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == 1.0)))
+      return ang_dist_4_013;
     // 0^+ → 1^- → 2 → 1
     if ((std::abs(st[2]) == 2.0 && std::abs(st[3]) == 1.0) &&
         ((st[0] == 0. && st[1] == -1.0) ||
-         (st[0] == -0.1 && st[1] == 1.0))) {
-
-      return ((1.0 / 5600.0) * sqrt(70) * (pow(mix[1], 2) - 1) * (5 * sqrt(70) * pow(mix[2], 2) + 70 * sqrt(14) * mix[2] - 7 * sqrt(70)) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == 1.0)))
+      return ang_dist_4_014;
     // 0^+ → 1^- → 2 → 2
     if ((std::abs(st[2]) == 2.0 && std::abs(st[3]) == 2.0) &&
         ((st[0] == 0. && st[1] == -1.0) ||
-         (st[0] == -0.1 && st[1] == 1.0))) {
-
-      return ((1.0 / 39200.0) * sqrt(70) * (pow(mix[1], 2) - 1) * (-15 * sqrt(70) * pow(mix[2], 2) + 490 * sqrt(6) * mix[2] + 49 * sqrt(70)) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == 1.0)))
+      return ang_dist_4_015;
     // 0^+ → 1^- → 2 → 3
     if ((std::abs(st[2]) == 2.0 && std::abs(st[3]) == 3.0) &&
         ((st[0] == 0. && st[1] == -1.0) ||
-         (st[0] == -0.1 && st[1] == 1.0))) {
-
-      return (-1.0 / 19600.0 * sqrt(70) * (pow(mix[1], 2) - 1) * (20 * sqrt(70) * pow(mix[2], 2) + 140 * sqrt(21) * mix[2] + 7 * sqrt(70)) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == 1.0)))
+      return ang_dist_4_016;
     // 0^+ → 1^- → 2 → 4
     if ((std::abs(st[2]) == 2.0 && std::abs(st[3]) == 4.0) &&
         ((st[0] == 0. && st[1] == -1.0) ||
-         (st[0] == -0.1 && st[1] == 1.0))) {
-
-      return (-1.0 / 15680.0 * sqrt(70) * (pow(mix[1], 2) - 1) * (21 * sqrt(70) * pow(mix[2], 2) + 280 * M_SQRT2 * mix[2] - 8 * sqrt(70)) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == 1.0)))
+      return ang_dist_4_017;
     // 0^+ → 1^- → 2 → 5
     if ((std::abs(st[2]) == 2.0 && std::abs(st[3]) == 5.0) &&
         ((st[0] == 0. && st[1] == -1.0) ||
-         (st[0] == -0.1 && st[1] == 1.0))) {
-
-      return (-1.0 / 12320.0 * sqrt(70) * (pow(mix[1], 2) - 1) * (17 * sqrt(70) * pow(mix[2], 2) + 66 * sqrt(14) * mix[2] - 11 * sqrt(70)) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == 1.0)))
+      return ang_dist_4_018;
     // 0^+ → 1^- → 2 → 6
     if ((std::abs(st[2]) == 2.0 && std::abs(st[3]) == 6.0) &&
         ((st[0] == 0. && st[1] == -1.0) ||
-         (st[0] == -0.1 && st[1] == 1.0))) {
-
-      return (-1.0 / 800800.0 * sqrt(70) * (pow(mix[1], 2) - 1) * (1089 * sqrt(70) * pow(mix[2], 2) + 728 * sqrt(330) * mix[2] - 884 * sqrt(70)) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == 1.0)))
+      return ang_dist_4_019;
     // 0^+ → 1^- → 3 → 0
     if ((std::abs(st[2]) == 3.0 && std::abs(st[3]) == 0.0) &&
         ((st[0] == 0. && st[1] == -1.0) ||
-         (st[0] == -0.1 && st[1] == 1.0))) {
-
-      return (pow(mix[1], 2) + (1.0 / 80.0) * (15 * pow(mix[1], 2) - 12) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1) + 1) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == 1.0)))
+      return ang_dist_4_020;
     // 0^+ → 1^- → 3 → 1
     if ((std::abs(st[2]) == 3.0 && std::abs(st[3]) == 1.0) &&
         ((st[0] == 0. && st[1] == -1.0) ||
-         (st[0] == -0.1 && st[1] == 1.0))) {
-
-      return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + (1.0 / 2240.0) * sqrt(3) * (5 * pow(mix[1], 2) - 4) * (21 * sqrt(3) * pow(mix[2], 2) + 8 * sqrt(42) * mix[2] + 16 * sqrt(3)) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == 1.0)))
+      return ang_dist_4_021;
     // 0^+ → 1^- → 3 → 2
     if ((std::abs(st[2]) == 3.0 && std::abs(st[3]) == 2.0) &&
         ((st[0] == 0. && st[1] == -1.0) ||
-         (st[0] == -0.1 && st[1] == 1.0))) {
-
-      return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + (1.0 / 2800.0) * sqrt(3) * (5 * pow(mix[1], 2) - 4) * (5 * sqrt(3) * pow(mix[2], 2) + 42 * sqrt(10) * mix[2] - 14 * sqrt(3)) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == 1.0)))
+      return ang_dist_4_022;
     // 0^+ → 1^- → 3 → 3
     if ((std::abs(st[2]) == 3.0 && std::abs(st[3]) == 3.0) &&
         ((st[0] == 0. && st[1] == -1.0) ||
-         (st[0] == -0.1 && st[1] == 1.0))) {
-
-      return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + (1.0 / 1120.0) * (5 * pow(mix[1], 2) - 4) * (-11 * pow(mix[2], 2) + 42 * mix[2] + 21) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == 1.0)))
+      return ang_dist_4_023;
     // 0^+ → 1^- → 3 → 4
     if ((std::abs(st[2]) == 3.0 && std::abs(st[3]) == 4.0) &&
         ((st[0] == 0. && st[1] == -1.0) ||
-         (st[0] == -0.1 && st[1] == 1.0))) {
-
-      return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) - 1.0 / 1120.0 * (5 * pow(mix[1], 2) - 4) * (15 * pow(mix[2], 2) + 70 * mix[2] + 7) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == 1.0)))
+      return ang_dist_4_024;
     // 0^+ → 1^- → 3 → 5
     if ((std::abs(st[2]) == 3.0 && std::abs(st[3]) == 5.0) &&
         ((st[0] == 0. && st[1] == -1.0) ||
-         (st[0] == -0.1 && st[1] == 1.0))) {
-
-      return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) - 1.0 / 1344.0 * sqrt(3) * (5 * pow(mix[1], 2) - 4) * (7 * sqrt(3) * pow(mix[2], 2) + 8 * sqrt(21) * mix[2] - 4 * sqrt(3)) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == 1.0)))
+      return ang_dist_4_025;
     // 0^+ → 1^- → 3 → 6
     if ((std::abs(st[2]) == 3.0 && std::abs(st[3]) == 6.0) &&
         ((st[0] == 0. && st[1] == -1.0) ||
-         (st[0] == -0.1 && st[1] == 1.0))) {
-
-      return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) - 1.0 / 10560.0 * sqrt(3) * (5 * pow(mix[1], 2) - 4) * (51 * sqrt(3) * pow(mix[2], 2) + 22 * sqrt(105) * mix[2] - 55 * sqrt(3)) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == 1.0)))
+      return ang_dist_4_026;
     // 0^+ → 1^- → 4 → 0
     if ((std::abs(st[2]) == 4.0 && std::abs(st[3]) == 0.0) &&
         ((st[0] == 0. && st[1] == -1.0) ||
-         (st[0] == -0.1 && st[1] == 1.0))) {
-
-      return (pow(mix[1], 2) + (1.0 / 560.0) * (119 * pow(mix[1], 2) - 85) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1) + 1) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == 1.0)))
+      return ang_dist_4_027;
     // 0^+ → 1^- → 4 → 1
     if ((std::abs(st[2]) == 4.0 && std::abs(st[3]) == 1.0) &&
         ((st[0] == 0. && st[1] == -1.0) ||
-         (st[0] == -0.1 && st[1] == 1.0))) {
-
-      return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + (1.0 / 862400.0) * sqrt(77) * (7 * pow(mix[1], 2) - 5) * (289 * sqrt(77) * pow(mix[2], 2) + 110 * sqrt(231) * mix[2] + 275 * sqrt(77)) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == 1.0)))
+      return ang_dist_4_028;
     // 0^+ → 1^- → 4 → 2
     if ((std::abs(st[2]) == 4.0 && std::abs(st[3]) == 2.0) &&
         ((st[0] == 0. && st[1] == -1.0) ||
-         (st[0] == -0.1 && st[1] == 1.0))) {
-
-      return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + (1.0 / 109760.0) * sqrt(77) * (7 * pow(mix[1], 2) - 5) * (21 * sqrt(77) * pow(mix[2], 2) + 56 * sqrt(55) * mix[2] + 20 * sqrt(77)) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == 1.0)))
+      return ang_dist_4_029;
     // 0^+ → 1^- → 4 → 3
     if ((std::abs(st[2]) == 4.0 && std::abs(st[3]) == 3.0) &&
         ((st[0] == 0. && st[1] == -1.0) ||
-         (st[0] == -0.1 && st[1] == 1.0))) {
-
-      return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + (11.0 / 7840.0) * (7 * pow(mix[1], 2) - 5) * (pow(mix[2], 2) + 42 * mix[2] - 7) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == 1.0)))
+      return ang_dist_4_030;
     // 0^+ → 1^- → 4 → 4
     if ((std::abs(st[2]) == 4.0 && std::abs(st[3]) == 4.0) &&
         ((st[0] == 0. && st[1] == -1.0) ||
-         (st[0] == -0.1 && st[1] == 1.0))) {
-
-      return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + (1.0 / 3018400.0) * sqrt(77) * (7 * pow(mix[1], 2) - 5) * (-325 * sqrt(77) * pow(mix[2], 2) + 3234 * sqrt(5) * mix[2] + 539 * sqrt(77)) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == 1.0)))
+      return ang_dist_4_031;
     // 0^+ → 1^- → 4 → 5
     if ((std::abs(st[2]) == 4.0 && std::abs(st[3]) == 5.0) &&
         ((st[0] == 0. && st[1] == -1.0) ||
-         (st[0] == -0.1 && st[1] == 1.0))) {
-
-      return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) - 1.0 / 215600.0 * sqrt(77) * (7 * pow(mix[1], 2) - 5) * (25 * sqrt(77) * pow(mix[2], 2) + 42 * sqrt(770) * mix[2] + 14 * sqrt(77)) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == 1.0)))
+      return ang_dist_4_032;
     // 0^+ → 1^- → 4 → 6
     if ((std::abs(st[2]) == 4.0 && std::abs(st[3]) == 6.0) &&
         ((st[0] == 0. && st[1] == -1.0) ||
-         (st[0] == -0.1 && st[1] == 1.0))) {
-
-      return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) - 1.0 / 172480.0 * sqrt(77) * (7 * pow(mix[1], 2) - 5) * (21 * sqrt(77) * pow(mix[2], 2) + 56 * sqrt(154) * mix[2] - 16 * sqrt(77)) * (-3 * pow(sin(theta), 2) * cos(2 * phi) + 3 * pow(cos(theta), 2) - 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == 1.0)))
+      return ang_dist_4_033;
     // 0^+ → 1^+ → 0 → 1
     if ((std::abs(st[2]) == 0.0 && std::abs(st[3]) == 1.0) &&
         ((st[0] == 0. && st[1] == 1.0) ||
-         (st[0] == -0.1 && st[1] == -1.0))) {
-
-      return 1 / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -1.0)))
+      return ang_dist_4_034;
     // 0^+ → 1^+ → 0 → 2
     if ((std::abs(st[2]) == 0.0 && std::abs(st[3]) == 2.0) &&
         ((st[0] == 0. && st[1] == 1.0) ||
-         (st[0] == -0.1 && st[1] == -1.0))) {
-
-      return 1 / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -1.0)))
+      return ang_dist_4_035;
     // 0^+ → 1^+ → 0 → 3
     if ((std::abs(st[2]) == 0.0 && std::abs(st[3]) == 3.0) &&
         ((st[0] == 0. && st[1] == 1.0) ||
-         (st[0] == -0.1 && st[1] == -1.0))) {
-
-      return 1 / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -1.0)))
+      return ang_dist_4_036;
     // 0^+ → 1^+ → 0 → 4
     if ((std::abs(st[2]) == 0.0 && std::abs(st[3]) == 4.0) &&
         ((st[0] == 0. && st[1] == 1.0) ||
-         (st[0] == -0.1 && st[1] == -1.0))) {
-
-      return 1 / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -1.0)))
+      return ang_dist_4_037;
     // 0^+ → 1^+ → 0 → 5
     if ((std::abs(st[2]) == 0.0 && std::abs(st[3]) == 5.0) &&
         ((st[0] == 0. && st[1] == 1.0) ||
-         (st[0] == -0.1 && st[1] == -1.0))) {
-
-      return 1 / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -1.0)))
+      return ang_dist_4_038;
     // 0^+ → 1^+ → 0 → 6
     if ((std::abs(st[2]) == 0.0 && std::abs(st[3]) == 6.0) &&
         ((st[0] == 0. && st[1] == 1.0) ||
-         (st[0] == -0.1 && st[1] == -1.0))) {
-
-      return 1 / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -1.0)))
+      return ang_dist_4_039;
     // 0^+ → 1^+ → 1 → 0
     if ((std::abs(st[2]) == 1.0 && std::abs(st[3]) == 0.0) &&
         ((st[0] == 0. && st[1] == 1.0) ||
-         (st[0] == -0.1 && st[1] == -1.0))) {
-
-      return (pow(mix[1], 2) + (1.0 / 40.0) * (pow(mix[1], 2) - 5) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) + 1) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -1.0)))
+      return ang_dist_4_040;
     // 0^+ → 1^+ → 1 → 1
     if ((std::abs(st[2]) == 1.0 && std::abs(st[3]) == 1.0) &&
         ((st[0] == 0. && st[1] == 1.0) ||
-         (st[0] == -0.1 && st[1] == -1.0))) {
-
-      return (-1.0 / 80.0 * (pow(mix[1], 2) - 5) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (pow(mix[2], 2) + 6 * mix[2] + 1) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -1.0)))
+      return ang_dist_4_041;
     // 0^+ → 1^+ → 1 → 2
     if ((std::abs(st[2]) == 1.0 && std::abs(st[3]) == 2.0) &&
         ((st[0] == 0. && st[1] == 1.0) ||
-         (st[0] == -0.1 && st[1] == -1.0))) {
-
-      return ((1.0 / 800.0) * M_SQRT2 * (pow(mix[1], 2) - 5) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (5 * M_SQRT2 * pow(mix[2], 2) + 6 * sqrt(10) * mix[2] + M_SQRT2) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -1.0)))
+      return ang_dist_4_042;
     // 0^+ → 1^+ → 1 → 3
     if ((std::abs(st[2]) == 1.0 && std::abs(st[3]) == 3.0) &&
         ((st[0] == 0. && st[1] == 1.0) ||
-         (st[0] == -0.1 && st[1] == -1.0))) {
-
-      return ((1.0 / 2240.0) * M_SQRT2 * (pow(mix[1], 2) - 5) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (21 * M_SQRT2 * pow(mix[2], 2) + 16 * sqrt(7) * mix[2] - 4 * M_SQRT2) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -1.0)))
+      return ang_dist_4_043;
     // 0^+ → 1^+ → 1 → 4
     if ((std::abs(st[2]) == 1.0 && std::abs(st[3]) == 4.0) &&
         ((st[0] == 0. && st[1] == 1.0) ||
-         (st[0] == -0.1 && st[1] == -1.0))) {
-
-      return ((1.0 / 1600.0) * M_SQRT2 * (pow(mix[1], 2) - 5) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (17 * M_SQRT2 * pow(mix[2], 2) + 10 * sqrt(6) * mix[2] - 5 * M_SQRT2) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -1.0)))
+      return ang_dist_4_044;
     // 0^+ → 1^+ → 1 → 5
     if ((std::abs(st[2]) == 1.0 && std::abs(st[3]) == 5.0) &&
         ((st[0] == 0. && st[1] == 1.0) ||
-         (st[0] == -0.1 && st[1] == -1.0))) {
-
-      return ((1.0 / 8800.0) * M_SQRT2 * (pow(mix[1], 2) - 5) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (99 * M_SQRT2 * pow(mix[2], 2) + 24 * sqrt(22) * mix[2] - 34 * M_SQRT2) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -1.0)))
+      return ang_dist_4_045;
     // 0^+ → 1^+ → 1 → 6
     if ((std::abs(st[2]) == 1.0 && std::abs(st[3]) == 6.0) &&
         ((st[0] == 0. && st[1] == 1.0) ||
-         (st[0] == -0.1 && st[1] == -1.0))) {
-
-      return ((1.0 / 14560.0) * M_SQRT2 * (pow(mix[1], 2) - 5) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (169 * M_SQRT2 * pow(mix[2], 2) + 14 * sqrt(130) * mix[2] - 63 * M_SQRT2) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -1.0)))
+      return ang_dist_4_046;
     // 0^+ → 1^+ → 2 → 0
     if ((std::abs(st[2]) == 2.0 && std::abs(st[3]) == 0.0) &&
         ((st[0] == 0. && st[1] == 1.0) ||
-         (st[0] == -0.1 && st[1] == -1.0))) {
-
-      return (pow(mix[1], 2) + (1.0 / 8.0) * (pow(mix[1], 2) - 1) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) + 1) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -1.0)))
+      return ang_dist_4_047;
     // 0^+ → 1^+ → 2 → 1
     if ((std::abs(st[2]) == 2.0 && std::abs(st[3]) == 1.0) &&
         ((st[0] == 0. && st[1] == 1.0) ||
-         (st[0] == -0.1 && st[1] == -1.0))) {
-
-      return ((1.0 / 5600.0) * sqrt(70) * (pow(mix[1], 2) - 1) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (5 * sqrt(70) * pow(mix[2], 2) + 70 * sqrt(14) * mix[2] - 7 * sqrt(70)) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -1.0)))
+      return ang_dist_4_048;
     // 0^+ → 1^+ → 2 → 2
     if ((std::abs(st[2]) == 2.0 && std::abs(st[3]) == 2.0) &&
         ((st[0] == 0. && st[1] == 1.0) ||
-         (st[0] == -0.1 && st[1] == -1.0))) {
-
-      return ((1.0 / 39200.0) * sqrt(70) * (pow(mix[1], 2) - 1) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (-15 * sqrt(70) * pow(mix[2], 2) + 490 * sqrt(6) * mix[2] + 49 * sqrt(70)) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -1.0)))
+      return ang_dist_4_049;
     // 0^+ → 1^+ → 2 → 3
     if ((std::abs(st[2]) == 2.0 && std::abs(st[3]) == 3.0) &&
         ((st[0] == 0. && st[1] == 1.0) ||
-         (st[0] == -0.1 && st[1] == -1.0))) {
-
-      return (-1.0 / 19600.0 * sqrt(70) * (pow(mix[1], 2) - 1) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (20 * sqrt(70) * pow(mix[2], 2) + 140 * sqrt(21) * mix[2] + 7 * sqrt(70)) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -1.0)))
+      return ang_dist_4_050;
     // 0^+ → 1^+ → 2 → 4
     if ((std::abs(st[2]) == 2.0 && std::abs(st[3]) == 4.0) &&
         ((st[0] == 0. && st[1] == 1.0) ||
-         (st[0] == -0.1 && st[1] == -1.0))) {
-
-      return (-1.0 / 15680.0 * sqrt(70) * (pow(mix[1], 2) - 1) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (21 * sqrt(70) * pow(mix[2], 2) + 280 * M_SQRT2 * mix[2] - 8 * sqrt(70)) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -1.0)))
+      return ang_dist_4_051;
     // 0^+ → 1^+ → 2 → 5
     if ((std::abs(st[2]) == 2.0 && std::abs(st[3]) == 5.0) &&
         ((st[0] == 0. && st[1] == 1.0) ||
-         (st[0] == -0.1 && st[1] == -1.0))) {
-
-      return (-1.0 / 12320.0 * sqrt(70) * (pow(mix[1], 2) - 1) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (17 * sqrt(70) * pow(mix[2], 2) + 66 * sqrt(14) * mix[2] - 11 * sqrt(70)) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -1.0)))
+      return ang_dist_4_052;
     // 0^+ → 1^+ → 2 → 6
     if ((std::abs(st[2]) == 2.0 && std::abs(st[3]) == 6.0) &&
         ((st[0] == 0. && st[1] == 1.0) ||
-         (st[0] == -0.1 && st[1] == -1.0))) {
-
-      return (-1.0 / 800800.0 * sqrt(70) * (pow(mix[1], 2) - 1) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (1089 * sqrt(70) * pow(mix[2], 2) + 728 * sqrt(330) * mix[2] - 884 * sqrt(70)) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -1.0)))
+      return ang_dist_4_053;
     // 0^+ → 1^+ → 3 → 0
     if ((std::abs(st[2]) == 3.0 && std::abs(st[3]) == 0.0) &&
         ((st[0] == 0. && st[1] == 1.0) ||
-         (st[0] == -0.1 && st[1] == -1.0))) {
-
-      return (pow(mix[1], 2) + (1.0 / 80.0) * (15 * pow(mix[1], 2) - 12) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) + 1) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -1.0)))
+      return ang_dist_4_054;
     // 0^+ → 1^+ → 3 → 1
     if ((std::abs(st[2]) == 3.0 && std::abs(st[3]) == 1.0) &&
         ((st[0] == 0. && st[1] == 1.0) ||
-         (st[0] == -0.1 && st[1] == -1.0))) {
-
-      return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + (1.0 / 2240.0) * sqrt(3) * (5 * pow(mix[1], 2) - 4) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (21 * sqrt(3) * pow(mix[2], 2) + 8 * sqrt(42) * mix[2] + 16 * sqrt(3))) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -1.0)))
+      return ang_dist_4_055;
     // 0^+ → 1^+ → 3 → 2
     if ((std::abs(st[2]) == 3.0 && std::abs(st[3]) == 2.0) &&
         ((st[0] == 0. && st[1] == 1.0) ||
-         (st[0] == -0.1 && st[1] == -1.0))) {
-
-      return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + (1.0 / 2800.0) * sqrt(3) * (5 * pow(mix[1], 2) - 4) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (5 * sqrt(3) * pow(mix[2], 2) + 42 * sqrt(10) * mix[2] - 14 * sqrt(3))) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -1.0)))
+      return ang_dist_4_056;
     // 0^+ → 1^+ → 3 → 3
     if ((std::abs(st[2]) == 3.0 && std::abs(st[3]) == 3.0) &&
         ((st[0] == 0. && st[1] == 1.0) ||
-         (st[0] == -0.1 && st[1] == -1.0))) {
-
-      return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + (1.0 / 1120.0) * (5 * pow(mix[1], 2) - 4) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (-11 * pow(mix[2], 2) + 42 * mix[2] + 21)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -1.0)))
+      return ang_dist_4_057;
     // 0^+ → 1^+ → 3 → 4
     if ((std::abs(st[2]) == 3.0 && std::abs(st[3]) == 4.0) &&
         ((st[0] == 0. && st[1] == 1.0) ||
-         (st[0] == -0.1 && st[1] == -1.0))) {
-
-      return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) - 1.0 / 1120.0 * (5 * pow(mix[1], 2) - 4) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (15 * pow(mix[2], 2) + 70 * mix[2] + 7)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -1.0)))
+      return ang_dist_4_058;
     // 0^+ → 1^+ → 3 → 5
     if ((std::abs(st[2]) == 3.0 && std::abs(st[3]) == 5.0) &&
         ((st[0] == 0. && st[1] == 1.0) ||
-         (st[0] == -0.1 && st[1] == -1.0))) {
-
-      return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) - 1.0 / 1344.0 * sqrt(3) * (5 * pow(mix[1], 2) - 4) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (7 * sqrt(3) * pow(mix[2], 2) + 8 * sqrt(21) * mix[2] - 4 * sqrt(3))) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -1.0)))
+      return ang_dist_4_059;
     // 0^+ → 1^+ → 3 → 6
     if ((std::abs(st[2]) == 3.0 && std::abs(st[3]) == 6.0) &&
         ((st[0] == 0. && st[1] == 1.0) ||
-         (st[0] == -0.1 && st[1] == -1.0))) {
-
-      return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) - 1.0 / 10560.0 * sqrt(3) * (5 * pow(mix[1], 2) - 4) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (51 * sqrt(3) * pow(mix[2], 2) + 22 * sqrt(105) * mix[2] - 55 * sqrt(3))) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -1.0)))
+      return ang_dist_4_060;
     // 0^+ → 1^+ → 4 → 0
     if ((std::abs(st[2]) == 4.0 && std::abs(st[3]) == 0.0) &&
         ((st[0] == 0. && st[1] == 1.0) ||
-         (st[0] == -0.1 && st[1] == -1.0))) {
-
-      return (pow(mix[1], 2) + (1.0 / 560.0) * (119 * pow(mix[1], 2) - 85) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) + 1) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -1.0)))
+      return ang_dist_4_061;
     // 0^+ → 1^+ → 4 → 1
     if ((std::abs(st[2]) == 4.0 && std::abs(st[3]) == 1.0) &&
         ((st[0] == 0. && st[1] == 1.0) ||
-         (st[0] == -0.1 && st[1] == -1.0))) {
-
-      return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + (1.0 / 862400.0) * sqrt(77) * (7 * pow(mix[1], 2) - 5) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (289 * sqrt(77) * pow(mix[2], 2) + 110 * sqrt(231) * mix[2] + 275 * sqrt(77))) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -1.0)))
+      return ang_dist_4_062;
     // 0^+ → 1^+ → 4 → 2
     if ((std::abs(st[2]) == 4.0 && std::abs(st[3]) == 2.0) &&
         ((st[0] == 0. && st[1] == 1.0) ||
-         (st[0] == -0.1 && st[1] == -1.0))) {
-
-      return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + (1.0 / 109760.0) * sqrt(77) * (7 * pow(mix[1], 2) - 5) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (21 * sqrt(77) * pow(mix[2], 2) + 56 * sqrt(55) * mix[2] + 20 * sqrt(77))) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -1.0)))
+      return ang_dist_4_063;
     // 0^+ → 1^+ → 4 → 3
     if ((std::abs(st[2]) == 4.0 && std::abs(st[3]) == 3.0) &&
         ((st[0] == 0. && st[1] == 1.0) ||
-         (st[0] == -0.1 && st[1] == -1.0))) {
-
-      return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + (11.0 / 7840.0) * (7 * pow(mix[1], 2) - 5) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (pow(mix[2], 2) + 42 * mix[2] - 7)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -1.0)))
+      return ang_dist_4_064;
     // 0^+ → 1^+ → 4 → 4
     if ((std::abs(st[2]) == 4.0 && std::abs(st[3]) == 4.0) &&
         ((st[0] == 0. && st[1] == 1.0) ||
-         (st[0] == -0.1 && st[1] == -1.0))) {
-
-      return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + (1.0 / 3018400.0) * sqrt(77) * (7 * pow(mix[1], 2) - 5) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (-325 * sqrt(77) * pow(mix[2], 2) + 3234 * sqrt(5) * mix[2] + 539 * sqrt(77))) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -1.0)))
+      return ang_dist_4_065;
     // 0^+ → 1^+ → 4 → 5
     if ((std::abs(st[2]) == 4.0 && std::abs(st[3]) == 5.0) &&
         ((st[0] == 0. && st[1] == 1.0) ||
-         (st[0] == -0.1 && st[1] == -1.0))) {
-
-      return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) - 1.0 / 215600.0 * sqrt(77) * (7 * pow(mix[1], 2) - 5) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (25 * sqrt(77) * pow(mix[2], 2) + 42 * sqrt(770) * mix[2] + 14 * sqrt(77))) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -1.0)))
+      return ang_dist_4_066;
     // 0^+ → 1^+ → 4 → 6
     if ((std::abs(st[2]) == 4.0 && std::abs(st[3]) == 6.0) &&
         ((st[0] == 0. && st[1] == 1.0) ||
-         (st[0] == -0.1 && st[1] == -1.0))) {
-
-      return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) - 1.0 / 172480.0 * sqrt(77) * (7 * pow(mix[1], 2) - 5) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (21 * sqrt(77) * pow(mix[2], 2) + 56 * sqrt(154) * mix[2] - 16 * sqrt(77))) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -1.0)))
+      return ang_dist_4_067;
     // 0^+ → 2^+ → 0 → 1
     if ((std::abs(st[2]) == 0.0 && std::abs(st[3]) == 1.0) &&
         ((st[0] == 0. && st[1] == 2.0) ||
-         (st[0] == -0.1 && st[1] == -2.0))) {
-
-      return 1 / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -2.0)))
+      return ang_dist_4_068;
     // 0^+ → 2^+ → 0 → 2
     if ((std::abs(st[2]) == 0.0 && std::abs(st[3]) == 2.0) &&
         ((st[0] == 0. && st[1] == 2.0) ||
-         (st[0] == -0.1 && st[1] == -2.0))) {
-
-      return 1 / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -2.0)))
+      return ang_dist_4_069;
     // 0^+ → 2^+ → 0 → 3
     if ((std::abs(st[2]) == 0.0 && std::abs(st[3]) == 3.0) &&
         ((st[0] == 0. && st[1] == 2.0) ||
-         (st[0] == -0.1 && st[1] == -2.0))) {
-
-      return 1 / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -2.0)))
+      return ang_dist_4_070;
     // 0^+ → 2^+ → 0 → 4
     if ((std::abs(st[2]) == 0.0 && std::abs(st[3]) == 4.0) &&
         ((st[0] == 0. && st[1] == 2.0) ||
-         (st[0] == -0.1 && st[1] == -2.0))) {
-
-      return 1 / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -2.0)))
+      return ang_dist_4_071;
     // 0^+ → 2^+ → 0 → 5
     if ((std::abs(st[2]) == 0.0 && std::abs(st[3]) == 5.0) &&
         ((st[0] == 0. && st[1] == 2.0) ||
-         (st[0] == -0.1 && st[1] == -2.0))) {
-
-      return 1 / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -2.0)))
+      return ang_dist_4_072;
     // 0^+ → 2^+ → 0 → 6
     if ((std::abs(st[2]) == 0.0 && std::abs(st[3]) == 6.0) &&
         ((st[0] == 0. && st[1] == 2.0) ||
-         (st[0] == -0.1 && st[1] == -2.0))) {
-
-      return 1 / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -2.0)))
+      return ang_dist_4_073;
     // 0^+ → 2^+ → 1 → 0
     if ((std::abs(st[2]) == 1.0 && std::abs(st[3]) == 0.0) &&
         ((st[0] == 0. && st[1] == 2.0) ||
-         (st[0] == -0.1 && st[1] == -2.0))) {
-
-      return (pow(mix[1], 2) + (1.0 / 8.0) * (pow(mix[1], 2) - 1) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) + 1) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -2.0)))
+      return ang_dist_4_074;
     // 0^+ → 2^+ → 1 → 1
     if ((std::abs(st[2]) == 1.0 && std::abs(st[3]) == 1.0) &&
         ((st[0] == 0. && st[1] == 2.0) ||
-         (st[0] == -0.1 && st[1] == -2.0))) {
-
-      return (-1.0 / 16.0 * (pow(mix[1], 2) - 1) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (pow(mix[2], 2) + 6 * mix[2] + 1) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -2.0)))
+      return ang_dist_4_075;
     // 0^+ → 2^+ → 1 → 2
     if ((std::abs(st[2]) == 1.0 && std::abs(st[3]) == 2.0) &&
         ((st[0] == 0. && st[1] == 2.0) ||
-         (st[0] == -0.1 && st[1] == -2.0))) {
-
-      return ((1.0 / 160.0) * M_SQRT2 * (pow(mix[1], 2) - 1) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (5 * M_SQRT2 * pow(mix[2], 2) + 6 * sqrt(10) * mix[2] + M_SQRT2) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -2.0)))
+      return ang_dist_4_076;
     // 0^+ → 2^+ → 1 → 3
     if ((std::abs(st[2]) == 1.0 && std::abs(st[3]) == 3.0) &&
         ((st[0] == 0. && st[1] == 2.0) ||
-         (st[0] == -0.1 && st[1] == -2.0))) {
-
-      return ((1.0 / 448.0) * M_SQRT2 * (pow(mix[1], 2) - 1) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (21 * M_SQRT2 * pow(mix[2], 2) + 16 * sqrt(7) * mix[2] - 4 * M_SQRT2) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -2.0)))
+      return ang_dist_4_077;
     // 0^+ → 2^+ → 1 → 4
     if ((std::abs(st[2]) == 1.0 && std::abs(st[3]) == 4.0) &&
         ((st[0] == 0. && st[1] == 2.0) ||
-         (st[0] == -0.1 && st[1] == -2.0))) {
-
-      return ((1.0 / 320.0) * M_SQRT2 * (pow(mix[1], 2) - 1) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (17 * M_SQRT2 * pow(mix[2], 2) + 10 * sqrt(6) * mix[2] - 5 * M_SQRT2) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -2.0)))
+      return ang_dist_4_078;
     // 0^+ → 2^+ → 1 → 5
     if ((std::abs(st[2]) == 1.0 && std::abs(st[3]) == 5.0) &&
         ((st[0] == 0. && st[1] == 2.0) ||
-         (st[0] == -0.1 && st[1] == -2.0))) {
-
-      return ((1.0 / 1760.0) * M_SQRT2 * (pow(mix[1], 2) - 1) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (99 * M_SQRT2 * pow(mix[2], 2) + 24 * sqrt(22) * mix[2] - 34 * M_SQRT2) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -2.0)))
+      return ang_dist_4_079;
     // 0^+ → 2^+ → 1 → 6
     if ((std::abs(st[2]) == 1.0 && std::abs(st[3]) == 6.0) &&
         ((st[0] == 0. && st[1] == 2.0) ||
-         (st[0] == -0.1 && st[1] == -2.0))) {
-
-      return ((1.0 / 2912.0) * M_SQRT2 * (pow(mix[1], 2) - 1) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (169 * M_SQRT2 * pow(mix[2], 2) + 14 * sqrt(130) * mix[2] - 63 * M_SQRT2) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -2.0)))
+      return ang_dist_4_080;
     // 0^+ → 2^+ → 2 → 0
     if ((std::abs(st[2]) == 2.0 && std::abs(st[3]) == 0.0) &&
         ((st[0] == 0. && st[1] == 2.0) ||
-         (st[0] == -0.1 && st[1] == -2.0))) {
-
-      return (1.0 / 1176.0) * (1176 * pow(mix[1], 2) + (-45 * pow(mix[1], 2) + 105) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) + (48 * pow(mix[1], 2) - 112) * (-5 * (7 * pow(cos(theta), 2) - 1) * pow(sin(theta), 2) * cos(2 * phi) + 35 * pow(cos(theta), 4) - 30 * pow(cos(theta), 2) + 3) + 1176) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -2.0)))
+      return ang_dist_4_081;
     // 0^+ → 2^+ → 2 → 1
     if ((std::abs(st[2]) == 2.0 && std::abs(st[3]) == 1.0) &&
         ((st[0] == 0. && st[1] == 2.0) ||
-         (st[0] == -0.1 && st[1] == -2.0))) {
-
-      return (-4.0 / 441.0 * pow(mix[2], 2) * (3 * pow(mix[1], 2) - 7) * (-5 * (7 * pow(cos(theta), 2) - 1) * pow(sin(theta), 2) * cos(2 * phi) + 35 * pow(cos(theta), 4) - 30 * pow(cos(theta), 2) + 3) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) - 1.0 / 54880.0 * sqrt(70) * (3 * pow(mix[1], 2) - 7) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (5 * sqrt(70) * pow(mix[2], 2) + 70 * sqrt(14) * mix[2] - 7 * sqrt(70))) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -2.0)))
+      return ang_dist_4_082;
     // 0^+ → 2^+ → 2 → 2
     if ((std::abs(st[2]) == 2.0 && std::abs(st[3]) == 2.0) &&
         ((st[0] == 0. && st[1] == 2.0) ||
-         (st[0] == -0.1 && st[1] == -2.0))) {
-
-      return ((4.0 / 1029.0) * pow(mix[2], 2) * (3 * pow(mix[1], 2) - 7) * (-5 * (7 * pow(cos(theta), 2) - 1) * pow(sin(theta), 2) * cos(2 * phi) + 35 * pow(cos(theta), 4) - 30 * pow(cos(theta), 2) + 3) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) - 1.0 / 384160.0 * sqrt(70) * (3 * pow(mix[1], 2) - 7) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (-15 * sqrt(70) * pow(mix[2], 2) + 490 * sqrt(6) * mix[2] + 49 * sqrt(70))) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -2.0)))
+      return ang_dist_4_083;
     // 0^+ → 2^+ → 2 → 3
     if ((std::abs(st[2]) == 2.0 && std::abs(st[3]) == 3.0) &&
         ((st[0] == 0. && st[1] == 2.0) ||
-         (st[0] == -0.1 && st[1] == -2.0))) {
-
-      return (-1.0 / 1029.0 * pow(mix[2], 2) * (3 * pow(mix[1], 2) - 7) * (-5 * (7 * pow(cos(theta), 2) - 1) * pow(sin(theta), 2) * cos(2 * phi) + 35 * pow(cos(theta), 4) - 30 * pow(cos(theta), 2) + 3) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + (1.0 / 192080.0) * sqrt(70) * (3 * pow(mix[1], 2) - 7) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (20 * sqrt(70) * pow(mix[2], 2) + 140 * sqrt(21) * mix[2] + 7 * sqrt(70))) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -2.0)))
+      return ang_dist_4_084;
     // 0^+ → 2^+ → 2 → 4
     if ((std::abs(st[2]) == 2.0 && std::abs(st[3]) == 4.0) &&
         ((st[0] == 0. && st[1] == 2.0) ||
-         (st[0] == -0.1 && st[1] == -2.0))) {
-
-      return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + (1.0 / 153664.0) * sqrt(70) * (3 * pow(mix[1], 2) - 7) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (21 * sqrt(70) * pow(mix[2], 2) + 280 * M_SQRT2 * mix[2] - 8 * sqrt(70)) + (1.0 / 259308.0) * sqrt(14) * (3 * pow(mix[1], 2) - 7) * (7 * sqrt(14) * pow(mix[2], 2) + 35 * sqrt(10) * mix[2] + 2 * sqrt(14)) * (-5 * (7 * pow(cos(theta), 2) - 1) * pow(sin(theta), 2) * cos(2 * phi) + 35 * pow(cos(theta), 4) - 30 * pow(cos(theta), 2) + 3)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -2.0)))
+      return ang_dist_4_085;
     // 0^+ → 2^+ → 2 → 5
     if ((std::abs(st[2]) == 2.0 && std::abs(st[3]) == 5.0) &&
         ((st[0] == 0. && st[1] == 2.0) ||
-         (st[0] == -0.1 && st[1] == -2.0))) {
-
-      return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + (1.0 / 120736.0) * sqrt(70) * (3 * pow(mix[1], 2) - 7) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (17 * sqrt(70) * pow(mix[2], 2) + 66 * sqrt(14) * mix[2] - 11 * sqrt(70)) + (1.0 / 271656.0) * sqrt(14) * (3 * pow(mix[1], 2) - 7) * (27 * sqrt(14) * pow(mix[2], 2) + 18 * sqrt(70) * mix[2] - sqrt(14)) * (-5 * (7 * pow(cos(theta), 2) - 1) * pow(sin(theta), 2) * cos(2 * phi) + 35 * pow(cos(theta), 4) - 30 * pow(cos(theta), 2) + 3)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -2.0)))
+      return ang_dist_4_086;
     // 0^+ → 2^+ → 2 → 6
     if ((std::abs(st[2]) == 2.0 && std::abs(st[3]) == 6.0) &&
         ((st[0] == 0. && st[1] == 2.0) ||
-         (st[0] == -0.1 && st[1] == -2.0))) {
-
-      return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + (1.0 / 7847840.0) * sqrt(70) * (3 * pow(mix[1], 2) - 7) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (1089 * sqrt(70) * pow(mix[2], 2) + 728 * sqrt(330) * mix[2] - 884 * sqrt(70)) + (1.0 / 588588.0) * sqrt(14) * (3 * pow(mix[1], 2) - 7) * (88 * sqrt(14) * pow(mix[2], 2) + 42 * sqrt(66) * mix[2] - 9 * sqrt(14)) * (-5 * (7 * pow(cos(theta), 2) - 1) * pow(sin(theta), 2) * cos(2 * phi) + 35 * pow(cos(theta), 4) - 30 * pow(cos(theta), 2) + 3)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -2.0)))
+      return ang_dist_4_087;
     // 0^+ → 2^+ → 3 → 0
     if ((std::abs(st[2]) == 3.0 && std::abs(st[3]) == 0.0) &&
         ((st[0] == 0. && st[1] == 2.0) ||
-         (st[0] == -0.1 && st[1] == -2.0))) {
-
-      return (1.0 / 168.0) * (168 * pow(mix[1], 2) + (3 * pow(mix[1], 2) - 2) * (-5 * (7 * pow(cos(theta), 2) - 1) * pow(sin(theta), 2) * cos(2 * phi) + 35 * pow(cos(theta), 4) - 30 * pow(cos(theta), 2) + 3) + (9 * pow(mix[1], 2) + 36) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) + 168) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -2.0)))
+      return ang_dist_4_088;
     // 0^+ → 2^+ → 3 → 1
     if ((std::abs(st[2]) == 3.0 && std::abs(st[3]) == 1.0) &&
         ((st[0] == 0. && st[1] == 2.0) ||
-         (st[0] == -0.1 && st[1] == -2.0))) {
-
-      return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + (1.0 / 1568.0) * sqrt(3) * (pow(mix[1], 2) + 4) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (21 * sqrt(3) * pow(mix[2], 2) + 8 * sqrt(42) * mix[2] + 16 * sqrt(3)) + (1.0 / 155232.0) * sqrt(22) * (3 * pow(mix[1], 2) - 2) * (7 * sqrt(22) * pow(mix[2], 2) + 220 * sqrt(77) * mix[2] - 88 * sqrt(22)) * (-5 * (7 * pow(cos(theta), 2) - 1) * pow(sin(theta), 2) * cos(2 * phi) + 35 * pow(cos(theta), 4) - 30 * pow(cos(theta), 2) + 3)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -2.0)))
+      return ang_dist_4_089;
     // 0^+ → 2^+ → 3 → 2
     if ((std::abs(st[2]) == 3.0 && std::abs(st[3]) == 2.0) &&
         ((st[0] == 0. && st[1] == 2.0) ||
-         (st[0] == -0.1 && st[1] == -2.0))) {
-
-      return ((11.0 / 588.0) * pow(mix[2], 2) * (3 * pow(mix[1], 2) - 2) * (-5 * (7 * pow(cos(theta), 2) - 1) * pow(sin(theta), 2) * cos(2 * phi) + 35 * pow(cos(theta), 4) - 30 * pow(cos(theta), 2) + 3) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + (1.0 / 1960.0) * sqrt(3) * (pow(mix[1], 2) + 4) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (5 * sqrt(3) * pow(mix[2], 2) + 42 * sqrt(10) * mix[2] - 14 * sqrt(3))) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -2.0)))
+      return ang_dist_4_090;
     // 0^+ → 2^+ → 3 → 3
     if ((std::abs(st[2]) == 3.0 && std::abs(st[3]) == 3.0) &&
         ((st[0] == 0. && st[1] == 2.0) ||
-         (st[0] == -0.1 && st[1] == -2.0))) {
-
-      return (-11.0 / 882.0 * pow(mix[2], 2) * (3 * pow(mix[1], 2) - 2) * (-5 * (7 * pow(cos(theta), 2) - 1) * pow(sin(theta), 2) * cos(2 * phi) + 35 * pow(cos(theta), 4) - 30 * pow(cos(theta), 2) + 3) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + (1.0 / 784.0) * (pow(mix[1], 2) + 4) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (-11 * pow(mix[2], 2) + 42 * mix[2] + 21)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -2.0)))
+      return ang_dist_4_091;
     // 0^+ → 2^+ → 3 → 4
     if ((std::abs(st[2]) == 3.0 && std::abs(st[3]) == 4.0) &&
         ((st[0] == 0. && st[1] == 2.0) ||
-         (st[0] == -0.1 && st[1] == -2.0))) {
-
-      return ((11.0 / 2646.0) * pow(mix[2], 2) * (3 * pow(mix[1], 2) - 2) * (-5 * (7 * pow(cos(theta), 2) - 1) * pow(sin(theta), 2) * cos(2 * phi) + 35 * pow(cos(theta), 4) - 30 * pow(cos(theta), 2) + 3) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) - 1.0 / 784.0 * (pow(mix[1], 2) + 4) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (15 * pow(mix[2], 2) + 70 * mix[2] + 7)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -2.0)))
+      return ang_dist_4_092;
     // 0^+ → 2^+ → 3 → 5
     if ((std::abs(st[2]) == 3.0 && std::abs(st[3]) == 5.0) &&
         ((st[0] == 0. && st[1] == 2.0) ||
-         (st[0] == -0.1 && st[1] == -2.0))) {
-
-      return (1.0 / 1707552.0) * (1707552 * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) - 1815 * sqrt(3) * (pow(mix[1], 2) + 4) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (7 * sqrt(3) * pow(mix[2], 2) + 8 * sqrt(21) * mix[2] - 4 * sqrt(3)) - sqrt(22) * (3 * pow(mix[1], 2) - 2) * (119 * sqrt(22) * pow(mix[2], 2) + 220 * sqrt(154) * mix[2] + 44 * sqrt(22)) * (-5 * (7 * pow(cos(theta), 2) - 1) * pow(sin(theta), 2) * cos(2 * phi) + 35 * pow(cos(theta), 4) - 30 * pow(cos(theta), 2) + 3)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -2.0)))
+      return ang_dist_4_093;
     // 0^+ → 2^+ → 3 → 6
     if ((std::abs(st[2]) == 3.0 && std::abs(st[3]) == 6.0) &&
         ((st[0] == 0. && st[1] == 2.0) ||
-         (st[0] == -0.1 && st[1] == -2.0))) {
-
-      return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) - 1.0 / 7392.0 * sqrt(3) * (pow(mix[1], 2) + 4) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (51 * sqrt(3) * pow(mix[2], 2) + 22 * sqrt(105) * mix[2] - 55 * sqrt(3)) - 1.0 / 1057056.0 * sqrt(22) * (3 * pow(mix[1], 2) - 2) * (261 * sqrt(22) * pow(mix[2], 2) + 78 * sqrt(770) * mix[2] - 13 * sqrt(22)) * (-5 * (7 * pow(cos(theta), 2) - 1) * pow(sin(theta), 2) * cos(2 * phi) + 35 * pow(cos(theta), 4) - 30 * pow(cos(theta), 2) + 3)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -2.0)))
+      return ang_dist_4_094;
     // 0^+ → 2^+ → 4 → 0
     if ((std::abs(st[2]) == 4.0 && std::abs(st[3]) == 0.0) &&
         ((st[0] == 0. && st[1] == 2.0) ||
-         (st[0] == -0.1 && st[1] == -2.0))) {
-
-      return (1.0 / 784.0) * (784 * pow(mix[1], 2) + (17 * pow(mix[1], 2) + 170) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) + (36 * pow(mix[1], 2) - 18) * (-5 * (7 * pow(cos(theta), 2) - 1) * pow(sin(theta), 2) * cos(2 * phi) + 35 * pow(cos(theta), 4) - 30 * pow(cos(theta), 2) + 3) + 784) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -2.0)))
+      return ang_dist_4_095;
     // 0^+ → 2^+ → 4 → 1
     if ((std::abs(st[2]) == 4.0 && std::abs(st[3]) == 1.0) &&
         ((st[0] == 0. && st[1] == 2.0) ||
-         (st[0] == -0.1 && st[1] == -2.0))) {
-
-      return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + (1.0 / 1207360.0) * sqrt(77) * (pow(mix[1], 2) + 10) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (289 * sqrt(77) * pow(mix[2], 2) + 110 * sqrt(231) * mix[2] + 275 * sqrt(77)) + (1.0 / 4708704.0) * sqrt(2002) * (2 * pow(mix[1], 2) - 1) * (27 * sqrt(2002) * pow(mix[2], 2) + 78 * sqrt(6006) * mix[2] + 13 * sqrt(2002)) * (-5 * (7 * pow(cos(theta), 2) - 1) * pow(sin(theta), 2) * cos(2 * phi) + 35 * pow(cos(theta), 4) - 30 * pow(cos(theta), 2) + 3)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -2.0)))
+      return ang_dist_4_096;
     // 0^+ → 2^+ → 4 → 2
     if ((std::abs(st[2]) == 4.0 && std::abs(st[3]) == 2.0) &&
         ((st[0] == 0. && st[1] == 2.0) ||
-         (st[0] == -0.1 && st[1] == -2.0))) {
-
-      return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + (1.0 / 153664.0) * sqrt(77) * (pow(mix[1], 2) + 10) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (21 * sqrt(77) * pow(mix[2], 2) + 56 * sqrt(55) * mix[2] + 20 * sqrt(77)) - 1.0 / 7606368.0 * sqrt(2002) * (2 * pow(mix[1], 2) - 1) * (7 * sqrt(2002) * pow(mix[2], 2) - 308 * sqrt(1430) * mix[2] + 44 * sqrt(2002)) * (-5 * (7 * pow(cos(theta), 2) - 1) * pow(sin(theta), 2) * cos(2 * phi) + 35 * pow(cos(theta), 4) - 30 * pow(cos(theta), 2) + 3)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -2.0)))
+      return ang_dist_4_097;
     // 0^+ → 2^+ → 4 → 3
     if ((std::abs(st[2]) == 4.0 && std::abs(st[3]) == 3.0) &&
         ((st[0] == 0. && st[1] == 2.0) ||
-         (st[0] == -0.1 && st[1] == -2.0))) {
-
-      return (1.0 / 98784.0) * (2288 * pow(mix[2], 2) * (2 * pow(mix[1], 2) - 1) * (-5 * (7 * pow(cos(theta), 2) - 1) * pow(sin(theta), 2) * cos(2 * phi) + 35 * pow(cos(theta), 4) - 30 * pow(cos(theta), 2) + 3) + 98784 * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + 99 * (pow(mix[1], 2) + 10) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (pow(mix[2], 2) + 42 * mix[2] - 7)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -2.0)))
+      return ang_dist_4_098;
     // 0^+ → 2^+ → 4 → 4
     if ((std::abs(st[2]) == 4.0 && std::abs(st[3]) == 4.0) &&
         ((st[0] == 0. && st[1] == 2.0) ||
-         (st[0] == -0.1 && st[1] == -2.0))) {
-
-      return (1.0 / 4225760.0) * (-80080 * pow(mix[2], 2) * (2 * pow(mix[1], 2) - 1) * (-5 * (7 * pow(cos(theta), 2) - 1) * pow(sin(theta), 2) * cos(2 * phi) + 35 * pow(cos(theta), 4) - 30 * pow(cos(theta), 2) + 3) + 4225760 * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) + sqrt(77) * (pow(mix[1], 2) + 10) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (-325 * sqrt(77) * pow(mix[2], 2) + 3234 * sqrt(5) * mix[2] + 539 * sqrt(77))) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -2.0)))
+      return ang_dist_4_099;
     // 0^+ → 2^+ → 4 → 5
     if ((std::abs(st[2]) == 4.0 && std::abs(st[3]) == 5.0) &&
         ((st[0] == 0. && st[1] == 2.0) ||
-         (st[0] == -0.1 && st[1] == -2.0))) {
-
-      return ((13.0 / 1764.0) * pow(mix[2], 2) * (2 * pow(mix[1], 2) - 1) * (-5 * (7 * pow(cos(theta), 2) - 1) * pow(sin(theta), 2) * cos(2 * phi) + 35 * pow(cos(theta), 4) - 30 * pow(cos(theta), 2) + 3) + (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) - 1.0 / 301840.0 * sqrt(77) * (pow(mix[1], 2) + 10) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (25 * sqrt(77) * pow(mix[2], 2) + 42 * sqrt(770) * mix[2] + 14 * sqrt(77))) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+         (st[0] == -0.1 && st[1] == -2.0)))
+      return ang_dist_4_100;
     // 0^+ → 2^+ → 4 → 6
     if ((std::abs(st[2]) == 4.0 && std::abs(st[3]) == 6.0) &&
         ((st[0] == 0. && st[1] == 2.0) ||
-         (st[0] == -0.1 && st[1] == -2.0))) {
+         (st[0] == -0.1 && st[1] == -2.0)))
+      return ang_dist_4_101;
+  }
+
+  return nullptr;
+}
+
+AngDistBatchFunction AngularDistribution::GetAngDistBatchFunction(const double *st, int nst) const {
 
-      return ((pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1) - 1.0 / 241472.0 * sqrt(77) * (pow(mix[1], 2) + 10) * (-6 * pow(sin(phi), 2) * pow(sin(theta), 2) + 2) * (21 * sqrt(77) * pow(mix[2], 2) + 56 * sqrt(154) * mix[2] - 16 * sqrt(77)) - 1.0 / 155387232.0 * sqrt(2002) * (2 * pow(mix[1], 2) - 1) * (203 * sqrt(2002) * pow(mix[2], 2) + 1540 * sqrt(1001) * mix[2] + 88 * sqrt(2002)) * (-5 * (7 * pow(cos(theta), 2) - 1) * pow(sin(theta), 2) * cos(2 * phi) + 35 * pow(cos(theta), 4) - 30 * pow(cos(theta), 2) + 3)) / ((pow(mix[0], 2) + 1) * (pow(mix[1], 2) + 1) * (pow(mix[2], 2) + 1));
-    }
+  AngDistFunction ang_dist = GetAngDistFunction(st, nst);
+  for (auto entry : ang_dist_batch_functions) {
+    if (entry.ang_dist == ang_dist)
+      return entry.ang_dist_batch;
   }
-  cerr << "ERROR: AngularDistributionGenerator:: Required spin sequence not found." << endl;
-  throw std::exception();
+
+  return nullptr;
+}
+
+double AngularDistribution::AngDist(
+    double theta, double phi, double *st,
+    int nst, double *mix) const {
+
+  AngDistFunction ang_dist = GetAngDistFunction(st, nst);
+  if (ang_dist == nullptr) {
+    cerr << "ERROR: AngularDistributionGenerator:: Required spin sequence not found." << endl;
+    throw std::exception();
+  }
+
+  return ang_dist(theta, phi, mix);
 }
@@ -18,10 +18,11 @@ You should have received a copy of the GNU General Public License
 along with utr.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
+
 #include "G4Event.hh"
 #include "G4ParticleGun.hh"
 #include "G4ParticleTable.hh"
-#include "G4TransportationManager.hh"
 #include "G4VUserPrimaryGeneratorAction.hh"
 #include "Randomize.hh"
 
@@ -30,10 +31,21 @@ along with utr.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "AngularDistributionGenerator.hh"
 #include "AngularDistributionMessenger.hh"
+#include "EventTimer.hh"
+#include "utrParallelSampling.hh"
+#include "utrRandom.hh"
 
 #define MAX_ALLOWED_FAIL_CHANCE 1e-6
+#define MAX_ALLOWED_INVERSE_CDF_DEVIATION 0.01
+
+std::mutex AngularDistributionGenerator::master_validation_mutex;
+G4bool AngularDistributionGenerator::master_checked_position_generator = false;
+G4bool AngularDistributionGenerator::master_checked_momentum_generator = false;
+G4double AngularDistributionGenerator::master_position_acceptance = 0.;
+G4double AngularDistributionGenerator::master_momentum_acceptance = 0.;
+G4double AngularDistributionGenerator::master_max_w = MAX_W;
 
-AngularDistributionGenerator::AngularDistributionGenerator() : G4VUserPrimaryGeneratorAction(), particleGun(0), angdist(0), checked_position_generator(false) {
+AngularDistributionGenerator::AngularDistributionGenerator() : G4VUserPrimaryGeneratorAction(), particleGun(0), angdist(0), ang_dist_states(nullptr), ang_dist_alt_states(nullptr), ang_dist_batch_states(nullptr), ang_dist_batch_alt_states(nullptr), max_w(MAX_W), momentum_acceptance(0.), use_inverse_cdf(false), next_position(0), checked_position_generator(false), checked_momentum_generator(false) {
   angDistMessenger = new AngularDistributionMessenger(this);
   angdist = new AngularDistribution();
 
@@ -42,8 +54,6 @@ AngularDistributionGenerator::AngularDistributionGenerator() : G4VUserPrimaryGen
   MAX_TRIES_MOMENTUM = 1e4;
 
   particleGun = new G4ParticleGun(1);
-
-  navi = G4TransportationManager::GetTransportationManager()->GetNavigatorForTracking();
 }
 
 AngularDistributionGenerator::~AngularDistributionGenerator() {
@@ -57,68 +67,80 @@ void AngularDistributionGenerator::GeneratePrimaries(G4Event *anEvent) {
   G4ThreeVector randomOrigin = G4ThreeVector(0., 0., 0.);
   G4ThreeVector randomDirection = G4ThreeVector(0., 0., 1.);
 
-  for (G4int i = 0; i < 4; ++i)
-    alt_states[i] = states[i];
-  if (states[1] == 0.) {
-    alt_states[1] = -0.1;
-  } else if (states[1] == -0.1) {
-    alt_states[1] = 0.;
-  } else {
-    alt_states[1] = -states[1];
-  }
+  if (ang_dist_states == nullptr)
+    resolve_angular_distribution();
+  if (!source_sampler.IsInitialized())
+    source_sampler.Initialize(source_PV_names, G4ThreeVector(source_x, source_y, source_z), G4ThreeVector(range_x, range_y, range_z));
+
+  use_master_validation();
 
 #ifdef CHECK_POSITION_GENERATOR
   check_position_generator();
 #endif
 #ifdef CHECK_MOMENTUM_GENERATOR
-  check_momentum_generator();
+  if (!use_inverse_cdf)
+    check_momentum_generator();
 #endif
+  if (use_inverse_cdf && !sampler.IsTabulated())
+    tabulate_angular_distribution();
+
+  // Seed the event after the initialization, which is only done in the first event of each thread
+  utrRandom::SeedEvent(anEvent);
+  if (EventTimer::Replay(anEvent)) {
+    return;
+  }
 
   G4bool position_found = false;
-  G4double random_x;
-  G4double random_y;
-  G4double random_z;
-  G4String pv;
 
   G4bool momentum_found = false;
   G4double random_theta;
   G4double random_phi;
   G4double random_w;
 
-  for (int i = 0; i < MAX_TRIES_POSITION; i++) {
-    random_x = (G4UniformRand() - 0.5) * range_x + source_x;
-    random_y = (G4UniformRand() - 0.5) * range_y + source_y;
-    random_z = (G4UniformRand() - 0.5) * range_z + source_z;
-    randomOrigin = G4ThreeVector(random_x, random_y, random_z);
-
-    pv = navi->LocateGlobalPointAndSetup(randomOrigin)->GetName();
+  // In the batched mode, take the starting point and direction from the buffers. If the buffers
+  // could not be filled, the sampling below is tried once more for this event.
+  // With per-event seeds, each event has to use its own random numbers, so the buffers are not used.
+  if (direction_batch.GetSize() > 0 && !utrRandom::GetPerEventSeeds()) {
+    if (direction_batch.Empty() || next_position == position_batch.size())
+      fill_batch();
 
-    for (auto source_pv : source_PV_names) {
-      if (pv == source_pv) {
-        particleGun->SetParticlePosition(randomOrigin);
-        position_found = true;
-        break;
-      }
+    if (next_position < position_batch.size()) {
+      particleGun->SetParticlePosition(position_batch[next_position++]);
+      position_found = true;
     }
-
-    if (position_found) {
-      break;
+    if (!direction_batch.Empty()) {
+      G4double x, y, z;
+      direction_batch.Pop(x, y, z);
+      particleGun->SetParticleMomentumDirection(G4ThreeVector(x, y, z));
+      momentum_found = true;
     }
   }
 
-  for (int i = 0; i < MAX_TRIES_MOMENTUM; i++) {
+  if (!position_found && source_sampler.Sample(randomOrigin, (G4int)MAX_TRIES_POSITION)) {
+    particleGun->SetParticlePosition(randomOrigin);
+    position_found = true;
+  }
+
+  if (use_inverse_cdf && !momentum_found) {
+    sampler.Sample(G4UniformRand(), G4UniformRand(), G4UniformRand(), random_theta, random_phi);
+    randomDirection = G4ThreeVector(sin(random_theta) * cos(random_phi), sin(random_theta) * sin(random_phi), cos(random_theta));
+    particleGun->SetParticleMomentumDirection(randomDirection);
+    momentum_found = true;
+  }
+
+  for (int i = 0; i < MAX_TRIES_MOMENTUM && !momentum_found; i++) {
     random_theta = acos(2. * G4UniformRand() - 1.);
     random_phi = twopi * G4UniformRand();
-    random_w = G4UniformRand() * MAX_W;
-
-    if (is_polarized) {
-      if (random_w <= angdist->AngDist(random_theta, random_phi, states, nstates, mixing_ratios))
-        momentum_found = true;
-    } else {
-      if (random_w <= (angdist->AngDist(random_theta, random_phi, states, nstates, mixing_ratios) + angdist->AngDist(random_theta, random_phi, alt_states, nstates, mixing_ratios)) / 2.)
-        momentum_found = true;
+    random_w = G4UniformRand() * max_w;
+
+    const G4double w = angular_distribution(random_theta, random_phi);
+    if (w > max_w && max_w < MAX_W) {
+      // The candidate was proposed with a too low envelope, so it is discarded
+      reset_max_w(w);
+      continue;
     }
-    if (momentum_found) {
+    if (random_w <= w) {
+      momentum_found = true;
       randomDirection = G4ThreeVector(sin(random_theta) * cos(random_phi), sin(random_theta) * sin(random_phi), cos(random_theta));
       particleGun->SetParticleMomentumDirection(randomDirection);
       break;
@@ -133,56 +155,152 @@ void AngularDistributionGenerator::GeneratePrimaries(G4Event *anEvent) {
   particleGun->GeneratePrimaryVertex(anEvent);
 }
 
-void AngularDistributionGenerator::check_momentum_generator() {
+void AngularDistributionGenerator::fill_batch() {
+  const unsigned int batch_size = direction_batch.GetSize();
+
+  position_batch.clear();
+  next_position = 0;
+  G4ThreeVector random_position;
+  for (unsigned int i = 0; i < batch_size; ++i) {
+    if (source_sampler.Sample(random_position, (G4int)MAX_TRIES_POSITION))
+      position_batch.push_back(random_position);
+  }
+
+  CLHEP::HepRandomEngine *engine = G4Random::getTheEngine();
+  DirectionBatch::UniformFunction uniform = [engine](unsigned int n, double *u) { engine->flatArray((G4int)n, u); };
+
+  if (use_inverse_cdf) {
+    direction_batch.Fill(
+        uniform,
+        [this, engine](unsigned int n, double *theta, double *phi, double *envelope) {
+          for (unsigned int i = 0; i < n; ++i) {
+            const G4double u_cell = engine->flat();
+            const G4double u_cos_theta = engine->flat();
+            const G4double u_phi = engine->flat();
+            envelope[i] = sampler.Sample(u_cell, u_cos_theta, u_phi, theta[i], phi[i]);
+          }
+        },
+        DirectionBatch::EvaluationFunction(), 1);
+    return;
+  }
+
+  direction_batch.Fill(
+      uniform,
+      [this, &uniform](unsigned int n, double *theta, double *phi, double *envelope) {
+        DirectionBatch::ProposeIsotropic(uniform, n, theta, phi, envelope, max_w);
+      },
+      [this](const double *theta, const double *phi, double *w, unsigned int n) {
+        ang_dist_batch_states(theta, phi, mixing_ratios, w, n);
+        if (!is_polarized) {
+          w_alt_batch.resize(n);
+          ang_dist_batch_alt_states(theta, phi, mixing_ratios, &w_alt_batch[0], n);
+          for (unsigned int i = 0; i < n; ++i)
+            w[i] = (w[i] + w_alt_batch[i]) / 2.;
+        }
+        if (max_w < MAX_W) {
+          const G4double batch_max_w = *std::max_element(w, w + n);
+          if (batch_max_w > max_w) {
+            // All candidates of this round were proposed with a too low envelope, so they are rejected
+            reset_max_w(batch_max_w);
+            std::fill(w, w + n, -1.);
+          }
+        }
+      },
+      (unsigned int)MAX_TRIES_MOMENTUM);
+}
+
+void AngularDistributionGenerator::reset_max_w(G4double w) {
+  G4cout << "Warning: AngularDistributionGenerator: W(theta, phi) == " << w << " exceeds the upper limit " << max_w << " from the check of the momentum generator. Sampling W up to MAX_W == " << MAX_W << " from now on." << G4endl;
+  momentum_acceptance *= max_w / MAX_W;
+  max_w = MAX_W;
+}
+
+void AngularDistributionGenerator::ValidateOnMaster(G4int n_threads) {
+  if (ang_dist_states == nullptr)
+    resolve_angular_distribution();
+  if (!source_sampler.IsInitialized())
+    source_sampler.Initialize(source_PV_names, G4ThreeVector(source_x, source_y, source_z), G4ThreeVector(range_x, range_y, range_z));
+
+#ifdef CHECK_POSITION_GENERATOR
+  check_position_generator(n_threads);
+#endif
+#ifdef CHECK_MOMENTUM_GENERATOR
+  if (!use_inverse_cdf)
+    check_momentum_generator(n_threads);
+#endif
+
+  std::lock_guard<std::mutex> lock(master_validation_mutex);
+  master_checked_position_generator = checked_position_generator;
+  master_checked_momentum_generator = checked_momentum_generator;
+  master_position_acceptance = source_sampler.GetAcceptance();
+  master_momentum_acceptance = momentum_acceptance;
+  master_max_w = max_w;
+}
+
+void AngularDistributionGenerator::use_master_validation() {
+  if (checked_position_generator && (checked_momentum_generator || use_inverse_cdf))
+    return;
+
+  std::lock_guard<std::mutex> lock(master_validation_mutex);
+  if (!checked_position_generator && master_checked_position_generator) {
+    if (G4Threading::G4GetThreadId() == 0)
+      G4cout << "AngularDistributionGenerator: Using the check of the position generator on the master thread (acceptance " << master_position_acceptance / perCent << " %)" << G4endl;
+    checked_position_generator = true;
+  }
+  if (!checked_momentum_generator && !use_inverse_cdf && master_checked_momentum_generator) {
+    momentum_acceptance = master_momentum_acceptance;
+    max_w = master_max_w;
+    if (G4Threading::G4GetThreadId() == 0)
+      G4cout << "AngularDistributionGenerator: Using the check of the momentum generator on the master thread (acceptance " << momentum_acceptance / perCent << " %, W sampled up to " << max_w << ")" << G4endl;
+    checked_momentum_generator = true;
+  }
+}
+
+void AngularDistributionGenerator::check_momentum_generator(G4int n_threads) {
   if (checked_momentum_generator)
     return;
 
-  G4double random_theta;
-  G4double random_phi;
-  G4double random_w;
-  G4int momentum_success = 0;
-  unsigned int max_w_overflow_counter = 0;
-  G4double occurred_max_w = -1.;
+  vector<G4long> momentum_success(n_threads, 0);
+  vector<G4long> max_w_overflow_counter(n_threads, 0);
+  vector<G4double> occurred_max_w_of_thread(n_threads, -1.);
   double p_max_w = 0.;
 
   G4cout << "========================================================================" << G4endl;
-  G4cout << "Checking Monte-Carlo momentum generator with " << MAX_TRIES_MOMENTUM << " 3D vectors..." << G4endl;
-
-  for (int i = 0; i < MAX_TRIES_MOMENTUM; i++) {
-    random_theta = acos(2. * G4UniformRand() - 1.);
-    random_phi = twopi * G4UniformRand();
-    random_w = G4UniformRand() * MAX_W;
-
-    if (is_polarized) {
-      if (random_w <= angdist->AngDist(random_theta, random_phi, states, nstates, mixing_ratios))
-        momentum_success++;
-    } else {
-      if (random_w <= (angdist->AngDist(random_theta, random_phi, states, nstates, mixing_ratios) + angdist->AngDist(random_theta, random_phi, alt_states, nstates, mixing_ratios)) / 2.)
-        momentum_success++;
+  G4cout << "Checking Monte-Carlo momentum generator with " << MAX_TRIES_MOMENTUM << " 3D vectors";
+  if (n_threads > 1)
+    G4cout << " in " << n_threads << " threads";
+  G4cout << "..." << G4endl;
+
+  utrParallelSampling::run(n_threads, (G4long)MAX_TRIES_MOMENTUM, [&](G4int n_thread, G4long n_samples, CLHEP::HepRandomEngine *engine) {
+    for (G4long i = 0; i < n_samples; i++) {
+      G4double random_theta = acos(2. * engine->flat() - 1.);
+      G4double random_phi = twopi * engine->flat();
+      G4double random_w = engine->flat() * MAX_W;
+      G4double w = angular_distribution(random_theta, random_phi);
+
+      if (random_w <= w)
+        ++momentum_success[n_thread];
+      if (MAX_W < w)
+        ++max_w_overflow_counter[n_thread];
+      if (occurred_max_w_of_thread[n_thread] < w)
+        occurred_max_w_of_thread[n_thread] = w;
     }
+  });
 
-    if (is_polarized) {
-      if (MAX_W < angdist->AngDist(random_theta, random_phi, states, nstates, mixing_ratios))
-        max_w_overflow_counter++;
-    } else {
-      if (MAX_W < (angdist->AngDist(random_theta, random_phi, states, nstates, mixing_ratios) + angdist->AngDist(random_theta, random_phi, alt_states, nstates, mixing_ratios)) / 2.)
-        max_w_overflow_counter++;
-    }
-
-    if (is_polarized) {
-      if (occurred_max_w < angdist->AngDist(random_theta, random_phi, states, nstates, mixing_ratios))
-        occurred_max_w = angdist->AngDist(random_theta, random_phi, states, nstates, mixing_ratios);
-    } else {
-      if (occurred_max_w < (angdist->AngDist(random_theta, random_phi, states, nstates, mixing_ratios) + angdist->AngDist(random_theta, random_phi, alt_states, nstates, mixing_ratios)) / 2.)
-        occurred_max_w = (angdist->AngDist(random_theta, random_phi, states, nstates, mixing_ratios) + angdist->AngDist(random_theta, random_phi, alt_states, nstates, mixing_ratios)) / 2.;
-    }
+  G4long n_momentum_success = 0;
+  G4long n_max_w_overflow = 0;
+  G4double occurred_max_w = -1.;
+  for (G4int n_thread = 0; n_thread < n_threads; ++n_thread) {
+    n_momentum_success += momentum_success[n_thread];
+    n_max_w_overflow += max_w_overflow_counter[n_thread];
+    occurred_max_w = std::max(occurred_max_w, occurred_max_w_of_thread[n_thread]);
   }
 
-  G4double p = (double)momentum_success / MAX_TRIES_MOMENTUM;
+  G4double p = (double)n_momentum_success / MAX_TRIES_MOMENTUM;
   G4double pnot = 1. - p;
 
   G4cout << "Check finished. Of " << MAX_TRIES_MOMENTUM
-         << " random 3D momentum vectors, " << momentum_success
+         << " random 3D momentum vectors, " << n_momentum_success
          << " were valid ( " << p / perCent << " % )" << G4endl;
   G4cout << "Probability of failure: pow( " << pnot << ", "
          << MAX_TRIES_MOMENTUM
@@ -192,111 +310,120 @@ void AngularDistributionGenerator::check_momentum_generator() {
     G4cerr << "ERROR: Probability of failure for Monte-Carlo momentum generation of " << pow(pnot, MAX_TRIES_MOMENTUM) / perCent << " % was deemed to high! Aborting..." << G4endl;
     throw std::exception();
   }
-  if (max_w_overflow_counter == 0) {
+  if (n_max_w_overflow == 0) {
     G4cout << "MAX_W == " << MAX_W << " seems to be high enough as the maximal occurred value of the angular distribution was " << occurred_max_w << G4endl;
   } else {
-    p_max_w = (double)max_w_overflow_counter / MAX_TRIES_MOMENTUM;
+    p_max_w = (double)n_max_w_overflow / MAX_TRIES_MOMENTUM;
     G4cout << G4endl;
-    G4cerr << "ERROR: In " << max_w_overflow_counter << " out of " << MAX_TRIES_MOMENTUM << " cases (" << p_max_w / perCent << " % ) W(random_theta, random_phi) > MAX_W == " << MAX_W << " was valid. This means that MAX_W is set too low and the angular distribution is truncated! The maximal occurred value of the angular distribution was " << occurred_max_w << ". Aborting..." << G4endl;
+    G4cerr << "ERROR: In " << n_max_w_overflow << " out of " << MAX_TRIES_MOMENTUM << " cases (" << p_max_w / perCent << " % ) W(random_theta, random_phi) > MAX_W == " << MAX_W << " was valid. This means that MAX_W is set too low and the angular distribution is truncated! The maximal occurred value of the angular distribution was " << occurred_max_w << ". Aborting..." << G4endl;
     throw std::exception();
   }
+
+  // Use the maximal occurred value with a safety margin as a tighter envelope for the rejection sampling
+  max_w = std::min(MAX_W, (1. + MAX_W_MARGIN) * occurred_max_w);
+  momentum_acceptance = p * MAX_W / max_w;
+  G4cout << "Sampling W up to " << max_w << " (expected acceptance " << momentum_acceptance / perCent << " %)" << G4endl;
+
   G4cout << "========================================================================" << G4endl << G4endl;
   checked_momentum_generator = true;
 }
 
-void AngularDistributionGenerator::check_position_generator() {
-  if (checked_position_generator)
-    return;
+void AngularDistributionGenerator::resolve_angular_distribution() {
+  for (G4int i = 0; i < 4; ++i)
+    alt_states[i] = states[i];
+  if (states[1] == 0.) {
+    alt_states[1] = -0.1;
+  } else if (states[1] == -0.1) {
+    alt_states[1] = 0.;
+  } else {
+    alt_states[1] = -states[1];
+  }
 
-  G4String pv;
-  G4String pv_max_x;
-  G4String pv_min_x;
-  G4String pv_max_y;
-  G4String pv_min_y;
-  G4String pv_max_z;
-  G4String pv_min_z;
-
-  G4double random_x;
-  G4double random_y;
-  G4double random_z;
-
-  for (auto source_pv : source_PV_names) {
-    G4int max_x = 0;
-    G4int max_y = 0;
-    G4int max_z = 0;
-    G4int position_success = 0;
-
-    G4cout << "========================================================================" << G4endl;
-    G4cout << "Checking Monte-Carlo position generator with " << MAX_TRIES_POSITION << " 3D points for volume " << source_pv << "..." << G4endl;
-
-    for (int i = 0; i < MAX_TRIES_POSITION; i++) {
-      random_x = (G4UniformRand() - 0.5) * range_x + source_x;
-      random_y = (G4UniformRand() - 0.5) * range_y + source_y;
-      random_z = (G4UniformRand() - 0.5) * range_z + source_z;
-
-      pv = navi->LocateGlobalPointAndSetup(G4ThreeVector(random_x, random_y, random_z))->GetName();
-      pv_max_x = navi->LocateGlobalPointAndSetup(G4ThreeVector(0.5 * range_x + source_x, random_y, random_z))->GetName();
-      pv_min_x = navi->LocateGlobalPointAndSetup(G4ThreeVector(-0.5 * range_x + source_x, random_y, random_z))->GetName();
-      pv_max_y = navi->LocateGlobalPointAndSetup(G4ThreeVector(random_x, 0.5 * range_y + source_y, random_z))->GetName();
-      pv_min_y = navi->LocateGlobalPointAndSetup(G4ThreeVector(random_x, -0.5 * range_y + source_y, random_z))->GetName();
-      pv_max_z = navi->LocateGlobalPointAndSetup(G4ThreeVector(random_x, random_y, 0.5 * range_z + source_z))->GetName();
-      pv_min_z = navi->LocateGlobalPointAndSetup(G4ThreeVector(random_x, random_y, -0.5 * range_z + source_z))->GetName();
-
-      if (pv == source_pv) {
-        ++position_success;
-      }
-      if (pv_max_x == source_pv || pv_min_x == source_pv) {
-        ++max_x;
-      }
-      if (pv_max_y == source_pv || pv_min_y == source_pv) {
-        ++max_y;
-      }
-      if (pv_max_z == source_pv || pv_min_z == source_pv) {
-        ++max_z;
-      }
-    }
+  ang_dist_states = angdist->GetAngDistFunction(states, nstates);
+  if (ang_dist_states == nullptr) {
+    G4cerr << "ERROR: AngularDistributionGenerator: Required spin sequence not found." << G4endl;
+    throw std::exception();
+  }
+  ang_dist_batch_states = angdist->GetAngDistBatchFunction(states, nstates);
 
-    G4double p = (G4double)position_success / MAX_TRIES_POSITION;
-    G4double pnot = 1. - p;
-
-    G4cout << "Check finished. Of " << MAX_TRIES_POSITION
-           << " random 3D points, " << position_success
-           << " were inside volume " << source_pv << " ( "
-           << p / perCent << " % )" << G4endl;
-    G4cout << "Probability of failure: pow( " << pnot << ", "
-           << MAX_TRIES_POSITION
-           << " ) = " << pow(pnot, MAX_TRIES_POSITION) / perCent << " %"
-           << G4endl;
-    if (pow(pnot, MAX_TRIES_POSITION) > MAX_ALLOWED_FAIL_CHANCE) {
-      G4cerr << "ERROR: Probability of failure for Monte-Carlo position generation of " << pow(pnot, MAX_TRIES_POSITION) / perCent << " % for volume " << source_pv << " was deemed to high! Aborting..." << G4endl;
+  // The alternative cascade is only needed for unpolarized excitations
+  if (!is_polarized) {
+    ang_dist_alt_states = angdist->GetAngDistFunction(alt_states, nstates);
+    if (ang_dist_alt_states == nullptr) {
+      G4cerr << "ERROR: AngularDistributionGenerator: Required spin sequence for the unpolarized excitation not found." << G4endl;
       throw std::exception();
     }
+    ang_dist_batch_alt_states = angdist->GetAngDistBatchFunction(alt_states, nstates);
+  }
+}
 
-    if (max_x == 0) {
-      G4cout << "X range " << source_x << " +- " << 0.5 * range_x << " seems to be large enough." << G4endl;
-    } else {
-      G4double p_max_x = (double)max_x / MAX_TRIES_POSITION;
-      G4cout << G4endl;
-      G4cout << "In " << max_x << " out of " << MAX_TRIES_POSITION << " cases (" << p_max_x / perCent << " % ) randomly sampled points on the x-boundary (sourceX +- sourceDX, sourceY + randomY, sourceZ + randomZ) were still inside the source volume. This may mean that the x range does not encompass the whole source volume." << G4endl;
-    }
+void AngularDistributionGenerator::tabulate_angular_distribution() {
+  G4cout << "========================================================================" << G4endl;
+  G4cout << "Tabulating angular distribution for inverse-CDF sampling on a grid of " << sampler.GetNBinsCosTheta() << " x " << sampler.GetNBinsPhi() << " (cos(theta) x phi) cells ..." << G4endl;
 
-    if (max_y == 0) {
-      G4cout << "Y range " << source_y << " +- " << 0.5 * range_y << " seems to be large enough." << G4endl;
-    } else {
-      G4double p_max_y = (double)max_y / MAX_TRIES_POSITION;
-      G4cout << G4endl;
-      G4cout << "In " << max_y << " out of " << MAX_TRIES_POSITION << " cases (" << p_max_y / perCent << " % ) randomly sampled points on the y-boundary (sourceX + randomX, sourceY +- sourceDY, sourceZ + randomZ) were still inside the source volume. This may mean that the y range does not encompass the whole source volume." << G4endl;
-    }
+  if (!sampler.Tabulate([this](double theta, double phi) { return angular_distribution(theta, phi); })) {
+    G4cerr << "ERROR: The angular distribution is not positive anywhere on the grid of the inverse-CDF table! Aborting..." << G4endl;
+    throw std::exception();
+  }
 
-    if (max_z == 0) {
-      G4cout << "Z range " << source_z << " +- " << 0.5 * range_z << " seems to be large enough." << G4endl;
-    } else {
-      G4double p_max_z = (double)max_z / MAX_TRIES_POSITION;
-      G4cout << G4endl;
-      G4cout << "In " << max_z << " out of " << MAX_TRIES_POSITION << " cases (" << p_max_z / perCent << " % ) randomly sampled points on the z-boundary (sourceX + randomX, sourceY + randomY, sourceZ +- sourceDZ) were still inside the source volume. This may mean that the z range does not encompass the whole source volume." << G4endl;
+  G4cout << "Maximal occurred value of the angular distribution: " << sampler.GetMaxW() << G4endl;
+  G4cout << "Deviation of the table from AngDist:" << G4endl;
+  G4cout << "\tMaximum: " << sampler.GetMaxDeviation() / perCent << " % of the maximal value" << G4endl;
+  G4cout << "\tMean   : " << sampler.GetMeanDeviation() / perCent << " % of the mean value" << G4endl;
+  if (sampler.GetMeanDeviation() > MAX_ALLOWED_INVERSE_CDF_DEVIATION) {
+    G4cout << "Warning: The mean deviation of the inverse-CDF table from the angular distribution exceeds " << MAX_ALLOWED_INVERSE_CDF_DEVIATION / perCent << " %. Consider increasing the number of cells via /ang/inverseCDFNCosTheta and /ang/inverseCDFNPhi, or using rejection sampling." << G4endl;
+  }
+  G4cout << "========================================================================" << G4endl << G4endl;
+}
+
+void AngularDistributionGenerator::check_position_generator(G4int n_threads) {
+  if (checked_position_generator)
+    return;
+
+  G4cout << "========================================================================" << G4endl;
+  G4cout << "Checking Monte-Carlo position generator with " << MAX_TRIES_POSITION << " 3D points";
+  if (n_threads > 1)
+    G4cout << " in " << n_threads << " threads";
+  G4cout << "..." << G4endl;
+
+  vector<SourceVolumeSampler> source_samplers(n_threads, source_sampler);
+  utrParallelSampling::run(n_threads, (G4long)MAX_TRIES_POSITION, [&source_samplers](G4int n_thread, G4long n_samples, CLHEP::HepRandomEngine *engine) {
+    G4ThreeVector random_position;
+    source_samplers[n_thread].SetEngine(engine);
+    source_samplers[n_thread].ResetStatistics();
+    for (G4long i = 0; i < n_samples; i++) {
+      source_samplers[n_thread].TrySample(random_position);
     }
+  });
 
-    G4cout << "========================================================================" << G4endl << G4endl;
+  source_sampler.ResetStatistics();
+  for (auto &copy : source_samplers)
+    source_sampler.AddStatistics(copy);
+  source_sampler.PrintStatistics();
+
+  G4double p = source_sampler.GetAcceptance();
+  G4double pnot = 1. - p;
+
+  G4cout << "Check finished. Of " << MAX_TRIES_POSITION
+         << " random 3D points, " << source_sampler.GetNAccepted()
+         << " were inside the source volumes ( "
+         << p / perCent << " % )" << G4endl;
+  G4cout << "Probability of failure: pow( " << pnot << ", "
+         << MAX_TRIES_POSITION
+         << " ) = " << pow(pnot, MAX_TRIES_POSITION) / perCent << " %"
+         << G4endl;
+  if (pow(pnot, MAX_TRIES_POSITION) > MAX_ALLOWED_FAIL_CHANCE) {
+    G4cerr << "ERROR: Probability of failure for Monte-Carlo position generation of " << pow(pnot, MAX_TRIES_POSITION) / perCent << " % was deemed to high! Aborting..." << G4endl;
+    throw std::exception();
   }
+
+  if (!source_sampler.IsClipped()) {
+    G4cout << "Container box " << source_x << " +- " << 0.5 * range_x << ", " << source_y << " +- " << 0.5 * range_y << ", " << source_z << " +- " << 0.5 * range_z << " seems to be large enough." << G4endl;
+  } else {
+    G4cout << G4endl;
+    G4cout << "The container box (sourceX +- sourceDX/2, sourceY +- sourceDY/2, sourceZ +- sourceDZ/2) cuts away parts of the extent of at least one source volume. This may mean that the container box does not encompass the whole source volume." << G4endl;
+  }
+
+  G4cout << "========================================================================" << G4endl << G4endl;
   checked_position_generator = true;
 }
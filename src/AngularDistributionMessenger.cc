@@ -138,6 +138,32 @@ AngularDistributionMessenger::AngularDistributionMessenger(
   polarizationCmd->SetParameterName("is_polarized", true);
   polarizationCmd->SetDefaultValue(true);
 
+  inverseCDFCmd = new G4UIcmdWithABool("/ang/inverseCDF", this);
+  inverseCDFCmd->SetGuidance("Sample momentum directions from a precomputed table of the cumulative angular distribution instead of rejection sampling (default: false)");
+  inverseCDFCmd->SetParameterName("use_inverse_cdf", true);
+  inverseCDFCmd->SetDefaultValue(true);
+
+  inverseCDFNCosThetaCmd = new G4UIcmdWithAnInteger("/ang/inverseCDFNCosTheta", this);
+  inverseCDFNCosThetaCmd->SetGuidance("Set number of cos(theta) bins of the inverse-CDF table.");
+  inverseCDFNCosThetaCmd->SetGuidance("Default: 100");
+  inverseCDFNCosThetaCmd->SetParameterName("n_cos_theta", true);
+  inverseCDFNCosThetaCmd->SetDefaultValue(100);
+  inverseCDFNCosThetaCmd->SetRange("n_cos_theta > 0");
+
+  inverseCDFNPhiCmd = new G4UIcmdWithAnInteger("/ang/inverseCDFNPhi", this);
+  inverseCDFNPhiCmd->SetGuidance("Set number of phi bins of the inverse-CDF table.");
+  inverseCDFNPhiCmd->SetGuidance("Default: 200");
+  inverseCDFNPhiCmd->SetParameterName("n_phi", true);
+  inverseCDFNPhiCmd->SetDefaultValue(200);
+  inverseCDFNPhiCmd->SetRange("n_phi > 0");
+
+  batchSizeCmd = new G4UIcmdWithAnInteger("/ang/batchSize", this);
+  batchSizeCmd->SetGuidance("Sample starting points and momentum directions for this number of events at once and buffer them. 0 means that they are sampled event by event.");
+  batchSizeCmd->SetGuidance("Default: 0");
+  batchSizeCmd->SetParameterName("batch_size", true);
+  batchSizeCmd->SetDefaultValue(0);
+  batchSizeCmd->SetRange("batch_size >= 0");
+
   energyCmd = new G4UIcmdWithADoubleAndUnit("/ang/energy", this);
 
   angularDistributionGenerator->SetParticleDefinition(
@@ -254,6 +280,22 @@ void AngularDistributionMessenger::SetNewValue(G4UIcommand *command,
     angularDistributionGenerator->SetPolarized(
         polarizationCmd->GetNewBoolValue(newValues));
   }
+  if (command == inverseCDFCmd) {
+    angularDistributionGenerator->SetInverseCDF(
+        inverseCDFCmd->GetNewBoolValue(newValues));
+  }
+  if (command == inverseCDFNCosThetaCmd) {
+    angularDistributionGenerator->SetInverseCDFNBinsCosTheta(
+        inverseCDFNCosThetaCmd->GetNewIntValue(newValues));
+  }
+  if (command == inverseCDFNPhiCmd) {
+    angularDistributionGenerator->SetInverseCDFNBinsPhi(
+        inverseCDFNPhiCmd->GetNewIntValue(newValues));
+  }
+  if (command == batchSizeCmd) {
+    angularDistributionGenerator->SetBatchSize(
+        batchSizeCmd->GetNewIntValue(newValues));
+  }
 }
 
 G4String AngularDistributionMessenger::GetCurrentValue(G4UIcommand *command) {
@@ -337,6 +379,22 @@ G4String AngularDistributionMessenger::GetCurrentValue(G4UIcommand *command) {
     return polarizationCmd->ConvertToString(
         angularDistributionGenerator->IsPolarized());
   }
+  if (command == inverseCDFCmd) {
+    return inverseCDFCmd->ConvertToString(
+        angularDistributionGenerator->GetInverseCDF());
+  }
+  if (command == inverseCDFNCosThetaCmd) {
+    return inverseCDFNCosThetaCmd->ConvertToString(
+        angularDistributionGenerator->GetInverseCDFNBinsCosTheta());
+  }
+  if (command == inverseCDFNPhiCmd) {
+    return inverseCDFNPhiCmd->ConvertToString(
+        angularDistributionGenerator->GetInverseCDFNBinsPhi());
+  }
+  if (command == batchSizeCmd) {
+    return batchSizeCmd->ConvertToString(
+        angularDistributionGenerator->GetBatchSize());
+  }
 
   return cv;
 }
@@ -0,0 +1,173 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <cmath>
+
+#include "AngularDistributionSampler.hh"
+
+// Number of evaluations of W per cell and dimension which are averaged to get the table entry of the cell
+#define N_SUBDIVISIONS 3
+
+AngularDistributionSampler::AngularDistributionSampler(unsigned int n_cos_theta, unsigned int n_phi)
+    : n_bins_cos_theta(n_cos_theta), n_bins_phi(n_phi), max_w(0.), max_deviation(0.), mean_deviation(0.), majorant_acceptance(0.) {}
+
+void AngularDistributionSampler::SetNBins(unsigned int n_cos_theta, unsigned int n_phi) {
+  n_bins_cos_theta = n_cos_theta;
+  n_bins_phi = n_phi;
+  cumulative.clear();
+  table.clear();
+}
+
+bool AngularDistributionSampler::Tabulate(const std::function<double(double, double)> &w) {
+  const double d_cos_theta = 2. / n_bins_cos_theta;
+  const double d_phi = 2. * M_PI / n_bins_phi;
+
+  cumulative.assign(n_bins_cos_theta * n_bins_phi, 0.);
+  table.assign(n_bins_cos_theta * n_bins_phi, 0.);
+
+  double sum_w = 0.;
+  double sum_deviation = 0.;
+  double max_absolute_deviation = 0.;
+  max_w = 0.;
+
+  for (unsigned int i = 0; i < n_bins_cos_theta; ++i) {
+    const double cos_theta_low = -1. + i * d_cos_theta;
+    for (unsigned int j = 0; j < n_bins_phi; ++j) {
+      const double phi_low = j * d_phi;
+      const unsigned int cell = i * n_bins_phi + j;
+
+      double cell_w = 0.;
+      double w_value = 0.;
+      for (unsigned int a = 0; a < N_SUBDIVISIONS; ++a) {
+        for (unsigned int b = 0; b < N_SUBDIVISIONS; ++b) {
+          w_value = w(acos(cos_theta_low + (a + 0.5) / N_SUBDIVISIONS * d_cos_theta),
+                      phi_low + (b + 0.5) / N_SUBDIVISIONS * d_phi);
+          cell_w += w_value;
+          max_w = std::max(max_w, w_value);
+        }
+      }
+      cell_w = std::max(cell_w / (N_SUBDIVISIONS * N_SUBDIVISIONS), 0.);
+
+      // Compare the table to W at a point which was not used to calculate the table entry.
+      // The points are distributed over the cells using the quasi-random R2 sequence.
+      w_value = w(acos(cos_theta_low + fmod(0.5 + cell * 0.7548776662466927, 1.) * d_cos_theta),
+                  phi_low + fmod(0.5 + cell * 0.5698402909980532, 1.) * d_phi);
+      max_w = std::max(max_w, w_value);
+      max_absolute_deviation = std::max(max_absolute_deviation, fabs(w_value - cell_w));
+      sum_deviation += fabs(w_value - cell_w);
+
+      sum_w += cell_w;
+      cumulative[cell] = sum_w;
+      table[cell] = cell_w;
+    }
+  }
+
+  if (sum_w <= 0.) {
+    cumulative.clear();
+    table.clear();
+    return false;
+  }
+
+  for (auto &c : cumulative) {
+    c /= sum_w;
+  }
+  cumulative.back() = 1.;
+
+  max_deviation = max_absolute_deviation / max_w;
+  mean_deviation = sum_deviation / sum_w;
+
+  return true;
+}
+
+bool AngularDistributionSampler::TabulateMajorant(const std::function<double(double, double)> &w, double margin) {
+  const double d_cos_theta = 2. / n_bins_cos_theta;
+  const double d_phi = 2. * M_PI / n_bins_phi;
+
+  // Evaluate W on a grid which includes the corners of all cells, so that the values on the
+  // boundaries are shared by neighbouring cells
+  const unsigned int n_points_cos_theta = n_bins_cos_theta * N_SUBDIVISIONS + 1;
+  const unsigned int n_points_phi = n_bins_phi * N_SUBDIVISIONS + 1;
+  vector<double> grid(n_points_cos_theta * n_points_phi);
+  for (unsigned int i = 0; i < n_points_cos_theta; ++i) {
+    const double theta = acos(std::min(-1. + i * d_cos_theta / N_SUBDIVISIONS, 1.));
+    for (unsigned int j = 0; j < n_points_phi; ++j) {
+      grid[i * n_points_phi + j] = w(theta, j * d_phi / N_SUBDIVISIONS);
+    }
+  }
+
+  cumulative.assign(n_bins_cos_theta * n_bins_phi, 0.);
+  table.assign(n_bins_cos_theta * n_bins_phi, 0.);
+
+  double sum_majorant = 0.;
+  double sum_w = 0.;
+  max_w = 0.;
+
+  for (unsigned int i = 0; i < n_bins_cos_theta; ++i) {
+    for (unsigned int j = 0; j < n_bins_phi; ++j) {
+      const unsigned int cell = i * n_bins_phi + j;
+
+      double cell_min = grid[i * N_SUBDIVISIONS * n_points_phi + j * N_SUBDIVISIONS];
+      double cell_max = cell_min;
+      double cell_w = 0.;
+      for (unsigned int a = 0; a <= N_SUBDIVISIONS; ++a) {
+        for (unsigned int b = 0; b <= N_SUBDIVISIONS; ++b) {
+          const double w_value = grid[(i * N_SUBDIVISIONS + a) * n_points_phi + j * N_SUBDIVISIONS + b];
+          cell_min = std::min(cell_min, w_value);
+          cell_max = std::max(cell_max, w_value);
+          // Trapezoidal rule for the mean value of W in the cell
+          cell_w += w_value * (a == 0 || a == N_SUBDIVISIONS ? 0.5 : 1.) * (b == 0 || b == N_SUBDIVISIONS ? 0.5 : 1.);
+        }
+      }
+      max_w = std::max(max_w, cell_max);
+
+      const double majorant = std::max(cell_max + margin * (cell_max - cell_min), 0.);
+      sum_majorant += majorant;
+      sum_w += std::max(cell_w / (N_SUBDIVISIONS * N_SUBDIVISIONS), 0.);
+      cumulative[cell] = sum_majorant;
+      table[cell] = majorant;
+    }
+  }
+
+  if (sum_majorant <= 0.) {
+    cumulative.clear();
+    table.clear();
+    return false;
+  }
+
+  for (auto &c : cumulative) {
+    c /= sum_majorant;
+  }
+  cumulative.back() = 1.;
+
+  majorant_acceptance = sum_w / sum_majorant;
+
+  return true;
+}
+
+double AngularDistributionSampler::Sample(double u_cell, double u_cos_theta, double u_phi, double &theta, double &phi) const {
+  const unsigned int cell = std::min((unsigned int)(std::upper_bound(cumulative.begin(), cumulative.end(), u_cell) - cumulative.begin()),
+                                     (unsigned int)cumulative.size() - 1);
+
+  theta = acos(std::min(-1. + ((cell / n_bins_phi) + u_cos_theta) * 2. / n_bins_cos_theta, 1.));
+  phi = ((cell % n_bins_phi) + u_phi) * 2. * M_PI / n_bins_phi;
+
+  return table[cell];
+}
@@ -0,0 +1,288 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+
+#include "G4Box.hh"
+#include "G4Material.hh"
+#include "G4PVPlacement.hh"
+#include "G4SubtractionSolid.hh"
+#include "G4SystemOfUnits.hh"
+#include "G4Transform3D.hh"
+#include "G4VisAttributes.hh"
+
+#include "BrickEnvelope.hh"
+#include "GeometryDetail.hh"
+
+vector<BrickEnvelope *> BrickEnvelope::envelopes;
+G4bool BrickEnvelope::enabled = true;
+
+BrickEnvelope::BrickEnvelope(G4LogicalVolume *mother_Logical, const G4String &name, G4bool homogenizable)
+    : mother_logical(mother_Logical), envelope_name(name), first_daughter(mother_Logical->GetNoDaughters()), closed(false), homogenizable(homogenizable), solid(nullptr) {
+  envelopes.push_back(this);
+}
+
+void BrickEnvelope::SetSolid(G4VSolid *envelope_solid, const G4ThreeVector &position) {
+  solid = envelope_solid;
+  solid_position = position;
+}
+
+void BrickEnvelope::Close() {
+  if (closed) {
+    G4cerr << "ERROR: BrickEnvelope::Close(): The envelope " << envelope_name << " has already been closed! Aborting..." << G4endl;
+    throw std::exception();
+  }
+
+  for (size_t i = first_daughter; i < mother_logical->GetNoDaughters(); ++i) {
+    G4VPhysicalVolume *daughter = mother_logical->GetDaughter(i);
+
+    // Volumes of an envelope which was opened and closed in the meantime stay in that envelope
+    G4bool claimed = false;
+    for (auto envelope : envelopes) {
+      if (envelope != this && envelope->closed && std::find(envelope->members.begin(), envelope->members.end(), daughter) != envelope->members.end()) {
+        claimed = true;
+        break;
+      }
+    }
+    if (claimed) {
+      continue;
+    }
+
+    if (daughter->IsReplicated()) {
+      G4cerr << "ERROR: BrickEnvelope::Close(): The replicated volume " << daughter->GetName() << " cannot be moved to the envelope " << envelope_name << "! Aborting..." << G4endl;
+      throw std::exception();
+    }
+    members.push_back(daughter);
+  }
+  closed = true;
+}
+
+void BrickEnvelope::BuildAll(G4bool check_overlaps) {
+  for (auto envelope : envelopes) {
+    if (!envelope->closed) {
+      G4cerr << "ERROR: BrickEnvelope::BuildAll(): The envelope " << envelope->envelope_name << " has not been closed! Aborting..." << G4endl;
+      throw std::exception();
+    }
+  }
+
+  // Envelopes which are neither enabled nor homogenized are not built at all
+  vector<BrickEnvelope *> built_envelopes;
+  for (auto envelope : envelopes) {
+    if (!envelope->members.empty() && (enabled || envelope->homogenized())) {
+      envelope->update_bounding_box();
+      built_envelopes.push_back(envelope);
+    }
+  }
+  envelopes.clear();
+  if (built_envelopes.empty()) {
+    return;
+  }
+
+  // Envelopes in the same mother volume whose bounding boxes intersect are merged, since the members
+  // of one of them might be inside the bounding box of the other one. Homogenized envelopes are only
+  // merged with each other. They are built before all other envelopes and subtract their members,
+  // which are still daughters of the mother volume at that point. The other envelopes then subtract
+  // the final solids of the homogenized envelopes, which may be larger than their former members.
+  G4bool merged = true;
+  while (merged) {
+    merged = false;
+    for (size_t i = 0; i < built_envelopes.size() && !merged; ++i) {
+      for (size_t j = i + 1; j < built_envelopes.size() && !merged; ++j) {
+        BrickEnvelope *first = built_envelopes[i];
+        BrickEnvelope *second = built_envelopes[j];
+        if (first->mother_logical == second->mother_logical && first->homogenized() == second->homogenized() &&
+            first->intersects(second->bounding_box_min, second->bounding_box_max)) {
+          first->envelope_name += "+" + second->envelope_name;
+          first->members.insert(first->members.end(), second->members.begin(), second->members.end());
+          first->solid = nullptr;
+          first->update_bounding_box();
+          built_envelopes.erase(built_envelopes.begin() + j);
+          merged = true;
+        }
+      }
+    }
+  }
+  std::stable_partition(built_envelopes.begin(), built_envelopes.end(), [](const BrickEnvelope *envelope) { return envelope->homogenized(); });
+
+  G4cout << "================================================================================" << G4endl;
+  G4cout << "Brick envelopes" << (enabled ? "" : " (only homogenized envelopes, /utr/geometry/brickEnvelopes is false)") << G4endl;
+  vector<G4LogicalVolume *> mothers;
+  for (auto envelope : built_envelopes) {
+    envelope->build(check_overlaps);
+    if (std::find(mothers.begin(), mothers.end(), envelope->mother_logical) == mothers.end()) {
+      mothers.push_back(envelope->mother_logical);
+    }
+  }
+  for (auto mother : mothers) {
+    G4cout << "Daughters of " << mother->GetName() << " after building the envelopes: " << mother->GetNoDaughters() << G4endl;
+  }
+  G4cout << "================================================================================" << G4endl;
+}
+
+void BrickEnvelope::update_bounding_box() {
+  if (solid != nullptr) {
+    solid->BoundingLimits(bounding_box_min, bounding_box_max);
+    bounding_box_min += solid_position;
+    bounding_box_max += solid_position;
+    return;
+  }
+
+  G4ThreeVector member_min, member_max;
+  for (size_t i = 0; i < members.size(); ++i) {
+    bounding_box(members[i], member_min, member_max);
+    if (i == 0) {
+      bounding_box_min = member_min;
+      bounding_box_max = member_max;
+    } else {
+      bounding_box_min = G4ThreeVector(std::min(bounding_box_min.x(), member_min.x()), std::min(bounding_box_min.y(), member_min.y()), std::min(bounding_box_min.z(), member_min.z()));
+      bounding_box_max = G4ThreeVector(std::max(bounding_box_max.x(), member_max.x()), std::max(bounding_box_max.y(), member_max.y()), std::max(bounding_box_max.z(), member_max.z()));
+    }
+  }
+}
+
+// Boxes which only touch each other do not intersect
+G4bool BrickEnvelope::intersects(const G4ThreeVector &min, const G4ThreeVector &max) const {
+  return min.x() < bounding_box_max.x() && max.x() > bounding_box_min.x() && min.y() < bounding_box_max.y() && max.y() > bounding_box_min.y() && min.z() < bounding_box_max.z() && max.z() > bounding_box_min.z();
+}
+
+G4bool BrickEnvelope::homogenized() const {
+  return homogenizable && GeometryDetail::GetLevel() == HOMOGENIZED_DETAIL;
+}
+
+void BrickEnvelope::build(G4bool check_overlaps) {
+  const G4ThreeVector center = solid != nullptr ? solid_position : 0.5 * (bounding_box_min + bounding_box_max);
+  const G4ThreeVector half_size = 0.5 * (bounding_box_max - bounding_box_min);
+
+  G4VSolid *envelope_solid = solid;
+  if (envelope_solid == nullptr) {
+    envelope_solid = new G4Box(envelope_name + "_Envelope_Solid", half_size.x(), half_size.y(), half_size.z());
+  }
+
+  // Remove all other volumes of the mother from the envelope.
+  // Members of other envelopes cannot intersect it, since intersecting envelopes have been merged.
+  unsigned int n_subtracted = 0;
+  G4ThreeVector other_min, other_max;
+  for (size_t i = 0; i < mother_logical->GetNoDaughters(); ++i) {
+    G4VPhysicalVolume *daughter = mother_logical->GetDaughter(i);
+    if (std::find(members.begin(), members.end(), daughter) != members.end()) {
+      continue;
+    }
+    bounding_box(daughter, other_min, other_max);
+    if (!intersects(other_min, other_max)) {
+      continue;
+    }
+    envelope_solid = new G4SubtractionSolid(envelope_name + "_Envelope_Solid", envelope_solid, daughter->GetLogicalVolume()->GetSolid(),
+                                            G4Transform3D(daughter->GetObjectRotationValue(), daughter->GetObjectTranslation() - center));
+    ++n_subtracted;
+  }
+
+  G4LogicalVolume *envelope_logical = nullptr;
+  if (homogenized()) {
+    // The mass of the members, and the mass of the mother material in the rest of the envelope
+    vector<std::pair<G4Material *, G4double>> masses;
+    G4double members_volume = 0.;
+    for (auto member : members) {
+      add_masses(member->GetLogicalVolume(), masses);
+      members_volume += member->GetLogicalVolume()->GetSolid()->GetCubicVolume();
+    }
+    const G4double envelope_volume = envelope_solid->GetCubicVolume();
+    // The volumes of Boolean solids are estimated by Geant4 with a relative uncertainty of about 1e-3
+    if (envelope_volume < 0.99 * members_volume) {
+      G4cerr << "ERROR: BrickEnvelope::build(): The volume of the envelope " << envelope_name << " (" << envelope_volume / cm3 << " cm3) is smaller than the volume of its members (" << members_volume / cm3 << " cm3)! Aborting..." << G4endl;
+      throw std::exception();
+    }
+    masses.push_back({mother_logical->GetMaterial(), std::max(envelope_volume - members_volume, 0.) * mother_logical->GetMaterial()->GetDensity()});
+
+    G4double total_mass = 0.;
+    for (auto mass : masses) {
+      total_mass += mass.second;
+    }
+    G4Material *mixture = new G4Material(envelope_name + "_Homogenized", total_mass / envelope_volume, (G4int)masses.size());
+    for (auto mass : masses) {
+      mixture->AddMaterial(mass.first, mass.second / total_mass);
+    }
+
+    for (auto member : members) {
+      mother_logical->RemoveDaughter(member);
+      delete member;
+    }
+
+    envelope_logical = new G4LogicalVolume(envelope_solid, mixture, envelope_name + "_Homogenized_Logical");
+    envelope_logical->SetVisAttributes(G4Colour(0.5, 0.5, 0.5));
+    new G4PVPlacement(0, center, envelope_logical, envelope_name + "_Homogenized", mother_logical, false, 0, check_overlaps);
+
+    G4cout << "\t" << envelope_name << ": " << members.size() << " volumes homogenized, " << total_mass / kg << " kg in " << envelope_volume / cm3 << " cm3 at " << center / mm << " mm (" << mixture->GetDensity() / (g / cm3) << " g/cm3)";
+  } else {
+    envelope_logical = new G4LogicalVolume(envelope_solid, mother_logical->GetMaterial(), envelope_name + "_Envelope_Logical");
+    envelope_logical->SetVisAttributes(G4VisAttributes::GetInvisible());
+
+    for (auto member : members) {
+      mother_logical->RemoveDaughter(member);
+      member->SetTranslation(member->GetObjectTranslation() - center);
+      member->SetMotherLogical(envelope_logical);
+      envelope_logical->AddDaughter(member);
+    }
+
+    new G4PVPlacement(0, center, envelope_logical, envelope_name + "_Envelope", mother_logical, false, 0, check_overlaps);
+
+    G4cout << "\t" << envelope_name << ": " << members.size() << " volumes in " << 2. * half_size.x() / mm << " mm x " << 2. * half_size.y() / mm << " mm x " << 2. * half_size.z() / mm << " mm at " << center / mm << " mm";
+  }
+  if (n_subtracted > 0) {
+    G4cout << ", " << n_subtracted << " other volume(s) subtracted";
+  }
+  G4cout << G4endl;
+}
+
+void BrickEnvelope::add_masses(G4LogicalVolume *logical, vector<std::pair<G4Material *, G4double>> &masses) {
+  // The material of the logical volume fills its solid, except for the daughters
+  G4double volume = logical->GetSolid()->GetCubicVolume();
+  for (size_t i = 0; i < logical->GetNoDaughters(); ++i) {
+    G4LogicalVolume *daughter_logical = logical->GetDaughter(i)->GetLogicalVolume();
+    volume -= daughter_logical->GetSolid()->GetCubicVolume();
+    add_masses(daughter_logical, masses);
+  }
+
+  const G4double mass = std::max(volume, 0.) * logical->GetMaterial()->GetDensity();
+  for (auto &material_mass : masses) {
+    if (material_mass.first == logical->GetMaterial()) {
+      material_mass.second += mass;
+      return;
+    }
+  }
+  masses.push_back({logical->GetMaterial(), mass});
+}
+
+void BrickEnvelope::bounding_box(const G4VPhysicalVolume *physical, G4ThreeVector &min, G4ThreeVector &max) {
+  G4ThreeVector solid_min, solid_max;
+  physical->GetLogicalVolume()->GetSolid()->BoundingLimits(solid_min, solid_max);
+
+  const G4RotationMatrix rotation = physical->GetObjectRotationValue();
+  const G4ThreeVector translation = physical->GetObjectTranslation();
+  for (unsigned int corner = 0; corner < 8; ++corner) {
+    const G4ThreeVector point = rotation * G4ThreeVector(corner & 1 ? solid_max.x() : solid_min.x(), corner & 2 ? solid_max.y() : solid_min.y(), corner & 4 ? solid_max.z() : solid_min.z()) + translation;
+    if (corner == 0) {
+      min = point;
+      max = point;
+    } else {
+      min = G4ThreeVector(std::min(min.x(), point.x()), std::min(min.y(), point.y()), std::min(min.z(), point.z()));
+      max = G4ThreeVector(std::max(max.x(), point.x()), std::max(max.y(), point.y()), std::max(max.z(), point.z()));
+    }
+  }
+}
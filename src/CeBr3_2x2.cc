@@ -18,6 +18,7 @@ You should have received a copy of the GNU General Public License
 along with utr.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <iomanip>
 #include <sstream>
 using std::stringstream;
 
@@ -30,6 +31,7 @@ using std::stringstream;
 #include "G4VisAttributes.hh"
 
 #include "CeBr3_2x2.hh"
+#include "DetectorModelCache.hh"
 
 void CeBr3_2x2::Construct(G4ThreeVector global_coordinates, G4double theta, G4double phi, G4double dist_from_center, G4double intrinsic_rotation_angle) const {
   /*********** Dimensions ***********/
@@ -82,9 +84,6 @@ void CeBr3_2x2::Construct(G4ThreeVector global_coordinates, G4double theta, G4do
   const G4String pmt_material = "G4_Al"; // Assumption
   const G4String magnetic_shielding_material = "G4_Al"; // Assumption (it is called 'magnetic shield' in the drawing)
   const G4String connector_material = "G4_Al"; // Assume that the connectors on top are made of the same material
-  auto *CeBr3 = new G4Material("CeBr3", 5.1 * g / cm3, 2); // Density from Wikipedia
-  CeBr3->AddElement(nist->FindOrBuildElement("Ce"), 1);
-  CeBr3->AddElement(nist->FindOrBuildElement("Br"), 3);
 
   /*********** Orientation in space ***********/
 
@@ -97,6 +96,21 @@ void CeBr3_2x2::Construct(G4ThreeVector global_coordinates, G4double theta, G4do
   if (intrinsic_rotation_angle != 0.) {
     rotation_matrix->rotateZ(intrinsic_rotation_angle);
   }
+  const G4ThreeVector origin = global_coordinates + dist_from_center * e_r;
+
+  DetectorModel *model = nullptr;
+  if (use_model_cache) {
+    model = DetectorModelCache::Find(model_key(intrinsic_rotation_angle));
+    if (model != nullptr) {
+      DetectorModelCache::Place(model, detector_name, rotation_matrix, origin, world_Logical);
+      return;
+    }
+    model = DetectorModelCache::Create(model_key(intrinsic_rotation_angle));
+  }
+
+  auto *CeBr3 = new G4Material("CeBr3", 5.1 * g / cm3, 2); // Density from Wikipedia
+  CeBr3->AddElement(nist->FindOrBuildElement("Ce"), 1);
+  CeBr3->AddElement(nist->FindOrBuildElement("Br"), 3);
 
   /*********** Front ***********/
 
@@ -105,7 +119,7 @@ void CeBr3_2x2::Construct(G4ThreeVector global_coordinates, G4double theta, G4do
   auto *main_case_solid = new G4Tubs(detector_name + "_main_case_solid", 0., main_case_outer_radius, main_case_length / 2., 0., twopi);
   auto *main_case_logical = new G4LogicalVolume(main_case_solid, nist->FindOrBuildMaterial(main_case_material), detector_name + "_main_case_logical");
   main_case_logical->SetVisAttributes(G4Color::Grey());
-  new G4PVPlacement(rotation_matrix, global_coordinates + (dist_from_center + main_case_length / 2.) * e_r, main_case_logical, detector_name + "_main_case", world_Logical, 0, 0, false);
+  place(rotation_matrix, origin, model, main_case_logical, detector_name + "_main_case", G4ThreeVector(0., 0., main_case_length / 2.));
 
   // Main case vacuum mother volume for crystal and pmt, which are assumed to be sourounded by this vacuum
 
@@ -133,14 +147,14 @@ void CeBr3_2x2::Construct(G4ThreeVector global_coordinates, G4double theta, G4do
   auto *magnetic_shielding_solid = new G4Tubs(detector_name + "_magnetic_shielding_solid", magnetic_shielding_inner_radius, magnetic_shielding_outer_radius, magnetic_shielding_length / 2., 0., twopi);
   auto *magnetic_shielding_logical = new G4LogicalVolume(magnetic_shielding_solid, nist->FindOrBuildMaterial(magnetic_shielding_material), detector_name + "_magnetic_shielding_logical");
   magnetic_shielding_logical->SetVisAttributes(G4Color(0.75, 0.75, 0.75));
-  new G4PVPlacement(rotation_matrix, global_coordinates + (dist_from_center + magnetic_shielding_offset + magnetic_shielding_length / 2.) * e_r, magnetic_shielding_logical, detector_name + "_magnetic_shielding", world_Logical, 0, 0, false);
+  place(rotation_matrix, origin, model, magnetic_shielding_logical, detector_name + "_magnetic_shielding", G4ThreeVector(0., 0., magnetic_shielding_offset + magnetic_shielding_length / 2.));
 
   // Connector base
 
   auto *connector_base_solid = new G4Tubs(detector_name + "_connector_base_solid", 0., connector_base_outer_radius, 0.5 * connector_base_length, 0., twopi);
   auto *connector_base_logical = new G4LogicalVolume(connector_base_solid, nist->FindOrBuildMaterial(connector_material), detector_name + "_connector_base_logical");
   connector_base_logical->SetVisAttributes(G4Color::Grey());
-  new G4PVPlacement(rotation_matrix, global_coordinates + (dist_from_center + main_case_length + 0.5 * connector_base_length) * e_r, connector_base_logical, detector_name + "_connector_base", world_Logical, 0, 0, false);
+  place(rotation_matrix, origin, model, connector_base_logical, detector_name + "_connector_base", G4ThreeVector(0., 0., main_case_length + 0.5 * connector_base_length));
 
   auto *connector_base_inside_solid = new G4Tubs(detector_name + "_connector_base_inside_solid", 0., connector_base_outer_radius - connector_base_wall_thickness, connector_base_length / 2. - connector_base_wall_thickness, 0., twopi);
   auto *connector_base_inside_logical = new G4LogicalVolume(connector_base_inside_solid, nist->FindOrBuildMaterial("G4_AIR"), detector_name + "_connector_base_inside_logical"); // Assume it is filled predominantly with low-density material.
@@ -152,13 +166,13 @@ void CeBr3_2x2::Construct(G4ThreeVector global_coordinates, G4double theta, G4do
     auto *connector_hv_solid = new G4Tubs(detector_name + "_connector_hv_solid", 0., connector_hv_radius, 0.5 * connector_hv_length, 0., twopi);
     auto *connector_hv_logical = new G4LogicalVolume(connector_hv_solid, nist->FindOrBuildMaterial(connector_material), detector_name + "_connector_hv_logical");
     connector_hv_logical->SetVisAttributes(G4Color::Grey());
-    new G4PVPlacement(rotation_matrix, global_coordinates + (dist_from_center + total_housing_length + 0.5 * connector_hv_length) * e_r + 0.5 / sqrt(2.) * connector_base_outer_radius * e_theta + 0.5 / sqrt(2.) * connector_base_outer_radius * e_phi, connector_hv_logical, detector_name + "_connector_hv", world_Logical, 0, 0, false);
+    place(rotation_matrix, origin, model, connector_hv_logical, detector_name + "_connector_hv", (*rotation_matrix) * (0.5 / sqrt(2.) * connector_base_outer_radius * e_theta + 0.5 / sqrt(2.) * connector_base_outer_radius * e_phi) + G4ThreeVector(0., 0., total_housing_length + 0.5 * connector_hv_length));
 
     // Signal connector
     auto *connector_signal_solid = new G4Tubs(detector_name + "_connector_signal_solid", 0., connector_signal_radius, 0.5 * connector_signal_length, 0., twopi);
     auto *connector_signal_logical = new G4LogicalVolume(connector_signal_solid, nist->FindOrBuildMaterial(connector_material), detector_name + "_connector_signal_logical");
     connector_signal_logical->SetVisAttributes(G4Color::Grey());
-    new G4PVPlacement(rotation_matrix, global_coordinates + (dist_from_center + total_housing_length + 0.5 * connector_signal_length) * e_r + 0.5 / sqrt(2.) * connector_base_outer_radius * e_theta - 0.5 / sqrt(2.) * connector_base_outer_radius * e_phi, connector_signal_logical, detector_name + "_connector_signal", world_Logical, 0, 0, false);
+    place(rotation_matrix, origin, model, connector_signal_logical, detector_name + "_connector_signal", (*rotation_matrix) * (0.5 / sqrt(2.) * connector_base_outer_radius * e_theta - 0.5 / sqrt(2.) * connector_base_outer_radius * e_phi) + G4ThreeVector(0., 0., total_housing_length + 0.5 * connector_signal_length));
   }
 
   /************* Filters *************/
@@ -179,7 +193,7 @@ void CeBr3_2x2::Construct(G4ThreeVector global_coordinates, G4double theta, G4do
       } else {
         filter_logical->SetVisAttributes(G4Color::Green());
       }
-      new G4PVPlacement(rotation_matrix, global_coordinates + (dist_from_center - filter_position_z - filter_thicknesses[i] / 2.) * e_r, filter_logical, filter_base_name_ss.str(), world_Logical, 0, 0, false);
+      place(rotation_matrix, origin, model, filter_logical, filter_base_name_ss.str(), G4ThreeVector(0., 0., -filter_position_z - filter_thicknesses[i] / 2.));
       filter_position_z = filter_position_z + filter_thicknesses[i];
       filter_base_name_ss.str("");
     }
@@ -200,13 +214,29 @@ void CeBr3_2x2::Construct(G4ThreeVector global_coordinates, G4double theta, G4do
       } else {
         wrap_logical->SetVisAttributes(G4Color::Red());
       }
-      new G4PVPlacement(rotation_matrix, global_coordinates + (dist_from_center + magnetic_shielding_offset / 2.) * e_r, wrap_logical, wrap_base_name_ss.str(), world_Logical, 0, 0, false);
+      place(rotation_matrix, origin, model, wrap_logical, wrap_base_name_ss.str(), G4ThreeVector(0., 0., magnetic_shielding_offset / 2.));
       wrap_radius = wrap_radius + wrap_thicknesses[i];
       wrap_base_name_ss.str("");
     }
   }
+
+  if (model != nullptr) {
+    DetectorModelCache::AddSensitiveVolume(model, crystal_logical, "");
+    DetectorModelCache::Place(model, detector_name, rotation_matrix, origin, world_Logical);
+  }
 }
 
 void CeBr3_2x2::Construct(G4ThreeVector global_coordinates, G4double theta, G4double phi, G4double dist_from_center) const {
   Construct(global_coordinates, theta, phi, dist_from_center, 0.);
 }
+
+G4String CeBr3_2x2::model_key(G4double intrinsic_rotation_angle) const {
+  stringstream key;
+  key << std::setprecision(17) << "CeBr3_2x2 connectors " << use_connectors;
+  // The positions of the connectors do not follow the intrinsic rotation of the detector
+  if (use_connectors) {
+    key << " " << intrinsic_rotation_angle;
+  }
+  key << filter_and_wrap_key(0.);
+  return key.str();
+}
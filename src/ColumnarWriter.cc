@@ -0,0 +1,91 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "ColumnarWriter.hh"
+
+ColumnarWriter::ColumnarWriter(unsigned int c_size) : chunk_size(c_size), n_rows(0), file(nullptr), n_bytes_written(0) {}
+
+ColumnarWriter::~ColumnarWriter() { Close(); }
+
+unsigned int ColumnarWriter::AddColumn(const string &name, ColumnType type) {
+  // The length of the name is stored in a single byte
+  columns.push_back(Column{name.substr(0, 255), type, GetTypeSize(type), vector<char>(chunk_size * GetTypeSize(type), 0)});
+  return (unsigned int)columns.size() - 1;
+}
+
+void ColumnarWriter::ClearColumns() {
+  columns.clear();
+  n_rows = 0;
+}
+
+bool ColumnarWriter::Open(const string &filename) {
+  Close();
+
+  file = fopen(filename.c_str(), "wb");
+  if (file == nullptr) {
+    return false;
+  }
+  n_bytes_written = 0;
+  n_rows = 0;
+
+  write("UTRCOL01", 8);
+  const uint32_t n_columns = (uint32_t)columns.size();
+  write(&n_columns, sizeof(n_columns));
+  for (auto &c : columns) {
+    const uint8_t type = c.type;
+    const uint8_t name_length = (uint8_t)c.name.size();
+    write(&type, sizeof(type));
+    write(&name_length, sizeof(name_length));
+    write(c.name.data(), name_length);
+  }
+
+  return true;
+}
+
+void ColumnarWriter::Close() {
+  if (file == nullptr) {
+    return;
+  }
+  if (n_rows > 0) {
+    WriteChunk();
+  }
+  fclose(file);
+  file = nullptr;
+}
+
+void ColumnarWriter::write(const void *data, size_t size) {
+  fwrite(data, 1, size, file);
+  n_bytes_written += size;
+}
+
+void ColumnarWriter::WriteChunk() {
+  if (file != nullptr) {
+    const uint32_t n = n_rows;
+    write(&n, sizeof(n));
+    for (auto &c : columns) {
+      write(c.buffer.data(), n_rows * c.type_size);
+    }
+  }
+  // Reset all values, because columns which are not filled in a row are zero
+  for (auto &c : columns) {
+    memset(c.buffer.data(), 0, n_rows * c.type_size);
+  }
+  n_rows = 0;
+}
@@ -18,10 +18,19 @@ You should have received a copy of the GNU General Public License
 along with utr.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <iomanip>
+#include <sstream>
+
+#include "G4PVPlacement.hh"
+
 #include "Detector.hh"
+#include "DetectorModelCache.hh"
+
+using std::stringstream;
 
 Detector::Detector(G4LogicalVolume *World_Logical, G4String name) : world_Logical(World_Logical),
-                                                                    detector_name(name) {}
+                                                                    detector_name(name),
+                                                                    use_model_cache(false) {}
 
 void Detector::Add_Filter(G4String filter_material, G4double filter_thickness, G4double filter_radius) {
   filter_materials.push_back(filter_material);
@@ -33,3 +42,24 @@ void Detector::Add_Wrap(G4String wrap_material, G4double wrap_thickness) {
   wrap_materials.push_back(wrap_material);
   wrap_thicknesses.push_back(wrap_thickness);
 }
+
+void Detector::place(G4RotationMatrix *rotation, G4ThreeVector origin, DetectorModel *model, G4LogicalVolume *logical, G4String name, G4ThreeVector local_position) const {
+  if (model != nullptr) {
+    // The names of all top-level parts start with the name of the detector
+    DetectorModelCache::AddPart(model, logical, name.substr(detector_name.size()), local_position);
+    return;
+  }
+  new G4PVPlacement(rotation, origin + rotation->inverse() * local_position, logical, name, world_Logical, 0, 0, false);
+}
+
+G4String Detector::filter_and_wrap_key(G4double filter_position_z) const {
+  stringstream key;
+  key << std::setprecision(17) << " filters_at " << filter_position_z;
+  for (unsigned int i = 0; i < filter_materials.size(); ++i) {
+    key << " filter " << filter_materials[i] << " " << filter_thicknesses[i] << " " << filter_radii[i];
+  }
+  for (unsigned int i = 0; i < wrap_materials.size(); ++i) {
+    key << " wrap " << wrap_materials[i] << " " << wrap_thicknesses[i];
+  }
+  return key.str();
+}
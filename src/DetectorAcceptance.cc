@@ -0,0 +1,131 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "G4LogicalVolume.hh"
+#include "G4TransportationManager.hh"
+
+#include "DetectorAcceptance.hh"
+
+void DetectorAcceptance::Build() {
+  Clear();
+
+  G4VPhysicalVolume *world = G4TransportationManager::GetTransportationManager()->GetNavigatorForTracking()->GetWorldVolume();
+  find_sensitive_volumes(world, G4RotationMatrix(), G4ThreeVector());
+}
+
+void DetectorAcceptance::Clear() {
+  center_x.clear();
+  center_y.clear();
+  center_z.clear();
+  radius.clear();
+}
+
+void DetectorAcceptance::find_sensitive_volumes(G4VPhysicalVolume *physical_volume, const G4RotationMatrix &rotation, const G4ThreeVector &translation) {
+  G4LogicalVolume *logical_volume = physical_volume->GetLogicalVolume();
+
+  // The sphere of a sensitive volume also contains all its daughters
+  if (logical_volume->GetSensitiveDetector() != nullptr) {
+    add_sphere(logical_volume, rotation, translation);
+    return;
+  }
+
+  for (size_t i = 0; i < logical_volume->GetNoDaughters(); ++i) {
+    G4VPhysicalVolume *daughter = logical_volume->GetDaughter(i);
+    if (daughter->IsReplicated()) {
+      if (contains_sensitive_volume(daughter->GetLogicalVolume())) {
+        add_sphere(logical_volume, rotation, translation);
+        return;
+      }
+      continue;
+    }
+    find_sensitive_volumes(daughter, rotation * daughter->GetObjectRotationValue(), rotation * daughter->GetObjectTranslation() + translation);
+  }
+}
+
+G4bool DetectorAcceptance::contains_sensitive_volume(const G4LogicalVolume *logical_volume) const {
+  if (logical_volume->GetSensitiveDetector() != nullptr) {
+    return true;
+  }
+  for (size_t i = 0; i < logical_volume->GetNoDaughters(); ++i) {
+    if (contains_sensitive_volume(logical_volume->GetDaughter(i)->GetLogicalVolume())) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void DetectorAcceptance::add_sphere(const G4LogicalVolume *logical_volume, const G4RotationMatrix &rotation, const G4ThreeVector &translation) {
+  G4ThreeVector local_min, local_max;
+  logical_volume->GetSolid()->BoundingLimits(local_min, local_max);
+
+  // A rotation does not change the radius of the sphere around the bounding box
+  const G4ThreeVector center = rotation * (0.5 * (local_min + local_max)) + translation;
+  center_x.push_back(center.x());
+  center_y.push_back(center.y());
+  center_z.push_back(center.z());
+  radius.push_back(0.5 * (local_max - local_min).mag());
+}
+
+G4bool DetectorAcceptance::CanReach(const G4ThreeVector &position, const G4ThreeVector &direction) const {
+  if (radius.empty()) {
+    return true;
+  }
+
+  const G4double x = position.x(), y = position.y(), z = position.z();
+  const G4double dx = direction.x(), dy = direction.y(), dz = direction.z();
+
+  for (size_t i = 0; i < radius.size(); ++i) {
+    const G4double vx = center_x[i] - x;
+    const G4double vy = center_y[i] - y;
+    const G4double vz = center_z[i] - z;
+    const G4double distance2 = vx * vx + vy * vy + vz * vz;
+    const G4double r = radius[i] + margin;
+    if (distance2 <= r * r) {
+      return true;
+    }
+    // Distance of the closest approach of the ray to the center of the sphere
+    const G4double projection = vx * dx + vy * dy + vz * dz;
+    if (projection > 0. && distance2 - projection * projection <= r * r) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+G4bool DetectorAcceptance::IsFartherThan(const G4ThreeVector &position, G4double distance) const {
+  if (radius.empty()) {
+    return false;
+  }
+
+  const G4double x = position.x(), y = position.y(), z = position.z();
+
+  for (size_t i = 0; i < radius.size(); ++i) {
+    const G4double vx = center_x[i] - x;
+    const G4double vy = center_y[i] - y;
+    const G4double vz = center_z[i] - z;
+    const G4double r = radius[i] + margin + distance;
+    if (vx * vx + vy * vy + vz * vz <= r * r) {
+      return false;
+    }
+  }
+
+  return true;
+}
@@ -0,0 +1,154 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "G4LogicalVolumeStore.hh"
+#include "G4SDManager.hh"
+#include "G4Transform3D.hh"
+#include "G4VPhysicalVolume.hh"
+
+#include "CopyNumberSD.hh"
+#include "DetectorModelCache.hh"
+
+std::map<G4String, DetectorModel *> DetectorModelCache::models;
+std::map<G4String, DetectorModelCache::Placement> DetectorModelCache::placements;
+G4ThreadLocal std::map<G4LogicalVolume *, CopyNumberSD *> *DetectorModelCache::copy_number_sds = nullptr;
+
+DetectorModel *DetectorModelCache::Find(const G4String &key) {
+  auto model = models.find(key);
+  if (model == models.end()) {
+    return nullptr;
+  }
+  return model->second;
+}
+
+DetectorModel *DetectorModelCache::Create(const G4String &key) {
+  if (Find(key) != nullptr) {
+    G4cerr << "ERROR: DetectorModelCache::Create(): A detector model with the key '" << key << "' already exists! Aborting..." << G4endl;
+    throw std::exception();
+  }
+  auto *model = new DetectorModel{new G4AssemblyVolume(), {}, {}, 0};
+  models[key] = model;
+  return model;
+}
+
+void DetectorModelCache::AddPart(DetectorModel *model, G4LogicalVolume *logical, const G4String &suffix, G4ThreeVector local_position) {
+  model->assembly->AddPlacedVolume(logical, local_position, (G4RotationMatrix *)nullptr);
+  model->part_suffixes.push_back(suffix);
+}
+
+void DetectorModelCache::AddSensitiveVolume(DetectorModel *model, G4LogicalVolume *logical, const G4String &suffix) {
+  auto triplet = model->assembly->GetTripletsIterator();
+  for (size_t part = 0; part < model->assembly->TotalTriplets(); ++part, ++triplet) {
+    const G4int depth = find_depth(triplet->GetVolume(), logical);
+    if (depth >= 0) {
+      model->sensitive_volumes.push_back({logical, suffix, part, depth});
+      return;
+    }
+  }
+  G4cerr << "ERROR: DetectorModelCache::AddSensitiveVolume(): The logical volume " << logical->GetName() << " is not part of the detector model! Aborting..." << G4endl;
+  throw std::exception();
+}
+
+void DetectorModelCache::Place(DetectorModel *model, const G4String &detector_name, G4RotationMatrix *rotation, const G4ThreeVector &origin, G4LogicalVolume *mother_logical) {
+  const size_t n_parts = model->assembly->TotalTriplets();
+  ++model->n_placements;
+
+  // The copy numbers of the imprints do not overlap, and none of them is zero.
+  // They are read back from the imprinted physical volumes below, which are the last ones in the store of the assembly.
+  G4Transform3D transformation(rotation->inverse(), origin);
+  model->assembly->MakeImprint(mother_logical, transformation, (G4int)(model->n_placements * n_parts), false);
+
+  // Replace the names of G4AssemblyVolume (av_WWW_impr_XXX_YYY_ZZZ) by the names the parts would
+  // have without the cache, so that they can still be found by their names
+  auto first_imprinted_volume = model->assembly->GetVolumesIterator() + (model->assembly->TotalImprintedVolumes() - n_parts);
+  for (size_t part = 0; part < n_parts; ++part) {
+    (*(first_imprinted_volume + part))->SetName(detector_name + model->part_suffixes[part]);
+  }
+
+  for (auto sensitive_volume : model->sensitive_volumes) {
+    const G4String name = detector_name + sensitive_volume.suffix;
+    if (placements.find(name) != placements.end()) {
+      G4cerr << "ERROR: DetectorModelCache::Place(): A sensitive volume with the name " << name << " has already been placed! Aborting..." << G4endl;
+      throw std::exception();
+    }
+    placements[name] = {sensitive_volume.logical, sensitive_volume.depth, (*(first_imprinted_volume + sensitive_volume.part))->GetCopyNo()};
+  }
+}
+
+void DetectorModelCache::SetSensitiveDetector(const G4String &name, G4VSensitiveDetector *sensitive_detector) {
+  auto placement = placements.find(name);
+
+  if (placement == placements.end()) {
+    bool found = false;
+    for (auto logical_volume : *G4LogicalVolumeStore::GetInstance()) {
+      if (logical_volume->GetName() == name) {
+        logical_volume->SetSensitiveDetector(sensitive_detector);
+        found = true;
+      }
+    }
+    if (!found) {
+      G4cerr << "ERROR: DetectorModelCache::SetSensitiveDetector(): No logical volume with the name " << name << " found! Aborting..." << G4endl;
+      throw std::exception();
+    }
+    return;
+  }
+
+  if (copy_number_sds == nullptr) {
+    copy_number_sds = new std::map<G4LogicalVolume *, CopyNumberSD *>();
+  }
+  auto copy_number_sd = copy_number_sds->find(placement->second.logical);
+  if (copy_number_sd == copy_number_sds->end()) {
+    auto *new_copy_number_sd = new CopyNumberSD(placement->second.logical->GetName() + "_copy_numbers", placement->second.depth);
+    G4SDManager::GetSDMpointer()->AddNewDetector(new_copy_number_sd);
+    placement->second.logical->SetSensitiveDetector(new_copy_number_sd);
+    copy_number_sd = copy_number_sds->insert({placement->second.logical, new_copy_number_sd}).first;
+  }
+  copy_number_sd->second->AddSensitiveDetector(placement->second.copy_number, sensitive_detector);
+}
+
+void DetectorModelCache::PrintSummary() {
+  if (models.empty()) {
+    return;
+  }
+
+  G4cout << "================================================================================" << G4endl;
+  G4cout << "Shared detector models:" << G4endl;
+  for (auto model : models) {
+    G4cout << "\t" << model.second->n_placements << " detector(s) with " << model.second->assembly->TotalTriplets() << " top-level part(s) and " << model.second->sensitive_volumes.size() << " sensitive volume(s) (";
+    for (size_t i = 0; i < model.second->sensitive_volumes.size(); ++i) {
+      G4cout << (i ? ", " : "") << model.second->sensitive_volumes[i].logical->GetName();
+    }
+    G4cout << ")" << G4endl;
+  }
+  G4cout << "================================================================================" << G4endl;
+}
+
+G4int DetectorModelCache::find_depth(G4LogicalVolume *mother_logical, G4LogicalVolume *logical) {
+  if (mother_logical == logical) {
+    return 0;
+  }
+  for (size_t i = 0; i < mother_logical->GetNoDaughters(); ++i) {
+    const G4int depth = find_depth(mother_logical->GetDaughter(i)->GetLogicalVolume(), logical);
+    if (depth >= 0) {
+      return depth + 1;
+    }
+  }
+  return -1;
+}
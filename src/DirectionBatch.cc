@@ -0,0 +1,110 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <cmath>
+
+#include "DirectionBatch.hh"
+
+DirectionBatch::DirectionBatch(unsigned int batch_size) : size(0), next(0), n_directions(0), n_proposed(0), n_accepted(0) {
+  SetSize(batch_size);
+}
+
+void DirectionBatch::SetSize(unsigned int batch_size) {
+  size = batch_size;
+
+  theta.resize(size);
+  phi.resize(size);
+  envelope.resize(size);
+  w.resize(size);
+  u_w.resize(size);
+
+  accepted_theta.resize(size);
+  accepted_phi.resize(size);
+  direction_x.resize(size);
+  direction_y.resize(size);
+  direction_z.resize(size);
+
+  n_proposed = 0;
+  n_accepted = 0;
+  Clear();
+}
+
+bool DirectionBatch::Fill(const UniformFunction &uniform, const ProposalFunction &propose, const EvaluationFunction &evaluate, unsigned int max_rounds) {
+  Clear();
+  if (size == 0)
+    return false;
+
+  unsigned int n_found = 0;
+  for (unsigned int round = 0; round < max_rounds && n_found < size; ++round) {
+    // Propose only as many candidates as are expected to be needed to fill the buffer, with a
+    // small safety margin, so that W is not evaluated for candidates which would be discarded
+    unsigned int n_candidates = size;
+    if (evaluate && n_accepted > 0) {
+      const double acceptance = (double)n_accepted / (double)n_proposed;
+      n_candidates = std::min(size, (unsigned int)((size - n_found) / acceptance * 1.1) + 16);
+    }
+
+    propose(n_candidates, &theta[0], &phi[0], &envelope[0]);
+    n_proposed += n_candidates;
+
+    if (evaluate) {
+      evaluate(&theta[0], &phi[0], &w[0], n_candidates);
+      uniform(n_candidates, &u_w[0]);
+
+      for (unsigned int i = 0; i < n_candidates && n_found < size; ++i) {
+        if (u_w[i] * envelope[i] <= w[i]) {
+          accepted_theta[n_found] = theta[i];
+          accepted_phi[n_found] = phi[i];
+          ++n_found;
+        }
+      }
+    } else {
+      for (unsigned int i = 0; i < size; ++i) {
+        accepted_theta[i] = theta[i];
+        accepted_phi[i] = phi[i];
+      }
+      n_found = size;
+    }
+  }
+  n_accepted += n_found;
+
+  // 0 <= theta <= pi, so that sin(theta) is never negative
+  for (unsigned int i = 0; i < n_found; ++i) {
+    const double cos_theta = cos(accepted_theta[i]);
+    const double sin_theta = sqrt(std::max(1. - cos_theta * cos_theta, 0.));
+    direction_x[i] = sin_theta * cos(accepted_phi[i]);
+    direction_y[i] = sin_theta * sin(accepted_phi[i]);
+    direction_z[i] = cos_theta;
+  }
+  n_directions = n_found;
+
+  return n_found > 0;
+}
+
+void DirectionBatch::ProposeIsotropic(const UniformFunction &uniform, unsigned int n, double *theta, double *phi, double *envelope, double envelope_value) {
+  uniform(n, theta);
+  uniform(n, phi);
+  for (unsigned int i = 0; i < n; ++i) {
+    theta[i] = acos(2. * theta[i] - 1.);
+    phi[i] = 2. * M_PI * phi[i];
+    envelope[i] = envelope_value;
+  }
+}
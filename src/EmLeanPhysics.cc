@@ -0,0 +1,136 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "G4BetheHeitler5DModel.hh"
+#include "G4ChargedGeantino.hh"
+#include "G4ComptonScattering.hh"
+#include "G4Electron.hh"
+#include "G4EmParameters.hh"
+#include "G4Gamma.hh"
+#include "G4GammaConversion.hh"
+#include "G4Geantino.hh"
+#include "G4LivermorePhotoElectricModel.hh"
+#include "G4LivermorePolarizedComptonModel.hh"
+#include "G4LivermorePolarizedRayleighModel.hh"
+#include "G4LossTableManager.hh"
+#include "G4PhotoElectricEffect.hh"
+#include "G4PhysicsListHelper.hh"
+#include "G4Positron.hh"
+#include "G4RayleighScattering.hh"
+#include "G4SystemOfUnits.hh"
+#include "G4UAtomicDeexcitation.hh"
+#include "G4eBremsstrahlung.hh"
+#include "G4eIonisation.hh"
+#include "G4eMultipleScattering.hh"
+#include "G4eplusAnnihilation.hh"
+
+#include "EmLeanPhysics.hh"
+#include "utrConfig.h"
+
+#ifdef EM_EXTRA
+#include "G4BaryonConstructor.hh"
+#include "G4BosonConstructor.hh"
+#include "G4IonConstructor.hh"
+#include "G4LeptonConstructor.hh"
+#include "G4MesonConstructor.hh"
+#include "G4ShortLivedConstructor.hh"
+#endif
+
+EmLeanPhysics::EmLeanPhysics(G4int ver) : G4VPhysicsConstructor("EmLeanPhysics") {
+  SetVerboseLevel(ver);
+  SetPhysicsType(bElectromagnetic);
+
+  // Same lower limits and binning of the tables as in G4EmLivermorePolarizedPhysics
+  G4EmParameters *parameters = G4EmParameters::Instance();
+  parameters->SetDefaults();
+  parameters->SetVerbose(ver);
+  parameters->SetMinEnergy(100. * eV);
+  parameters->SetLowestElectronEnergy(100. * eV);
+  parameters->SetNumberOfBinsPerDecade(20);
+  parameters->SetFluo(true);
+}
+
+EmLeanPhysics::~EmLeanPhysics() {}
+
+void EmLeanPhysics::ConstructParticle() {
+  G4Gamma::Definition();
+  G4Electron::Definition();
+  G4Positron::Definition();
+
+  // The default particle of the G4GeneralParticleSource
+  G4Geantino::Definition();
+  G4ChargedGeantino::Definition();
+
+#ifdef EM_EXTRA
+  // The photonuclear models of G4EmExtraPhysics need the definitions of all hadrons and nuclei
+  // which they may produce, even though these are not tracked (see StackingAction)
+  G4BosonConstructor boson_constructor;
+  boson_constructor.ConstructParticle();
+  G4LeptonConstructor lepton_constructor;
+  lepton_constructor.ConstructParticle();
+  G4MesonConstructor meson_constructor;
+  meson_constructor.ConstructParticle();
+  G4BaryonConstructor baryon_constructor;
+  baryon_constructor.ConstructParticle();
+  G4IonConstructor ion_constructor;
+  ion_constructor.ConstructParticle();
+  G4ShortLivedConstructor short_lived_constructor;
+  short_lived_constructor.ConstructParticle();
+#endif
+}
+
+void EmLeanPhysics::ConstructProcess() {
+  G4PhysicsListHelper *helper = G4PhysicsListHelper::GetPhysicsListHelper();
+
+  // Photons
+  G4ParticleDefinition *particle = G4Gamma::Definition();
+
+  G4PhotoElectricEffect *photoelectric_effect = new G4PhotoElectricEffect();
+  photoelectric_effect->SetEmModel(new G4LivermorePhotoElectricModel());
+  helper->RegisterProcess(photoelectric_effect, particle);
+
+  G4ComptonScattering *compton_scattering = new G4ComptonScattering();
+  compton_scattering->SetEmModel(new G4LivermorePolarizedComptonModel());
+  helper->RegisterProcess(compton_scattering, particle);
+
+  G4GammaConversion *gamma_conversion = new G4GammaConversion();
+  gamma_conversion->SetEmModel(new G4BetheHeitler5DModel());
+  helper->RegisterProcess(gamma_conversion, particle);
+
+  G4RayleighScattering *rayleigh_scattering = new G4RayleighScattering();
+  rayleigh_scattering->SetEmModel(new G4LivermorePolarizedRayleighModel());
+  helper->RegisterProcess(rayleigh_scattering, particle);
+
+  // Electrons
+  particle = G4Electron::Definition();
+  helper->RegisterProcess(new G4eMultipleScattering(), particle);
+  helper->RegisterProcess(new G4eIonisation(), particle);
+  helper->RegisterProcess(new G4eBremsstrahlung(), particle);
+
+  // Positrons
+  particle = G4Positron::Definition();
+  helper->RegisterProcess(new G4eMultipleScattering(), particle);
+  helper->RegisterProcess(new G4eIonisation(), particle);
+  helper->RegisterProcess(new G4eBremsstrahlung(), particle);
+  helper->RegisterProcess(new G4eplusAnnihilation(), particle);
+
+  // Fluorescence and Auger electrons
+  G4LossTableManager::Instance()->SetAtomDeexcitation(new G4UAtomicDeexcitation());
+}
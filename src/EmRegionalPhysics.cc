@@ -0,0 +1,70 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "G4EmConfigurator.hh"
+#include "G4Gamma.hh"
+#include "G4LivermorePhotoElectricModel.hh"
+#include "G4LivermorePolarizedComptonModel.hh"
+#include "G4LivermorePolarizedRayleighModel.hh"
+#include "G4LossTableManager.hh"
+#include "G4PhysicsListHelper.hh"
+#include "G4ProcessManager.hh"
+#include "G4RayleighScattering.hh"
+#include "G4RegionStore.hh"
+#include "G4SystemOfUnits.hh"
+
+#include "EmRegionalPhysics.hh"
+
+vector<G4String> EmRegionalPhysics::polarized_regions = {"detectors", "target"};
+
+EmRegionalPhysics::EmRegionalPhysics(G4int ver) : G4EmStandardPhysics_option1(ver) {}
+
+EmRegionalPhysics::~EmRegionalPhysics() {}
+
+void EmRegionalPhysics::ConstructProcess() {
+  G4EmStandardPhysics_option1::ConstructProcess();
+
+  // Depending on the Geant4 version, the standard physics may not contain Rayleigh scattering,
+  // which is needed for the polarized Rayleigh model. Elsewhere, the default Livermore model is used.
+  if (G4Gamma::Definition()->GetProcessManager()->GetProcess("Rayl") == nullptr) {
+    G4PhysicsListHelper::GetPhysicsListHelper()->RegisterProcess(new G4RayleighScattering(), G4Gamma::Definition());
+  }
+
+  G4EmConfigurator *em_configurator = G4LossTableManager::Instance()->EmConfigurator();
+  for (auto region_name : polarized_regions) {
+    // The regions are shared by all threads, and they are only modified by the master thread.
+    // Regions which utrRegions does not know about are created here, so that the G4EmConfigurator finds them.
+    if (G4Threading::IsMasterThread() && region_name != "DefaultRegionForTheWorld") {
+      G4RegionStore::GetInstance()->FindOrCreateRegion(region_name);
+    }
+    em_configurator->SetExtraEmModel("gamma", "compt", new G4LivermorePolarizedComptonModel(), region_name, 0., 1. * GeV);
+    em_configurator->SetExtraEmModel("gamma", "Rayl", new G4LivermorePolarizedRayleighModel(), region_name, 0., 1. * GeV);
+    em_configurator->SetExtraEmModel("gamma", "phot", new G4LivermorePhotoElectricModel(), region_name, 0., 1. * GeV);
+  }
+}
+
+void EmRegionalPhysics::CheckRegions() {
+  for (auto region_name : polarized_regions) {
+    G4Region *region = G4RegionStore::GetInstance()->GetRegion(region_name, false);
+    if (region == nullptr || region->GetNumberOfRootVolumes() == 0) {
+      G4cout << "WARNING: EmRegionalPhysics: The region " << region_name << " contains no volumes, so the polarized Livermore models are not used anywhere for it. Assign volumes to it with utrRegions::AddVolume() in the DetectorConstruction or with /utr/region/addVolumes " << region_name << " <pattern>, or remove it with /utr/physics/polarizedRegions." << G4endl;
+    }
+  }
+}
@@ -0,0 +1,43 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <limits>
+
+#include "EnergyDepositionAccumulator.hh"
+
+G4ThreadLocal EnergyDepositionAccumulator *EnergyDepositionAccumulator::instance = nullptr;
+
+EnergyDepositionAccumulator *EnergyDepositionAccumulator::Instance() {
+  if (instance == nullptr) {
+    instance = new EnergyDepositionAccumulator();
+  }
+  return instance;
+}
+
+unsigned int EnergyDepositionAccumulator::AddSlot() {
+  // A new slot has an epoch which never occurs, i.e. it has not been hit yet
+  slot_epoch.push_back(std::numeric_limits<uint64_t>::max());
+  edep.push_back(0.);
+  first_ekin.push_back(0.);
+  first_particle.push_back(0);
+  first_position.push_back(G4ThreeVector());
+  first_momentum.push_back(G4ThreeVector());
+  return (unsigned int)slot_epoch.size() - 1;
+}
@@ -19,16 +19,18 @@ along with utr.  If not, see <http://www.gnu.org/licenses/>.
 */
 
 #include "EnergyDepositionSD.hh"
-#include "DetectorConstruction.hh"
+#include "EnergyDepositionAccumulator.hh"
+#include "EventAction.hh"
+#include "G4EventManager.hh"
 #include "G4HCofThisEvent.hh"
-#include "G4RootAnalysisManager.hh"
+#include "G4Run.hh"
 #include "G4RunManager.hh"
 #include "G4SDManager.hh"
 #include "G4Step.hh"
-#include "G4Threading.hh"
 #include "G4ThreeVector.hh"
 #include "G4VProcess.hh"
 #include "G4ios.hh"
+#include "OutputWriter.hh"
 #include "RunAction.hh"
 #include "TargetHit.hh"
 
@@ -36,31 +38,47 @@ along with utr.  If not, see <http://www.gnu.org/licenses/>.
 
 EnergyDepositionSD::EnergyDepositionSD(const G4String &name,
                                        const G4String &hitsCollectionName)
-    : G4VSensitiveDetector(name), hitsCollection(NULL), detectorID(0), eventID(0) {
+    : G4VSensitiveDetector(name), hitsCollection(NULL), detectorID(0), eventID(0), epoch(0) {
 
   collectionName.insert(hitsCollectionName);
+
+  // Sensitive detectors are constructed by the thread which uses them
+  accumulator = EnergyDepositionAccumulator::Instance();
+  slot = accumulator->AddSlot();
 }
 
 EnergyDepositionSD::~EnergyDepositionSD() {}
 
 void EnergyDepositionSD::Initialize(G4HCofThisEvent *hce) {
 
+#ifdef EDEP_HITS_COLLECTION
   hitsCollection =
       new TargetHitsCollection(SensitiveDetectorName, collectionName[0]);
 
   G4int hcID =
       G4SDManager::GetSDMpointer()->GetCollectionID(collectionName[0]);
   hce->AddHitsCollection(hcID, hitsCollection);
+#else
+  (void)hce;
+#endif
 
   eventID = G4RunManager::GetRunManager()->GetCurrentEvent()->GetEventID();
+  epoch = EnergyDepositionAccumulator::GetEpoch(G4RunManager::GetRunManager()->GetCurrentRun()->GetRunID(), eventID);
 }
 
 G4bool EnergyDepositionSD::ProcessHits(G4Step *aStep, G4TouchableHistory *) {
 
-  TargetHit *hit = new TargetHit();
-
   G4Track *track = aStep->GetTrack();
 
+  // Only the first step in an event records the properties of the particle
+  if (!accumulator->IsHit(slot, epoch)) {
+    accumulator->SetFirstHit(slot, epoch, aStep->GetPreStepPoint()->GetKineticEnergy(), track->GetDefinition()->GetPDGEncoding(), track->GetPosition(), track->GetMomentum());
+  }
+  accumulator->AddEnergyDeposition(slot, aStep->GetTotalEnergyDeposit());
+
+#ifdef EDEP_HITS_COLLECTION
+  TargetHit *hit = new TargetHit();
+
   hit->SetKineticEnergy(aStep->GetPreStepPoint()->GetKineticEnergy());
   hit->SetEnergyDeposition(aStep->GetTotalEnergyDeposit());
   hit->SetParticleType(track->GetDefinition()->GetPDGEncoding());
@@ -70,82 +88,31 @@ G4bool EnergyDepositionSD::ProcessHits(G4Step *aStep, G4TouchableHistory *) {
   hit->SetMomentum(track->GetMomentum());
 
   hitsCollection->insert(hit);
+#endif
 
   return true;
 }
 
-// Initialize static member needed for EVENT_EVENTWISE mode, actual initialization values is, however, set in utr.cc
-std::vector<bool> EnergyDepositionSD::anyDetectorHitInEvent = std::vector<bool>();
-
 void EnergyDepositionSD::EndOfEvent(G4HCofThisEvent *) {
 
-  G4int nHits = hitsCollection->entries();
-  G4double totalEnergyDeposition = 0.;
-
-  for (G4int i = 0; i < nHits; i++) {
-    totalEnergyDeposition += (*hitsCollection)[i]->GetEnergyDeposition();
-  }
+  G4double totalEnergyDeposition = accumulator->IsHit(slot, epoch) ? accumulator->GetEnergyDeposition(slot) : 0.;
 
 #ifdef EVENT_EVENTWISE
-  G4RootAnalysisManager *analysisManager = G4RootAnalysisManager::Instance();
   if (totalEnergyDeposition > 0.) {
-    analysisManager->FillNtupleDColumn(0, GetDetectorID(), totalEnergyDeposition);
-    anyDetectorHitInEvent[G4Threading::G4GetThreadId()] = true;
-  }
-  if (anyDetectorHitInEvent[G4Threading::G4GetThreadId()] && GetDetectorID() == ((DetectorConstruction *)G4RunManager::GetRunManager()->GetUserDetectorConstruction())->Max_Sensitive_Detector_ID) {
-    analysisManager->AddNtupleRow();
-    anyDetectorHitInEvent[G4Threading::G4GetThreadId()] = false;
+    ((EventAction *)G4EventManager::GetEventManager()->GetUserEventAction())->AddEventwiseEnergyDeposition(GetDetectorID(), totalEnergyDeposition);
   }
 #else
   if (totalEnergyDeposition > 0.) {
-    G4RootAnalysisManager *analysisManager = G4RootAnalysisManager::Instance();
-
-    unsigned int nentry = 0;
-
-#ifdef EVENT_ID
-    analysisManager->FillNtupleDColumn(nentry, eventID);
-    ++nentry;
-#endif
-#ifdef EVENT_EDEP
-    analysisManager->FillNtupleDColumn(nentry, totalEnergyDeposition);
-    ++nentry;
-#endif
-#ifdef EVENT_EKIN
-    analysisManager->FillNtupleDColumn(nentry, (*hitsCollection)[0]->GetKineticEnergy());
-    ++nentry;
-#endif
-#ifdef EVENT_PARTICLE
-    analysisManager->FillNtupleDColumn(nentry, (*hitsCollection)[0]->GetParticleType());
-    ++nentry;
-#endif
-#ifdef EVENT_VOLUME
-    analysisManager->FillNtupleDColumn(nentry, GetDetectorID());
-    ++nentry;
-#endif
-#ifdef EVENT_POSX
-    analysisManager->FillNtupleDColumn(nentry, (*hitsCollection)[0]->GetPosition().x());
-    ++nentry;
-#endif
-#ifdef EVENT_POSY
-    analysisManager->FillNtupleDColumn(nentry, (*hitsCollection)[0]->GetPosition().y());
-    ++nentry;
-#endif
-#ifdef EVENT_POSZ
-    analysisManager->FillNtupleDColumn(nentry, (*hitsCollection)[0]->GetPosition().z());
-    ++nentry;
-#endif
-#ifdef EVENT_MOMX
-    analysisManager->FillNtupleDColumn(nentry, (*hitsCollection)[0]->GetMomentum().x());
-    ++nentry;
-#endif
-#ifdef EVENT_MOMY
-    analysisManager->FillNtupleDColumn(nentry, (*hitsCollection)[0]->GetMomentum().y());
-    ++nentry;
-#endif
-#ifdef EVENT_MOMZ
-    analysisManager->FillNtupleDColumn(nentry, (*hitsCollection)[0]->GetMomentum().z());
-#endif
-    analysisManager->AddNtupleRow();
+    OutputRow row;
+    row.event = eventID;
+    row.edep = totalEnergyDeposition;
+    row.ekin = accumulator->GetKineticEnergy(slot);
+    row.particle = accumulator->GetParticleType(slot);
+    row.volume = GetDetectorID();
+    row.position = accumulator->GetPosition(slot);
+    row.momentum = accumulator->GetMomentum(slot);
+
+    OutputWriter::Instance()->AddRow(row);
   }
 #endif
 }
@@ -0,0 +1,54 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <cmath>
+
+#include "EnergyHistograms.hh"
+
+void EnergyHistograms::SetBinning(unsigned int n_det, double bin_width, double e_maximum) {
+  n_detectors = n_det;
+  e_min = -0.5 * bin_width;
+  n_bins = (unsigned int)ceil((e_maximum - e_min) / bin_width);
+  e_max = e_min + n_bins * bin_width;
+
+  counts.assign(n_detectors * (n_bins + 2), 0);
+  n_skipped = 0;
+}
+
+void EnergyHistograms::Add(const EnergyHistograms &other) {
+  for (size_t i = 0; i < counts.size(); ++i) {
+    counts[i] += other.counts[i];
+  }
+  n_skipped += other.n_skipped;
+}
+
+void EnergyHistograms::Reset() {
+  std::fill(counts.begin(), counts.end(), 0);
+  n_skipped = 0;
+}
+
+uint64_t EnergyHistograms::GetSumCount(unsigned int bin) const {
+  uint64_t sum = 0;
+  for (unsigned int detector = 0; detector < n_detectors; ++detector) {
+    sum += GetCount(detector, bin);
+  }
+  return sum;
+}
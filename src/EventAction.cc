@@ -21,46 +21,52 @@ along with utr.  If not, see <http://www.gnu.org/licenses/>.
 #include "EventAction.hh"
 #include "DetectorConstruction.hh"
 #include "G4Event.hh"
-#include "G4MTRunManager.hh"
 #include "G4RunManager.hh"
-#include <chrono>
 
 #include "G4LogicalVolume.hh"
+#include "EventTimer.hh"
+#include "OutputWriter.hh"
+#include "ProgressMonitor.hh"
+#include "SteppingProfiler.hh"
 #include "utrConfig.h"
 
-using std::setw;
-using std::string;
-using std::to_string;
+EventAction::EventAction() : skipped_eventwise_detector(-1) {}
 
-// static const auto StartRunTime = time();
-static const auto StartRunTime = std::chrono::steady_clock::now();
+EventAction::~EventAction() {}
 
-EventAction::EventAction() : n_threads(1) {}
+void EventAction::BeginOfEventAction(const G4Event *event) {
+  if (SteppingProfiler::GetEnabled()) {
+    SteppingProfiler::BeginOfEvent();
+  }
 
-EventAction::~EventAction() {}
+#ifdef EVENT_EVENTWISE
+  // The geometry, which determines the number of detectors, may not exist yet when the EventAction is constructed
+  if (eventwise_edep.empty()) {
+    auto max_sensitive_detector_ID = ((DetectorConstruction *)G4RunManager::GetRunManager()->GetUserDetectorConstruction())->Max_Sensitive_Detector_ID;
+    eventwise_edep.assign(max_sensitive_detector_ID + 1, 0.);
+  }
+#endif
+
+  EventTimer::BeginOfEvent(event);
+}
 
 void EventAction::EndOfEventAction(const G4Event *event) {
-  int eID = event->GetEventID();
-  if (0 == (eID % print_progress)) {
-#ifdef G4MULTITHREADED
-    G4RunManager *runManager = G4MTRunManager::GetRunManager();
-#else
-    G4RunManager *runManager = G4RunManager::GetRunManager();
-#endif
-    int NbEvents = runManager->GetNumberOfEventsToBeProcessed();
-    int threadID = G4Threading::G4GetThreadId();
-    int numberofpadchars = to_string(n_threads - 1).length() - to_string(threadID).length();
-    string padchars(numberofpadchars, ' ');
-    auto elapsedSeconds = (std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now() - StartRunTime)).count();
-    int days = elapsedSeconds / (24 * 3600);
-    int hours = (elapsedSeconds - days * (24 * 3600)) / 3600;
-    int minutes = (elapsedSeconds - days * (24 * 3600) - hours * 3600) / 60;
-    int sec = (elapsedSeconds - days * (24 * 3600) - hours * 3600 - minutes * 60);
-    float percent = (float)((float)eID / (float)NbEvents * 100.);
+  EventTimer::EndOfEvent(event);
 
-    G4cout << padchars << "Progress: [" << setw(16) << eID << "/" << NbEvents << "]  "
-           << setw(4) << std::setprecision(2) << std::fixed << percent << " %"
-           << "\tRunning time: " << setw(3) << days << "d " << setw(2) << hours << "h " << setw(3) << minutes << "mn " << setw(3) << sec << "s"
-           << G4endl;
+#ifdef EVENT_EVENTWISE
+  if (!eventwise_hit_detectors.empty()) {
+    OutputWriter::Instance()->AddEventwiseRow(event->GetEventID(), eventwise_edep, eventwise_hit_detectors);
+    for (auto detector : eventwise_hit_detectors) {
+      eventwise_edep[detector] = 0.;
+    }
+    eventwise_hit_detectors.clear();
+  }
+  if (skipped_eventwise_detector != -1) {
+    G4cerr << "WARNING: EventAction: Energy deposition in detector " << skipped_eventwise_detector << " was not recorded, because its ID is larger than Max_Sensitive_Detector_ID = " << eventwise_edep.size() - 1 << " of the DetectorConstruction." << G4endl;
+    skipped_eventwise_detector = -1;
   }
+#endif
+
+  // The progress is reported by the ProgressMonitor
+  ProgressMonitor::CountEvent();
 }
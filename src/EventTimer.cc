@@ -0,0 +1,360 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include "G4IonTable.hh"
+#include "G4ParticleTable.hh"
+#include "G4PrimaryParticle.hh"
+#include "G4PrimaryVertex.hh"
+#include "G4Run.hh"
+#include "G4RunManager.hh"
+#include "G4SystemOfUnits.hh"
+#include "G4Threading.hh"
+#include "Randomize.hh"
+
+#include "EventTimer.hh"
+#include "utrFilenameTools.hh"
+
+// Logarithmic bins of the histogram of event durations. The first bin also contains all events
+// below the lowest edge, the last bin all events above the highest edge.
+#define EVENT_TIMER_MIN_SECONDS 1e-6
+#define EVENT_TIMER_BINS_PER_DECADE 4
+#define EVENT_TIMER_N_BINS 44
+
+G4bool EventTimer::histogram = false;
+G4double EventTimer::slow_threshold = 0.;
+G4int EventTimer::max_slow_events = 100;
+std::atomic<G4bool> EventTimer::replaying(false);
+
+G4ThreadLocal EventTimer::ThreadTimer *EventTimer::timer = nullptr;
+
+vector<unsigned long> EventTimer::total_events(EVENT_TIMER_N_BINS, 0);
+vector<G4double> EventTimer::total_seconds(EVENT_TIMER_N_BINS, 0.);
+G4double EventTimer::total_max_seconds = 0.;
+vector<EventTimer::SlowEvent> EventTimer::total_slow_events;
+std::mutex EventTimer::statistics_mutex;
+
+std::deque<EventTimer::SlowEvent> EventTimer::replay_queue;
+std::mutex EventTimer::replay_mutex;
+
+static G4double bin_edge(unsigned int n) {
+  return EVENT_TIMER_MIN_SECONDS * pow(10., (G4double)n / EVENT_TIMER_BINS_PER_DECADE);
+}
+
+unsigned int EventTimer::bin(G4double seconds) {
+  if (seconds <= EVENT_TIMER_MIN_SECONDS) {
+    return 0;
+  }
+  return std::min((unsigned int)(EVENT_TIMER_BINS_PER_DECADE * log10(seconds / EVENT_TIMER_MIN_SECONDS)), (unsigned int)EVENT_TIMER_N_BINS - 1);
+}
+
+void EventTimer::keep_slowest(vector<SlowEvent> &slow_events, const SlowEvent &slow_event) {
+  if (slow_events.size() < (size_t)max_slow_events) {
+    slow_events.push_back(slow_event);
+    return;
+  }
+  auto fastest = std::min_element(slow_events.begin(), slow_events.end(), [](const SlowEvent &a, const SlowEvent &b) { return a.seconds < b.seconds; });
+  if (fastest != slow_events.end() && fastest->seconds < slow_event.seconds) {
+    *fastest = slow_event;
+  }
+}
+
+void EventTimer::BeginOfEvent(const G4Event *event) {
+  const G4bool capture = slow_threshold > 0. && !replaying;
+  if (!histogram && !capture) {
+    return;
+  }
+
+  if (timer == nullptr) {
+    timer = new ThreadTimer;
+    timer->n_events.assign(EVENT_TIMER_N_BINS, 0);
+    timer->seconds.assign(EVENT_TIMER_N_BINS, 0.);
+    timer->max_seconds = 0.;
+  }
+
+  timer->current.engine_state.clear();
+  timer->current.primaries.clear();
+  if (capture) {
+    // The primaries have already been generated at this point, so the state of the engine is
+    // the one in which the tracking of the event starts
+    CLHEP::HepRandomEngine *engine = G4Random::getTheEngine();
+    timer->current.engine = engine->name();
+    timer->current.engine_state = engine->put();
+    for (G4int i = 0; i < event->GetNumberOfPrimaryVertex(); ++i) {
+      const G4PrimaryVertex *vertex = event->GetPrimaryVertex(i);
+      for (G4int j = 0; j < vertex->GetNumberOfParticle(); ++j) {
+        const G4PrimaryParticle *particle = vertex->GetPrimary(j);
+        timer->current.primaries.push_back({particle->GetG4code() != nullptr ? particle->GetG4code()->GetParticleName() : G4String("unknown"), particle->GetPDGcode(),
+                                            vertex->GetPosition(), vertex->GetT0(), particle->GetKineticEnergy(), particle->GetMomentumDirection(),
+                                            particle->GetPolarization(), particle->GetCharge(), particle->GetWeight()});
+      }
+    }
+  }
+
+  // Start the clock last, so that the capture is not part of the duration
+  timer->start_time = std::chrono::steady_clock::now();
+}
+
+void EventTimer::EndOfEvent(const G4Event *event) {
+  if (timer == nullptr || (!histogram && slow_threshold <= 0.)) {
+    return;
+  }
+
+  const G4double seconds = std::chrono::duration<G4double>(std::chrono::steady_clock::now() - timer->start_time).count();
+  const unsigned int n = bin(seconds);
+  ++timer->n_events[n];
+  timer->seconds[n] += seconds;
+  timer->max_seconds = std::max(timer->max_seconds, seconds);
+
+  if (slow_threshold > 0. && seconds * second >= slow_threshold && !timer->current.engine_state.empty()) {
+    timer->current.run = G4RunManager::GetRunManager()->GetCurrentRun()->GetRunID();
+    timer->current.event = event->GetEventID();
+    timer->current.thread = G4Threading::G4GetThreadId();
+    timer->current.seconds = seconds;
+    keep_slowest(timer->slow_events, timer->current);
+  }
+}
+
+void EventTimer::MergeStatistics() {
+  if (timer == nullptr) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(statistics_mutex);
+  for (unsigned int i = 0; i < EVENT_TIMER_N_BINS; ++i) {
+    total_events[i] += timer->n_events[i];
+    total_seconds[i] += timer->seconds[i];
+  }
+  total_max_seconds = std::max(total_max_seconds, timer->max_seconds);
+  for (auto &slow_event : timer->slow_events) {
+    keep_slowest(total_slow_events, slow_event);
+  }
+
+  timer->n_events.assign(EVENT_TIMER_N_BINS, 0);
+  timer->seconds.assign(EVENT_TIMER_N_BINS, 0.);
+  timer->max_seconds = 0.;
+  timer->slow_events.clear();
+}
+
+void EventTimer::PrintStatistics() {
+  std::lock_guard<std::mutex> lock(statistics_mutex);
+
+  unsigned long sum_events = 0;
+  G4double sum_seconds = 0.;
+  for (unsigned int i = 0; i < EVENT_TIMER_N_BINS; ++i) {
+    sum_events += total_events[i];
+    sum_seconds += total_seconds[i];
+  }
+
+  if (histogram && sum_events > 0) {
+    G4cout << "================================================================================" << G4endl;
+    G4cout << "EventTimer: Wall time of " << sum_events << " events, " << std::fixed << std::setprecision(2) << sum_seconds << " s (summed over all threads), mean "
+           << std::scientific << sum_seconds / (G4double)sum_events << " s, max " << total_max_seconds << " s" << G4endl;
+
+    // Upper edges of the bins which contain the quantiles
+    const G4double quantiles[3] = {0.5, 0.99, 0.999};
+    unsigned long cumulative_events = 0;
+    unsigned int next_quantile = 0;
+    G4cout << "\tQuantiles (upper bin edge):";
+    for (unsigned int i = 0; i < EVENT_TIMER_N_BINS && next_quantile < 3; ++i) {
+      cumulative_events += total_events[i];
+      while (next_quantile < 3 && (G4double)cumulative_events >= quantiles[next_quantile] * (G4double)sum_events) {
+        G4cout << "  " << std::fixed << std::setprecision(1) << 100. * quantiles[next_quantile] << " % < " << std::scientific << std::setprecision(1) << bin_edge(i + 1) << " s";
+        ++next_quantile;
+      }
+    }
+    G4cout << G4endl;
+
+    G4cout << "\t" << std::setw(24) << "duration [s]" << std::setw(14) << "events" << std::setw(9) << "%" << std::setw(14) << "time [%]" << std::setw(16) << "cumulative [%]" << G4endl;
+    G4double cumulative_seconds = 0.;
+    for (unsigned int i = 0; i < EVENT_TIMER_N_BINS; ++i) {
+      if (total_events[i] == 0) {
+        continue;
+      }
+      cumulative_seconds += total_seconds[i];
+      std::stringstream range;
+      range << std::scientific << std::setprecision(1) << (i == 0 ? 0. : bin_edge(i)) << " - " << (i == EVENT_TIMER_N_BINS - 1 ? INFINITY : bin_edge(i + 1));
+      G4cout << "\t" << std::setw(24) << range.str() << std::fixed << std::setw(14) << total_events[i]
+             << std::setw(8) << std::setprecision(3) << 100. * (G4double)total_events[i] / (G4double)sum_events << "%"
+             << std::setw(13) << std::setprecision(1) << 100. * total_seconds[i] / sum_seconds << "%"
+             << std::setw(15) << 100. * cumulative_seconds / sum_seconds << "%" << G4endl;
+    }
+    G4cout << "================================================================================" << G4endl;
+  }
+
+  if (!total_slow_events.empty()) {
+    write_slow_events();
+  }
+
+  total_events.assign(EVENT_TIMER_N_BINS, 0);
+  total_seconds.assign(EVENT_TIMER_N_BINS, 0.);
+  total_max_seconds = 0.;
+  total_slow_events.clear();
+}
+
+void EventTimer::write_slow_events() {
+  std::sort(total_slow_events.begin(), total_slow_events.end(), [](const SlowEvent &a, const SlowEvent &b) { return a.seconds > b.seconds; });
+
+  const G4String filename = utrFilenameTools::getRunFilename() + "_slow_events.txt";
+  std::ofstream file(filename);
+  if (!file.is_open()) {
+    G4cerr << "ERROR: EventTimer: Could not write the slow events to '" << filename << "'! Aborting..." << G4endl;
+    throw std::exception();
+  }
+
+  file << "# utr slow events, threshold " << slow_threshold / second << " s" << std::endl;
+  file << "# event RUN EVENT THREAD SECONDS" << std::endl;
+  file << "# engine NAME SIZE STATE..." << std::endl;
+  file << "# primary PARTICLE PDG X Y Z [mm] T [ns] EKIN [MeV] DX DY DZ POLX POLY POLZ CHARGE [e+] WEIGHT" << std::endl;
+  file << std::setprecision(17);
+  for (auto &slow_event : total_slow_events) {
+    file << "event " << slow_event.run << " " << slow_event.event << " " << slow_event.thread << " " << slow_event.seconds << std::endl;
+    file << "engine " << slow_event.engine << " " << slow_event.engine_state.size();
+    for (auto value : slow_event.engine_state) {
+      file << " " << value;
+    }
+    file << std::endl;
+    for (auto &primary : slow_event.primaries) {
+      file << "primary " << primary.particle << " " << primary.encoding << " "
+           << primary.position.x() / mm << " " << primary.position.y() / mm << " " << primary.position.z() / mm << " " << primary.time / ns << " "
+           << primary.kinetic_energy / MeV << " " << primary.direction.x() << " " << primary.direction.y() << " " << primary.direction.z() << " "
+           << primary.polarization.x() << " " << primary.polarization.y() << " " << primary.polarization.z() << " " << primary.charge / eplus << " " << primary.weight << std::endl;
+    }
+    file << "end" << std::endl;
+  }
+
+  G4cout << "EventTimer: Wrote the " << total_slow_events.size() << " slowest events above " << slow_threshold / second << " s (slowest: event " << total_slow_events[0].event << ", "
+         << total_slow_events[0].seconds << " s) to '" << filename << "'. Replay them with '/utr/replayEvent " << filename << " EVENT'." << G4endl;
+}
+
+G4int EventTimer::LoadReplay(const G4String &filename, const G4String &event) {
+  std::ifstream file(filename);
+  if (!file.is_open()) {
+    G4cerr << "Error! EventTimer: Could not open '" << filename << "'!" << G4endl;
+    return 0;
+  }
+
+  vector<SlowEvent> slow_events;
+  std::string line;
+  while (std::getline(file, line)) {
+    std::istringstream tokens(line);
+    std::string keyword;
+    if (!(tokens >> keyword) || keyword[0] == '#') {
+      continue;
+    }
+    G4bool valid = true;
+    if (keyword == "event") {
+      slow_events.push_back(SlowEvent());
+      valid = (bool)(tokens >> slow_events.back().run >> slow_events.back().event >> slow_events.back().thread >> slow_events.back().seconds);
+    } else if (keyword == "engine" && !slow_events.empty()) {
+      size_t size = 0;
+      valid = (bool)(tokens >> slow_events.back().engine >> size);
+      slow_events.back().engine_state.resize(size);
+      for (auto &value : slow_events.back().engine_state) {
+        valid = valid && (tokens >> value);
+      }
+    } else if (keyword == "primary" && !slow_events.empty()) {
+      Primary primary;
+      G4double x, y, z, dx, dy, dz, pol_x, pol_y, pol_z;
+      valid = (bool)(tokens >> primary.particle >> primary.encoding >> x >> y >> z >> primary.time >> primary.kinetic_energy >> dx >> dy >> dz >> pol_x >> pol_y >> pol_z >> primary.charge >> primary.weight);
+      primary.position = G4ThreeVector(x * mm, y * mm, z * mm);
+      primary.time *= ns;
+      primary.kinetic_energy *= MeV;
+      primary.direction = G4ThreeVector(dx, dy, dz);
+      primary.polarization = G4ThreeVector(pol_x, pol_y, pol_z);
+      primary.charge *= eplus;
+      slow_events.back().primaries.push_back(primary);
+    } else if (keyword != "end") {
+      valid = false;
+    }
+    if (!valid) {
+      G4cerr << "Error! EventTimer: Invalid line in '" << filename << "': " << line << G4endl;
+      return 0;
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(replay_mutex);
+  G4int n_queued = 0;
+  for (auto &slow_event : slow_events) {
+    if (event == "all" || event == std::to_string(slow_event.event)) {
+      replay_queue.push_back(slow_event);
+      ++n_queued;
+    }
+  }
+  if (n_queued == 0) {
+    G4cerr << "Error! EventTimer: Event '" << event << "' not found in '" << filename << "'!" << G4endl;
+  }
+  return n_queued;
+}
+
+G4bool EventTimer::Replay(G4Event *event) {
+  if (!replaying) {
+    return false;
+  }
+
+  SlowEvent slow_event;
+  {
+    std::lock_guard<std::mutex> lock(replay_mutex);
+    if (replay_queue.empty()) {
+      return false;
+    }
+    slow_event = replay_queue.front();
+    replay_queue.pop_front();
+  }
+
+  CLHEP::HepRandomEngine *engine = G4Random::getTheEngine();
+  if (engine->name() != slow_event.engine) {
+    G4cerr << "ERROR: EventTimer: Event " << slow_event.event << " was captured with the random number engine '" << slow_event.engine << "', but the current engine is '" << engine->name() << "' (see /utr/random/engine)! Aborting..." << G4endl;
+    throw std::exception();
+  }
+
+  for (auto &primary : slow_event.primaries) {
+    G4ParticleDefinition *definition = G4ParticleTable::GetParticleTable()->FindParticle(primary.particle);
+    if (definition == nullptr && primary.encoding >= 1000000000) {
+      definition = G4IonTable::GetIonTable()->GetIon(primary.encoding);
+    }
+    if (definition == nullptr) {
+      G4cerr << "ERROR: EventTimer: Unknown primary particle '" << primary.particle << "' in event " << slow_event.event << "! Aborting..." << G4endl;
+      throw std::exception();
+    }
+    G4PrimaryVertex *vertex = new G4PrimaryVertex(primary.position, primary.time);
+    G4PrimaryParticle *particle = new G4PrimaryParticle(definition);
+    particle->SetKineticEnergy(primary.kinetic_energy);
+    particle->SetMomentumDirection(primary.direction);
+    particle->SetPolarization(primary.polarization.x(), primary.polarization.y(), primary.polarization.z());
+    particle->SetCharge(primary.charge);
+    particle->SetWeight(primary.weight);
+    vertex->SetPrimary(particle);
+    event->AddPrimaryVertex(vertex);
+  }
+
+  if (!engine->get(slow_event.engine_state)) {
+    G4cerr << "ERROR: EventTimer: Could not restore the state of the random number engine for event " << slow_event.event << "! Aborting..." << G4endl;
+    throw std::exception();
+  }
+
+  G4cout << "EventTimer: Replaying event " << slow_event.event << " of run " << slow_event.run << " (thread " << slow_event.thread << ", " << slow_event.seconds << " s) as event " << event->GetEventID() << G4endl;
+  return true;
+}
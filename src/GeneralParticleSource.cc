@@ -21,6 +21,8 @@ along with utr.  If not, see <http://www.gnu.org/licenses/>.
 #include "GeneralParticleSource.hh"
 #include "G4Event.hh"
 #include "G4GeneralParticleSource.hh"
+#include "EventTimer.hh"
+#include "utrRandom.hh"
 
 GeneralParticleSource::GeneralParticleSource()
     : G4VUserPrimaryGeneratorAction(), particleGun(0) {
@@ -30,5 +32,9 @@ GeneralParticleSource::GeneralParticleSource()
 GeneralParticleSource::~GeneralParticleSource() { delete particleGun; }
 
 void GeneralParticleSource::GeneratePrimaries(G4Event *anEvent) {
+  utrRandom::SeedEvent(anEvent);
+  if (EventTimer::Replay(anEvent)) {
+    return;
+  }
   particleGun->GeneratePrimaryVertex(anEvent);
 }
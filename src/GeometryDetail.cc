@@ -0,0 +1,50 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "GeometryDetail.hh"
+#include "utrConfig.h"
+
+#ifdef USE_G3_SETUP
+G4bool GeometryDetail::g3_setup = true;
+#else
+G4bool GeometryDetail::g3_setup = false;
+#endif
+#ifdef USE_SECOND_SETUP
+G4bool GeometryDetail::second_setup = true;
+#else
+G4bool GeometryDetail::second_setup = false;
+#endif
+G4bool GeometryDetail::setup_switches_supported = false;
+detail_level GeometryDetail::level = G4String(geometry_detail) == "homogenized" ? HOMOGENIZED_DETAIL : FULL_DETAIL;
+
+G4bool GeometryDetail::SetLevel(const G4String &level_name) {
+  if (level_name == "full") {
+    level = FULL_DETAIL;
+  } else if (level_name == "homogenized") {
+    level = HOMOGENIZED_DETAIL;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+G4String GeometryDetail::GetLevelName(detail_level lvl) {
+  return lvl == HOMOGENIZED_DETAIL ? "homogenized" : "full";
+}
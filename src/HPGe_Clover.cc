@@ -23,6 +23,7 @@ along with utr.  If not, see <http://www.gnu.org/licenses/>.
  * Eurysis manual for clover detectors.
  */
 
+#include <iomanip>
 #include <sstream>
 using std::stringstream;
 
@@ -36,6 +37,7 @@ using std::stringstream;
 #include "G4Tubs.hh"
 #include "G4VisAttributes.hh"
 
+#include "DetectorModelCache.hh"
 #include "HPGe_Clover.hh"
 
 void HPGe_Clover::Construct(G4ThreeVector global_coordinates, G4double theta, G4double phi, G4double dist_from_center, G4double intrinsic_rotation_angle) const {
@@ -49,12 +51,23 @@ void HPGe_Clover::Construct(G4ThreeVector global_coordinates, G4double theta, G4
   if (intrinsic_rotation_angle != 0.) {
     rotation->rotateZ(intrinsic_rotation_angle);
   }
+  const G4ThreeVector origin = global_coordinates + dist_from_center * symmetry_axis;
+
+  DetectorModel *model = nullptr;
+  if (use_model_cache) {
+    model = DetectorModelCache::Find(model_key());
+    if (model != nullptr) {
+      DetectorModelCache::Place(model, detector_name, rotation, origin, world_Logical);
+      return;
+    }
+    model = DetectorModelCache::Create(model_key());
+  }
 
   /******** Front end cap *********/
 
   G4VSolid *end_cap_front_solid = rounded_box("_end_cap_front_solid", properties.end_cap_front_side_length, properties.end_cap_front_length, properties.end_cap_front_rounding_radius, 20);
   G4LogicalVolume *end_cap_front_logical = new G4LogicalVolume(end_cap_front_solid, nist->FindOrBuildMaterial(properties.end_cap_material), detector_name + "_end_cap_front_logical");
-  new G4PVPlacement(rotation, global_coordinates + (dist_from_center + 0.5 * properties.end_cap_front_length) * symmetry_axis, end_cap_front_logical, detector_name + "_end_cap_front", world_Logical, 0, 0, false);
+  place(rotation, origin, model, end_cap_front_logical, detector_name + "_end_cap_front", G4ThreeVector(0., 0., 0.5 * properties.end_cap_front_length));
 
   /******** Vacuum around crystal ********/
 
@@ -107,7 +120,7 @@ void HPGe_Clover::Construct(G4ThreeVector global_coordinates, G4double theta, G4
 
   G4VSolid *end_cap_back_solid = rounded_box("_end_cap_back_solid", properties.end_cap_back_side_length, properties.end_cap_back_length, properties.end_cap_back_rounding_radius, 20);
   G4LogicalVolume *end_cap_back_logical = new G4LogicalVolume(end_cap_back_solid, nist->FindOrBuildMaterial(properties.end_cap_material), detector_name + "_end_cap_back_logical");
-  new G4PVPlacement(rotation, global_coordinates + (dist_from_center + properties.end_cap_front_length + 0.5 * properties.end_cap_back_length) * symmetry_axis, end_cap_back_logical, detector_name + "_end_cap_back", world_Logical, 0, 0, false);
+  place(rotation, origin, model, end_cap_back_logical, detector_name + "_end_cap_back", G4ThreeVector(0., 0., properties.end_cap_front_length + 0.5 * properties.end_cap_back_length));
 
   /******** Air inside the back end cap ********/
 
@@ -122,7 +135,7 @@ void HPGe_Clover::Construct(G4ThreeVector global_coordinates, G4double theta, G4
     G4Tubs *connection_solid = new G4Tubs(detector_name + "_dewar_connection_solid", 0., properties.connection_radius, properties.connection_length * 0.5, 0., twopi);
     G4LogicalVolume *connection_logical = new G4LogicalVolume(connection_solid, nist->FindOrBuildMaterial(properties.connection_material), detector_name + "_dewar_connection_logical");
     connection_logical->SetVisAttributes(new G4VisAttributes(G4Color::White()));
-    new G4PVPlacement(rotation, global_coordinates + (dist_from_center + properties.end_cap_front_length + properties.end_cap_back_length + properties.connection_length * 0.5) * symmetry_axis, connection_logical, detector_name + "_dewar_connection", world_Logical, 0, 0, false);
+    place(rotation, origin, model, connection_logical, detector_name + "_dewar_connection", G4ThreeVector(0., 0., properties.end_cap_front_length + properties.end_cap_back_length + properties.connection_length * 0.5));
 
     /************* Dewar *************/
 
@@ -130,7 +143,7 @@ void HPGe_Clover::Construct(G4ThreeVector global_coordinates, G4double theta, G4
     G4Tubs *dewar_solid = new G4Tubs(detector_name + "_dewar_solid", 0., properties.dewar_outer_radius, properties.dewar_length * 0.5, 0., twopi);
     G4LogicalVolume *dewar_logical = new G4LogicalVolume(dewar_solid, nist->FindOrBuildMaterial(properties.dewar_material), detector_name + "_dewar_logical");
     dewar_logical->SetVisAttributes(G4Color::Brown());
-    new G4PVPlacement(rotation, global_coordinates + (dist_from_center + properties.end_cap_front_length + properties.end_cap_back_length + properties.connection_length + properties.dewar_length * 0.5) * symmetry_axis, dewar_logical, detector_name + "_dewar", world_Logical, 0, 0, false);
+    place(rotation, origin, model, dewar_logical, detector_name + "_dewar", G4ThreeVector(0., 0., properties.end_cap_front_length + properties.end_cap_back_length + properties.connection_length + properties.dewar_length * 0.5));
 
     // Dewar interior
     G4Tubs *dewar_interior_solid = new G4Tubs(detector_name + "_dewar_interior_solid", 0., properties.dewar_outer_radius - properties.dewar_wall_thickness, properties.dewar_length * 0.5 - properties.dewar_wall_thickness, 0., twopi);
@@ -156,17 +169,40 @@ void HPGe_Clover::Construct(G4ThreeVector global_coordinates, G4double theta, G4
       } else {
         filter_logical->SetVisAttributes(G4Color::Green());
       }
-      new G4PVPlacement(rotation, global_coordinates + (dist_from_center - filter_position_z - filter_thicknesses[i] / 2.) * symmetry_axis, filter_logical, filter_base_name_ss.str(), world_Logical, 0, 0, false);
+      place(rotation, origin, model, filter_logical, filter_base_name_ss.str(), G4ThreeVector(0., 0., -filter_position_z - filter_thicknesses[i] / 2.));
       filter_position_z = filter_position_z + filter_thicknesses[i];
       filter_base_name_ss.str("");
     }
   }
+
+  if (model != nullptr) {
+    DetectorModelCache::AddSensitiveVolume(model, crystal1_logical, "_1");
+    DetectorModelCache::AddSensitiveVolume(model, crystal2_logical, "_2");
+    DetectorModelCache::AddSensitiveVolume(model, crystal3_logical, "_3");
+    DetectorModelCache::AddSensitiveVolume(model, crystal4_logical, "_4");
+    DetectorModelCache::Place(model, detector_name, rotation, origin, world_Logical);
+  }
 }
 
 void HPGe_Clover::Construct(G4ThreeVector global_coordinates, G4double theta, G4double phi, G4double dist_from_center) const {
   Construct(global_coordinates, theta, phi, dist_from_center, 0.);
 }
 
+G4String HPGe_Clover::model_key() const {
+  stringstream key;
+  key << std::setprecision(17) << "HPGe_Clover"
+      << " " << properties.crystal_radius << " " << properties.crystal_length << " " << properties.crystal_face_radius << " " << properties.crystal_gap
+      << " " << properties.end_cap_to_crystal_gap_front << " " << properties.vacuum_length
+      << " " << properties.end_cap_front_side_length << " " << properties.end_cap_front_rounding_radius << " " << properties.end_cap_front_length
+      << " " << properties.end_cap_front_thickness << " " << properties.end_cap_window_thickness
+      << " " << properties.end_cap_back_side_length << " " << properties.end_cap_back_rounding_radius << " " << properties.end_cap_back_length
+      << " " << properties.end_cap_back_thickness << " " << properties.end_cap_material
+      << " " << properties.connection_length << " " << properties.connection_radius << " " << properties.connection_material
+      << " " << properties.dewar_length << " " << properties.dewar_outer_radius << " " << properties.dewar_wall_thickness << " " << properties.dewar_material
+      << " dewar " << use_dewar << filter_and_wrap_key(0.);
+  return key.str();
+}
+
 G4VSolid *HPGe_Clover::rounded_box(const G4String name, const G4double side_length, const G4double length, const G4double rounding_radius, const G4int n_points_per_corner) const {
 
   G4double inverse_n_points_per_corner = 1. / (n_points_per_corner - 1.);
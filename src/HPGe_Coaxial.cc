@@ -18,6 +18,9 @@ You should have received a copy of the GNU General Public License
 along with utr.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
+#include <iomanip>
+#include <numeric>
 #include <sstream>
 
 #include "G4Color.hh"
@@ -28,12 +31,27 @@ along with utr.  If not, see <http://www.gnu.org/licenses/>.
 #include "G4Tubs.hh"
 #include "G4VisAttributes.hh"
 
+#include "DetectorModelCache.hh"
 #include "Filter_Case.hh"
 #include "HPGe_Coaxial.hh"
-#include "OptimizePolycone.hh"
+#include "PolyconeProfile.hh"
 
 using std::stringstream;
 
+// Breakpoints of a profile from z_max down to 0, which is the direction in which the planes of
+// the polycones are ordered. Points outside of this range are ignored.
+static vector<G4double> descending_breakpoints(G4double z_max, vector<G4double> points) {
+  vector<G4double> breakpoints{z_max};
+  std::sort(points.begin(), points.end(), std::greater<G4double>());
+  for (auto z : points) {
+    if (z > 0. && z < breakpoints.back()) {
+      breakpoints.push_back(z);
+    }
+  }
+  breakpoints.push_back(0.);
+  return breakpoints;
+}
+
 void HPGe_Coaxial::Construct(G4ThreeVector global_coordinates, G4double theta, G4double phi, G4double dist_from_center, G4double intrinsic_rotation_angle) const {
 
   G4NistManager *nist = G4NistManager::Instance();
@@ -46,6 +64,29 @@ void HPGe_Coaxial::Construct(G4ThreeVector global_coordinates, G4double theta, G
   if (intrinsic_rotation_angle != 0.) {
     rotation->rotateZ(intrinsic_rotation_angle);
   }
+  const G4ThreeVector origin = global_coordinates + dist_from_center * symmetry_axis;
+
+  // Filter case
+  // Constructed for each detector, since it is not a part of the shared model
+  G4double filter_position_z = 0.; // Will be gradually increased to be able to place filters on top of each other
+  Filter_Case filter_case(world_Logical, detector_name);
+  if (use_filter_case_ring) {
+    filter_case.Construct_Ring(global_coordinates, theta, phi, dist_from_center - filter_case.get_filter_case_ring_thickness() / 2.);
+    filter_position_z = filter_position_z + filter_case.get_filter_case_ring_thickness();
+  }
+  if (use_filter_case) {
+    filter_case.Construct_Case(global_coordinates, theta, phi, dist_from_center - filter_case.get_filter_case_bottom_thickness() / 2. - filter_position_z - std::accumulate(filter_thicknesses.begin(), filter_thicknesses.end(), 0.));
+  }
+
+  DetectorModel *model = nullptr;
+  if (use_model_cache) {
+    model = DetectorModelCache::Find(model_key(filter_position_z));
+    if (model != nullptr) {
+      DetectorModelCache::Place(model, detector_name, rotation, origin, world_Logical);
+      return;
+    }
+    model = DetectorModelCache::Create(model_key(filter_position_z));
+  }
 
   /************* End cap *************/
   // End cap side
@@ -56,19 +97,19 @@ void HPGe_Coaxial::Construct(G4ThreeVector global_coordinates, G4double theta, G
   G4Tubs *end_cap_side_solid = new G4Tubs(detector_name + "_end_cap_side_solid", end_cap_inner_radius, end_cap_outer_radius, end_cap_side_length * 0.5, 0., twopi);
   G4LogicalVolume *end_cap_side_logical = new G4LogicalVolume(end_cap_side_solid, nist->FindOrBuildMaterial(properties.end_cap_material), detector_name + "_end_cap_side_logical");
   end_cap_side_logical->SetVisAttributes(new G4VisAttributes(G4Color::White()));
-  new G4PVPlacement(rotation, global_coordinates + (dist_from_center + properties.end_cap_window_thickness + end_cap_side_length * 0.5) * symmetry_axis, end_cap_side_logical, detector_name + "_end_cap_side", world_Logical, 0, 0, false);
+  place(rotation, origin, model, end_cap_side_logical, detector_name + "_end_cap_side", G4ThreeVector(0., 0., properties.end_cap_window_thickness + end_cap_side_length * 0.5));
 
   // End cap window
   G4Tubs *end_cap_window_solid = new G4Tubs(detector_name + "_end_cap_window_solid", 0., end_cap_outer_radius, properties.end_cap_window_thickness * 0.5, 0., twopi);
   G4LogicalVolume *end_cap_window_logical = new G4LogicalVolume(end_cap_window_solid, nist->FindOrBuildMaterial(properties.end_cap_window_material), detector_name + "_end_cap_window_logical");
   end_cap_window_logical->SetVisAttributes(new G4VisAttributes(G4Color::White()));
-  new G4PVPlacement(rotation, global_coordinates + (dist_from_center + properties.end_cap_window_thickness * 0.5) * symmetry_axis, end_cap_window_logical, detector_name + "_end_cap_window", world_Logical, 0, 0, false);
+  place(rotation, origin, model, end_cap_window_logical, detector_name + "_end_cap_window", G4ThreeVector(0., 0., properties.end_cap_window_thickness * 0.5));
 
   // Vacuum inside end cap
   G4Tubs *end_cap_vacuum_solid = new G4Tubs(detector_name + "_end_cap_vacuum_solid", 0., end_cap_inner_radius, end_cap_side_length * 0.5, 0., twopi);
   G4LogicalVolume *end_cap_vacuum_logical = new G4LogicalVolume(end_cap_vacuum_solid, nist->FindOrBuildMaterial("G4_Galactic"), detector_name + "_end_cap_vacuum_logical");
   end_cap_vacuum_logical->SetVisAttributes(G4VisAttributes::GetInvisible());
-  new G4PVPlacement(rotation, global_coordinates + (dist_from_center + properties.end_cap_window_thickness + end_cap_side_length * 0.5) * symmetry_axis, end_cap_vacuum_logical, detector_name + "_end_cap_vacuum", world_Logical, 0, 0, false);
+  place(rotation, origin, model, end_cap_vacuum_logical, detector_name + "_end_cap_vacuum", G4ThreeVector(0., 0., properties.end_cap_window_thickness + end_cap_side_length * 0.5));
 
   /************* Mount cup *************/
   // Mount cup side
@@ -97,38 +138,10 @@ void HPGe_Coaxial::Construct(G4ThreeVector global_coordinates, G4double theta, G
 
   G4double cold_finger_length = properties.cold_finger_penetration_depth + mount_cup_side_length + properties.mount_cup_base_thickness - properties.detector_length;
 
-  const G4int nsteps = 500;
-
-  G4double zPlaneTemp[nsteps];
-  G4double rInnerTemp[nsteps];
-  G4double rOuterTemp[nsteps];
-
-  G4double z;
-
-  for (int i = 0; i < nsteps; i++) {
-    z = (1. - (double)i / (nsteps - 1)) * cold_finger_length;
-
-    zPlaneTemp[i] = z;
+  PolyconeProfile cold_finger_profile = ColdFingerProfile(properties, cold_finger_length, max_profile_deviation);
+  G4cout << "Polycone " << detector_name << "_cold_finger_solid: " << cold_finger_profile.GetNPlanes() << " z-planes, maximum deviation " << cold_finger_profile.GetMaxDeviation() / um << " um" << G4endl;
 
-    rInnerTemp[i] = 0. * mm;
-
-    if (z >= properties.cold_finger_radius) {
-      rOuterTemp[i] = properties.cold_finger_radius;
-    } else if (z >= 0.) {
-      rOuterTemp[i] = properties.cold_finger_radius * sqrt(1. - pow((z - properties.cold_finger_radius) / properties.cold_finger_radius, 2));
-    } else {
-      rOuterTemp[i] = 0. * mm;
-    }
-  }
-
-  G4double zPlane[nsteps];
-  G4double rInner[nsteps];
-  G4double rOuter[nsteps];
-
-  OptimizePolycone *opt = new OptimizePolycone();
-  G4int nsteps_optimized = opt->Optimize(zPlaneTemp, rInnerTemp, rOuterTemp, zPlane, rInner, rOuter, nsteps, detector_name + "_cold_finger_solid");
-
-  G4Polycone *cold_finger_solid = new G4Polycone(detector_name + "_cold_finger_solid", 0. * deg, 360. * deg, nsteps_optimized, zPlane, rInner, rOuter);
+  G4Polycone *cold_finger_solid = new G4Polycone(detector_name + "_cold_finger_solid", 0. * deg, 360. * deg, cold_finger_profile.GetNPlanes(), cold_finger_profile.GetZPlanes(), cold_finger_profile.GetRInner(), cold_finger_profile.GetROuter());
 
   G4LogicalVolume *cold_finger_logical = new G4LogicalVolume(cold_finger_solid, nist->FindOrBuildMaterial(properties.cold_finger_material), detector_name + "_cold_finger_logical", 0, 0, 0);
 
@@ -138,34 +151,10 @@ void HPGe_Coaxial::Construct(G4ThreeVector global_coordinates, G4double theta, G
 
   /************* Detector crystal *************/
 
-  for (int i = 0; i < nsteps; i++) {
-    z = (1. - (double)i / (nsteps - 1)) * properties.detector_length;
-
-    zPlaneTemp[i] = z;
+  PolyconeProfile crystal_profile = CrystalProfile(properties, max_profile_deviation);
+  G4cout << "Polycone " << detector_name << "_crystal_solid: " << crystal_profile.GetNPlanes() << " z-planes, maximum deviation " << crystal_profile.GetMaxDeviation() / um << " um" << G4endl;
 
-    // rInnerTemp[i] = 0. * mm;
-    if (z >= properties.detector_length - properties.hole_depth) {
-      if (z >= properties.detector_length - properties.hole_depth + properties.hole_radius) {
-        rInnerTemp[i] = properties.hole_radius;
-      } else {
-        rInnerTemp[i] = properties.hole_radius * sqrt(1. - pow((z - (properties.detector_length - properties.hole_depth + properties.hole_radius)) / properties.hole_radius, 2));
-      }
-    } else {
-      rInnerTemp[i] = 0.;
-    }
-
-    if (z >= properties.detector_face_radius) {
-      rOuterTemp[i] = properties.detector_radius;
-    } else if (z >= 0.) {
-      rOuterTemp[i] = properties.detector_face_radius * sqrt(1. - pow((z - properties.detector_face_radius) / properties.detector_face_radius, 2)) + (properties.detector_radius - properties.detector_face_radius);
-    } else {
-      rOuterTemp[i] = 0. * mm;
-    }
-  }
-
-  nsteps_optimized = opt->Optimize(zPlaneTemp, rInnerTemp, rOuterTemp, zPlane, rInner, rOuter, nsteps, detector_name + "_crystal_solid");
-
-  G4Polycone *crystal_solid = new G4Polycone("crystal_solid", 0. * deg, 360. * deg, nsteps_optimized, zPlane, rInner, rOuter);
+  G4Polycone *crystal_solid = new G4Polycone("crystal_solid", 0. * deg, 360. * deg, crystal_profile.GetNPlanes(), crystal_profile.GetZPlanes(), crystal_profile.GetRInner(), crystal_profile.GetROuter());
   G4LogicalVolume *crystal_logical = new G4LogicalVolume(crystal_solid, nist->FindOrBuildMaterial("G4_Ge"), detector_name, 0, 0, 0);
   crystal_logical->SetVisAttributes(new G4VisAttributes(G4Color::Green()));
   new G4PVPlacement(0, G4ThreeVector(0., 0., -end_cap_side_length * 0.5 + properties.end_cap_to_crystal_gap_front + properties.mount_cup_thickness), crystal_logical, detector_name + "_crystal", end_cap_vacuum_logical, 0, 0, false);
@@ -175,7 +164,7 @@ void HPGe_Coaxial::Construct(G4ThreeVector global_coordinates, G4double theta, G
     G4Tubs *connection_solid = new G4Tubs(detector_name + "_dewar_connection_solid", 0., properties.connection_radius, properties.connection_length * 0.5, 0., twopi);
     G4LogicalVolume *connection_logical = new G4LogicalVolume(connection_solid, nist->FindOrBuildMaterial(properties.connection_material), detector_name + "_dewar_connection_logical");
     connection_logical->SetVisAttributes(new G4VisAttributes(G4Color::White()));
-    new G4PVPlacement(rotation, global_coordinates + (dist_from_center + properties.end_cap_window_thickness + end_cap_side_length + properties.connection_length * 0.5) * symmetry_axis, connection_logical, detector_name + "_dewar_connection", world_Logical, 0, 0, false);
+    place(rotation, origin, model, connection_logical, detector_name + "_dewar_connection", G4ThreeVector(0., 0., properties.end_cap_window_thickness + end_cap_side_length + properties.connection_length * 0.5));
 
     if (intrinsic_rotation_angle != 0.)
       symmetry_axis_orthogonal.rotate(intrinsic_rotation_angle, symmetry_axis);
@@ -185,7 +174,7 @@ void HPGe_Coaxial::Construct(G4ThreeVector global_coordinates, G4double theta, G
     G4Tubs *dewar_solid = new G4Tubs(detector_name + "_dewar_solid", 0., properties.dewar_outer_radius, properties.dewar_length * 0.5, 0., twopi);
     G4LogicalVolume *dewar_logical = new G4LogicalVolume(dewar_solid, nist->FindOrBuildMaterial(properties.dewar_material), detector_name + "_dewar_logical");
     dewar_logical->SetVisAttributes(G4Color::Brown());
-    new G4PVPlacement(rotation, global_coordinates + (dist_from_center + properties.end_cap_window_thickness + end_cap_side_length + properties.connection_length + properties.dewar_length * 0.5) * symmetry_axis, dewar_logical, detector_name + "_dewar", world_Logical, 0, 0, false);
+    place(rotation, origin, model, dewar_logical, detector_name + "_dewar", G4ThreeVector(0., 0., properties.end_cap_window_thickness + end_cap_side_length + properties.connection_length + properties.dewar_length * 0.5));
 
     // Dewar interior
     G4Tubs *dewar_interior_solid = new G4Tubs(detector_name + "_dewar_interior_solid", 0., properties.dewar_outer_radius - properties.dewar_wall_thickness, properties.dewar_length * 0.5 - properties.dewar_wall_thickness, 0., twopi);
@@ -195,15 +184,6 @@ void HPGe_Coaxial::Construct(G4ThreeVector global_coordinates, G4double theta, G
   }
 
   // Filters
-  G4double filter_position_z = 0.; // Will be gradually increased to be able to place filters on top of each other
-
-  // Filter case
-  Filter_Case filter_case(world_Logical, detector_name);
-  if (use_filter_case_ring) {
-    filter_case.Construct_Ring(global_coordinates, theta, phi, dist_from_center - filter_case.get_filter_case_ring_thickness() / 2.);
-    filter_position_z = filter_position_z + filter_case.get_filter_case_ring_thickness();
-  }
-
   if (filter_materials.size()) {
     G4Tubs *filter_solid = nullptr;
     G4LogicalVolume *filter_logical = nullptr;
@@ -219,16 +199,12 @@ void HPGe_Coaxial::Construct(G4ThreeVector global_coordinates, G4double theta, G
       } else {
         filter_logical->SetVisAttributes(G4Color::Green());
       }
-      new G4PVPlacement(rotation, global_coordinates + (dist_from_center - filter_position_z - filter_thicknesses[i] / 2.) * symmetry_axis, filter_logical, filter_base_name_ss.str(), world_Logical, 0, 0, false);
+      place(rotation, origin, model, filter_logical, filter_base_name_ss.str(), G4ThreeVector(0., 0., -filter_position_z - filter_thicknesses[i] / 2.));
       filter_position_z = filter_position_z + filter_thicknesses[i];
       filter_base_name_ss.str("");
     }
   }
 
-  if (use_filter_case) {
-    filter_case.Construct_Case(global_coordinates, theta, phi, dist_from_center - filter_case.get_filter_case_bottom_thickness() / 2. - filter_position_z);
-  }
-
   // Wraps
   if (wrap_materials.size()) {
     G4Tubs *wrap_solid = nullptr;
@@ -244,14 +220,80 @@ void HPGe_Coaxial::Construct(G4ThreeVector global_coordinates, G4double theta, G
       } else {
         wrap_logical->SetVisAttributes(G4Color::Red());
       }
-      new G4PVPlacement(rotation, global_coordinates + (dist_from_center + properties.end_cap_length / 2.) * symmetry_axis, wrap_logical, wrap_base_name_ss.str(), world_Logical, 0, 0, false);
+      place(rotation, origin, model, wrap_logical, wrap_base_name_ss.str(), G4ThreeVector(0., 0., properties.end_cap_length / 2.));
       wrap_radius = wrap_radius + wrap_thicknesses[i];
       wrap_base_name_ss.str("");
     }
   }
+
+  if (model != nullptr) {
+    DetectorModelCache::AddSensitiveVolume(model, crystal_logical, "");
+    DetectorModelCache::Place(model, detector_name, rotation, origin, world_Logical);
+  }
 }
 
 void HPGe_Coaxial::Construct(G4ThreeVector global_coordinates, G4double theta, G4double phi,
                              G4double dist_from_center) const {
   Construct(global_coordinates, theta, phi, dist_from_center, 0.);
 }
+
+G4String HPGe_Coaxial::model_key(G4double filter_position_z) const {
+  stringstream key;
+  key << std::setprecision(17) << "HPGe_Coaxial"
+      << " " << properties.detector_radius << " " << properties.detector_length << " " << properties.detector_face_radius
+      << " " << properties.hole_radius << " " << properties.hole_depth << " " << properties.hole_face_radius
+      << " " << properties.mount_cup_length << " " << properties.mount_cup_thickness << " " << properties.mount_cup_base_thickness << " " << properties.mount_cup_material
+      << " " << properties.end_cap_to_crystal_gap_front << " " << properties.end_cap_to_crystal_gap_side << " " << properties.end_cap_thickness << " " << properties.end_cap_length
+      << " " << properties.end_cap_outer_radius << " " << properties.end_cap_window_thickness << " " << properties.end_cap_material << " " << properties.end_cap_window_material
+      << " " << properties.cold_finger_radius << " " << properties.cold_finger_penetration_depth << " " << properties.cold_finger_material
+      << " " << properties.connection_length << " " << properties.connection_radius << " " << properties.dewar_offset << " " << properties.connection_material
+      << " " << properties.dewar_length << " " << properties.dewar_outer_radius << " " << properties.dewar_wall_thickness << " " << properties.dewar_material
+      << " dewar " << use_dewar << " profile " << max_profile_deviation << filter_and_wrap_key(filter_position_z);
+  return key.str();
+}
+
+PolyconeProfile HPGe_Coaxial::CrystalProfile(const HPGe_Coaxial_Properties &properties, G4double max_deviation) {
+  const G4double radius = properties.detector_radius;
+  const G4double face_radius = properties.detector_face_radius;
+  const G4double hole_radius = properties.hole_radius;
+  const G4double hole_start = properties.detector_length - properties.hole_depth; // Position of the tip of the hole
+
+  PolyconeProfile profile(
+      [=](double z) {
+        if (z >= hole_start + hole_radius) {
+          return hole_radius;
+        } else if (z >= hole_start) {
+          return hole_radius * sqrt(std::max(1. - pow((z - (hole_start + hole_radius)) / hole_radius, 2), 0.));
+        }
+        return 0.;
+      },
+      [=](double z) {
+        if (z >= face_radius) {
+          return radius;
+        } else if (z >= 0.) {
+          return face_radius * sqrt(std::max(1. - pow((z - face_radius) / face_radius, 2), 0.)) + (radius - face_radius);
+        }
+        return 0.;
+      });
+  profile.Build(descending_breakpoints(properties.detector_length, {hole_start, hole_start + hole_radius, face_radius}), max_deviation);
+
+  return profile;
+}
+
+PolyconeProfile HPGe_Coaxial::ColdFingerProfile(const HPGe_Coaxial_Properties &properties, G4double cold_finger_length, G4double max_deviation) {
+  const G4double radius = properties.cold_finger_radius;
+
+  PolyconeProfile profile(
+      [](double) { return 0.; },
+      [=](double z) {
+        if (z >= radius) {
+          return radius;
+        } else if (z >= 0.) {
+          return radius * sqrt(std::max(1. - pow((z - radius) / radius, 2), 0.));
+        }
+        return 0.;
+      });
+  profile.Build(descending_breakpoints(cold_finger_length, {radius}), max_deviation);
+
+  return profile;
+}
@@ -22,6 +22,8 @@ along with utr.  If not, see <http://www.gnu.org/licenses/>.
 //	LaBr Crystal (Saint Gobain BrilLanCe 380) 3x3" (TUD)
 //**************************************************************//
 
+#include <iomanip>
+#include <numeric>
 #include <sstream>
 
 #include "G4Color.hh"
@@ -32,6 +34,7 @@ along with utr.  If not, see <http://www.gnu.org/licenses/>.
 #include "G4Tubs.hh"
 #include "G4VisAttributes.hh"
 
+#include "DetectorModelCache.hh"
 #include "Filter_Case.hh"
 #include "LaBr_3x3.hh"
 #include "Units.hh"
@@ -47,6 +50,29 @@ void LaBr_3x3::Construct(G4ThreeVector global_coordinates, G4double theta, G4dou
   auto *rotation = new G4RotationMatrix();
   rotation->rotateZ(-phi);
   rotation->rotateY(-theta);
+  const G4ThreeVector origin = global_coordinates + dist_from_center * symmetry_axis;
+
+  // Filter case
+  // Constructed for each detector, since it is not a part of the shared model
+  G4double filter_position_z = 0.; // Will be gradually increased to be able to place filters on top of each other
+  Filter_Case filter_case(world_Logical, detector_name);
+  if (use_filter_case_ring) {
+    filter_case.Construct_Ring(global_coordinates, theta, phi, dist_from_center - filter_case.get_filter_case_ring_thickness() / 2.);
+    filter_position_z = filter_position_z + filter_case.get_filter_case_ring_thickness();
+  }
+  if (use_filter_case) {
+    filter_case.Construct_Case(global_coordinates, theta, phi, dist_from_center - filter_case.get_filter_case_bottom_thickness() / 2. - filter_position_z - std::accumulate(filter_thicknesses.begin(), filter_thicknesses.end(), 0.));
+  }
+
+  DetectorModel *model = nullptr;
+  if (use_model_cache) {
+    model = DetectorModelCache::Find(model_key(filter_position_z));
+    if (model != nullptr) {
+      DetectorModelCache::Place(model, detector_name, rotation, origin, world_Logical);
+      return;
+    }
+    model = DetectorModelCache::Create(model_key(filter_position_z));
+  }
 
   // Dimensions from
   // 1) A previous implementation by B. Loeher and J. Isaak (BI) (crystal, vacuum and crystal housing)
@@ -90,7 +116,7 @@ void LaBr_3x3::Construct(G4ThreeVector global_coordinates, G4double theta, G4dou
   auto *crystal_housing_solid = new G4Tubs(detector_name + "_crystal_housing_solid", 0., crystal_housing_outer_radius, crystal_housing_length / 2., 0., twopi);
   auto *crystal_housing_logical = new G4LogicalVolume(crystal_housing_solid, nist->FindOrBuildMaterial("G4_Al"), detector_name + "_crystal_housing_logical");
   crystal_housing_logical->SetVisAttributes(G4Color::Grey());
-  new G4PVPlacement(rotation, global_coordinates + (dist_from_center + crystal_housing_length / 2.) * symmetry_axis, crystal_housing_logical, detector_name + "_crystal_housing", world_Logical, 0, 0, false);
+  place(rotation, origin, model, crystal_housing_logical, detector_name + "_crystal_housing", G4ThreeVector(0., 0., crystal_housing_length / 2.));
 
   /************** Vacuum around crystal *************/
 
@@ -118,21 +144,21 @@ void LaBr_3x3::Construct(G4ThreeVector global_coordinates, G4double theta, G4dou
     auto *circuit_housing_1_solid = new G4Tubs(detector_name + "_circuit_housing_1_solid", crystal_housing_outer_radius - crystal_housing_thickness, circuit_housing_1_radius, circuit_housing_1_length / 2., 0., twopi);
     auto *circuit_housing_1_logical = new G4LogicalVolume(circuit_housing_1_solid, nist->FindOrBuildMaterial("G4_Al"), detector_name + "_circuit_housing_1_logical");
     circuit_housing_1_logical->SetVisAttributes(G4Color::Grey());
-    new G4PVPlacement(rotation, global_coordinates + (dist_from_center + crystal_housing_length + circuit_housing_1_length / 2.) * symmetry_axis, circuit_housing_1_logical, detector_name + "_circuit_housing_1", world_Logical, 0, 0, false);
+    place(rotation, origin, model, circuit_housing_1_logical, detector_name + "_circuit_housing_1", G4ThreeVector(0., 0., crystal_housing_length + circuit_housing_1_length / 2.));
 
     /************** Circuit housing 2 *************/
 
     G4Cons *circuit_housing_2_solid = new G4Cons("circuit_housing_2_solid", circuit_housing_2_rmax - circuit_housing_thickness, circuit_housing_2_rmax, circuit_housing_2_rmin - circuit_housing_thickness, circuit_housing_2_rmin, circuit_housing_2_length / 2., 0., twopi);
     auto *circuit_housing_2_logical = new G4LogicalVolume(circuit_housing_2_solid, nist->FindOrBuildMaterial("G4_Al"), detector_name + "_circuit_housing_2_logical");
     circuit_housing_2_logical->SetVisAttributes(G4Color::Grey());
-    new G4PVPlacement(rotation, global_coordinates + (dist_from_center + crystal_housing_length + circuit_housing_1_length + circuit_housing_2_length / 2.) * symmetry_axis, circuit_housing_2_logical, detector_name + "_circuit_housing_2", world_Logical, 0, 0, false);
+    place(rotation, origin, model, circuit_housing_2_logical, detector_name + "_circuit_housing_2", G4ThreeVector(0., 0., crystal_housing_length + circuit_housing_1_length + circuit_housing_2_length / 2.));
 
     /************** Circuit housing 3 with PMT *************/
 
     auto *circuit_housing_3_and_pmt_solid = new G4Tubs(detector_name + "_circuit_housing_3_and_pmt_solid", 0., circuit_housing_3_and_pmt_radius, circuit_housing_3_and_pmt_length / 2., 0., twopi);
     auto *circuit_housing_3_and_pmt_logical = new G4LogicalVolume(circuit_housing_3_and_pmt_solid, nist->FindOrBuildMaterial("G4_Al"), detector_name + "_circuit_housing_3_and_pmt_logical");
     circuit_housing_3_and_pmt_logical->SetVisAttributes(G4Color::Grey());
-    new G4PVPlacement(rotation, global_coordinates + (dist_from_center + crystal_housing_length + circuit_housing_1_length + circuit_housing_2_length + circuit_housing_3_and_pmt_length / 2.) * symmetry_axis, circuit_housing_3_and_pmt_logical, detector_name + "_circuit_housing_3_and_pmt", world_Logical, 0, 0, false);
+    place(rotation, origin, model, circuit_housing_3_and_pmt_logical, detector_name + "_circuit_housing_3_and_pmt", G4ThreeVector(0., 0., crystal_housing_length + circuit_housing_1_length + circuit_housing_2_length + circuit_housing_3_and_pmt_length / 2.));
 
     auto *circuit_housing_3_and_pmt_interior_solid = new G4Tubs(detector_name + "_circuit_housing_3_and_pmt_interior_solid", 0., circuit_housing_3_and_pmt_radius - circuit_housing_thickness, (circuit_housing_3_and_pmt_length - circuit_housing_thickness) / 2., 0., twopi);
     auto *circuit_housing_3_and_pmt_interior_logical = new G4LogicalVolume(circuit_housing_3_and_pmt_interior_solid, nist->FindOrBuildMaterial("G4_AIR"), detector_name + "_circuit_housing_3_and_pmt_interior_logical");
@@ -141,15 +167,6 @@ void LaBr_3x3::Construct(G4ThreeVector global_coordinates, G4double theta, G4dou
   }
 
   // Filters
-  G4double filter_position_z = 0.; // Will be gradually increased to be able to place filters on top of each other
-
-  // Filter case
-  Filter_Case filter_case(world_Logical, detector_name);
-  if (use_filter_case_ring) {
-    filter_case.Construct_Ring(global_coordinates, theta, phi, dist_from_center - filter_case.get_filter_case_ring_thickness() / 2.);
-    filter_position_z = filter_position_z + filter_case.get_filter_case_ring_thickness();
-  }
-
   if (filter_materials.size()) {
     G4Tubs *filter_solid = nullptr;
     G4LogicalVolume *filter_logical = nullptr;
@@ -165,16 +182,12 @@ void LaBr_3x3::Construct(G4ThreeVector global_coordinates, G4double theta, G4dou
       } else {
         filter_logical->SetVisAttributes(G4Color::Green());
       }
-      new G4PVPlacement(rotation, global_coordinates + (dist_from_center - filter_position_z - filter_thicknesses[i] / 2.) * symmetry_axis, filter_logical, filter_base_name_ss.str(), world_Logical, 0, 0, false);
+      place(rotation, origin, model, filter_logical, filter_base_name_ss.str(), G4ThreeVector(0., 0., -filter_position_z - filter_thicknesses[i] / 2.));
       filter_position_z = filter_position_z + filter_thicknesses[i];
       filter_base_name_ss.str("");
     }
   }
 
-  if (use_filter_case) {
-    filter_case.Construct_Case(global_coordinates, theta, phi, dist_from_center - filter_case.get_filter_case_bottom_thickness() / 2. - filter_position_z);
-  }
-
   // Wraps
   if (wrap_materials.size()) {
     G4Tubs *wrap_solid = nullptr;
@@ -190,14 +203,25 @@ void LaBr_3x3::Construct(G4ThreeVector global_coordinates, G4double theta, G4dou
       } else {
         wrap_logical->SetVisAttributes(G4Color::Red());
       }
-      new G4PVPlacement(rotation, global_coordinates + (dist_from_center + crystal_housing_length / 2.) * symmetry_axis, wrap_logical, wrap_base_name_ss.str(), world_Logical, 0, 0, false);
+      place(rotation, origin, model, wrap_logical, wrap_base_name_ss.str(), G4ThreeVector(0., 0., crystal_housing_length / 2.));
       wrap_radius = wrap_radius + wrap_thicknesses[i];
       wrap_base_name_ss.str("");
     }
   }
+
+  if (model != nullptr) {
+    DetectorModelCache::AddSensitiveVolume(model, crystal_logical, "");
+    DetectorModelCache::Place(model, detector_name, rotation, origin, world_Logical);
+  }
 }
 
 void LaBr_3x3::Construct(G4ThreeVector global_coordinates, G4double theta, G4double phi, G4double dist_from_center, G4double intrinsic_rotation_angle) const {
   G4cout << "Warning: Parameter 'intrinsic_rotation_angle=" << intrinsic_rotation_angle << "' given to completely symmetric LaBr_3x3 class was ignored" << G4endl;
   Construct(global_coordinates, theta, phi, dist_from_center);
 }
+
+G4String LaBr_3x3::model_key(G4double filter_position_z) const {
+  stringstream key;
+  key << std::setprecision(17) << "LaBr_3x3 housing " << use_housing << filter_and_wrap_key(filter_position_z);
+  return key.str();
+}
@@ -0,0 +1,116 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include "G4LogicalVolume.hh"
+#include "G4Navigator.hh"
+#include "G4SystemOfUnits.hh"
+#include "G4ThreeVector.hh"
+#include "G4TransportationManager.hh"
+#include "G4VPhysicalVolume.hh"
+#include "G4VSolid.hh"
+
+#include "NavigationBenchmark.hh"
+
+using std::vector;
+
+// Limit for the number of steps of a single geantino, in case it gets stuck
+#define MAX_STEPS_PER_TRACK 100000
+
+void NavigationBenchmark::Run(unsigned int n_points) {
+  G4VPhysicalVolume *world = G4TransportationManager::GetTransportationManager()->GetNavigatorForTracking()->GetWorldVolume();
+  if (world == nullptr) {
+    G4cerr << "ERROR: NavigationBenchmark::Run(): The geometry has not been initialized yet!" << G4endl;
+    return;
+  }
+
+  G4ThreeVector world_min, world_max;
+  world->GetLogicalVolume()->GetSolid()->BoundingLimits(world_min, world_max);
+
+  std::mt19937_64 random_engine(0);
+  std::uniform_real_distribution<double> uniform(0., 1.);
+  vector<G4ThreeVector> points(n_points);
+  vector<G4ThreeVector> directions(n_points);
+  for (unsigned int i = 0; i < n_points; ++i) {
+    points[i] = G4ThreeVector(world_min.x() + uniform(random_engine) * (world_max.x() - world_min.x()),
+                              world_min.y() + uniform(random_engine) * (world_max.y() - world_min.y()),
+                              world_min.z() + uniform(random_engine) * (world_max.z() - world_min.z()));
+    const double cos_theta = 2. * uniform(random_engine) - 1.;
+    const double sin_theta = sqrt(1. - cos_theta * cos_theta);
+    const double phi = twopi * uniform(random_engine);
+    directions[i] = G4ThreeVector(sin_theta * cos(phi), sin_theta * sin(phi), cos_theta);
+  }
+
+  G4Navigator navigator;
+  navigator.SetWorldVolume(world);
+
+  // Locate the points without any history, i.e. starting from the world volume
+  unsigned int n_located = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (auto point : points) {
+    if (navigator.LocateGlobalPointAndSetup(point, nullptr, false, true) != nullptr) {
+      ++n_located;
+    }
+  }
+  const double locate_time = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+  unsigned long n_steps = 0;
+  unsigned int n_stuck = 0;
+  start = std::chrono::steady_clock::now();
+  for (unsigned int i = 0; i < n_points; ++i) {
+    G4ThreeVector position = points[i];
+    if (navigator.LocateGlobalPointAndSetup(position, &directions[i], false, false) == nullptr) {
+      continue;
+    }
+    G4double safety;
+    unsigned int n_track_steps = 0;
+    for (; n_track_steps < MAX_STEPS_PER_TRACK; ++n_track_steps) {
+      const G4double step = navigator.ComputeStep(position, directions[i], kInfinity, safety);
+      if (step == kInfinity) {
+        break;
+      }
+      position += step * directions[i];
+      navigator.SetGeometricallyLimitedStep();
+      if (navigator.LocateGlobalPointAndSetup(position, &directions[i], true, false) == nullptr) {
+        ++n_track_steps;
+        break;
+      }
+    }
+    if (n_track_steps == MAX_STEPS_PER_TRACK) {
+      ++n_stuck;
+    }
+    n_steps += n_track_steps;
+  }
+  const double transport_time = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+  G4cout << "================================================================================" << G4endl;
+  G4cout << "Navigation benchmark: " << n_points << " random points in the world volume " << world->GetName() << " with " << world->GetLogicalVolume()->GetNoDaughters() << " daughters" << G4endl;
+  G4cout << "\tLocateGlobalPointAndSetup(): " << locate_time / n_points << " ns per point (" << n_located << " points inside the world volume)" << G4endl;
+  if (n_steps > 0) {
+    G4cout << "\tGeantino transport: " << n_steps << " steps, " << transport_time / n_steps << " ns per step, " << n_steps / (transport_time * 1e-9) << " steps per second" << G4endl;
+  }
+  if (n_stuck > 0) {
+    G4cout << "\t" << n_stuck << " geantino(s) stopped after " << MAX_STEPS_PER_TRACK << " steps" << G4endl;
+  }
+  G4cout << "================================================================================" << G4endl;
+}
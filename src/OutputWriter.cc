@@ -0,0 +1,347 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <climits>
+
+#include "G4RootAnalysisManager.hh"
+#include "G4RunManager.hh"
+#include "G4SystemOfUnits.hh"
+#include "G4Threading.hh"
+
+#include "DetectorConstruction.hh"
+#include "OutputWriter.hh"
+
+#include "utrConfig.h"
+
+output_format OutputWriter::format = ROOT_FORMAT;
+G4ThreadLocal OutputWriter *OutputWriter::instance = nullptr;
+
+// Same defaults as getHistogram
+G4double OutputWriter::histogram_bin_width = 1. * keV;
+G4double OutputWriter::histogram_e_max = 10. * MeV;
+// -1: use the highest ID of the sensitive detectors in the DetectorConstruction
+G4int OutputWriter::histogram_max_id = -1;
+EnergyHistograms OutputWriter::merged_histograms;
+std::mutex OutputWriter::merged_histograms_mutex;
+
+OutputWriter::OutputWriter() : run_format(ROOT_FORMAT) {}
+
+OutputWriter *OutputWriter::Instance() {
+  if (instance == nullptr) {
+    instance = new OutputWriter();
+  }
+  return instance;
+}
+
+G4bool OutputWriter::SetFormat(const G4String &format_name) {
+  if (format_name == "root") {
+    format = ROOT_FORMAT;
+  } else if (format_name == "columnar") {
+    format = COLUMNAR_FORMAT;
+  } else if (format_name == "histogram") {
+    format = HISTOGRAM_FORMAT;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+G4String OutputWriter::GetFormatName(output_format fmt) {
+  switch (fmt) {
+    case COLUMNAR_FORMAT:
+      return "columnar";
+    case HISTOGRAM_FORMAT:
+      return "histogram";
+    default:
+      return "root";
+  }
+}
+
+G4String OutputWriter::GetFileExtension(output_format fmt) {
+  return fmt == COLUMNAR_FORMAT ? ".utrc" : ".root";
+}
+
+void OutputWriter::CreateColumns() {
+  run_format = format;
+
+  if (run_format == HISTOGRAM_FORMAT) {
+    unsigned int max_id = (unsigned int)histogram_max_id;
+    if (histogram_max_id < 0) {
+      max_id = ((DetectorConstruction *)G4RunManager::GetRunManager()->GetUserDetectorConstruction())->Max_Sensitive_Detector_ID;
+    }
+    histograms.SetBinning(max_id + 1, histogram_bin_width, histogram_e_max);
+    if (G4Threading::IsMasterThread()) {
+      // The master thread starts the run before the worker threads
+      merged_histograms.SetBinning(max_id + 1, histogram_bin_width, histogram_e_max);
+    }
+    return;
+  }
+
+  G4RootAnalysisManager *analysisManager = nullptr;
+  if (run_format == ROOT_FORMAT) {
+    analysisManager = G4RootAnalysisManager::Instance();
+  } else {
+    columnar_writer.ClearColumns();
+  }
+  auto create_column = [this, analysisManager](const G4String &name, ColumnarWriter::ColumnType type) {
+    if (run_format == ROOT_FORMAT) {
+      analysisManager->CreateNtupleDColumn(name);
+    } else {
+      columnar_writer.AddColumn(name, type);
+    }
+  };
+
+#ifdef EVENT_EVENTWISE
+  if (run_format == ROOT_FORMAT) {
+    analysisManager->CreateNtuple("edep", "Energy Deposition");
+  }
+#ifdef EVENT_EVENTWISE_SPARSE
+  // One row per detector with a nonzero energy deposition
+  create_column("event", ColumnarWriter::INT64);
+  create_column("volume", ColumnarWriter::INT32);
+  create_column("edep", ColumnarWriter::FLOAT32);
+#else
+  auto max_sensitive_detector_ID = ((DetectorConstruction *)G4RunManager::GetRunManager()->GetUserDetectorConstruction())->Max_Sensitive_Detector_ID;
+  for (size_t i = 0; i < max_sensitive_detector_ID + 1; ++i) {
+    create_column("det" + std::to_string(i), ColumnarWriter::FLOAT32);
+  }
+#endif
+#else
+  if (run_format == ROOT_FORMAT) {
+    analysisManager->CreateNtuple("utr", "Particle information");
+  }
+#ifdef EVENT_ID
+  create_column("event", ColumnarWriter::INT64);
+#endif
+#ifdef EVENT_EDEP
+  create_column("edep", ColumnarWriter::FLOAT32);
+#endif
+#ifdef EVENT_EKIN
+  create_column("ekin", ColumnarWriter::FLOAT32);
+#endif
+#ifdef EVENT_PARTICLE
+  create_column("particle", ColumnarWriter::INT32);
+#endif
+#ifdef EVENT_VOLUME
+  create_column("volume", ColumnarWriter::INT32);
+#endif
+#ifdef EVENT_POSX
+  create_column("x", ColumnarWriter::FLOAT32);
+#endif
+#ifdef EVENT_POSY
+  create_column("y", ColumnarWriter::FLOAT32);
+#endif
+#ifdef EVENT_POSZ
+  create_column("z", ColumnarWriter::FLOAT32);
+#endif
+#ifdef EVENT_MOMX
+  create_column("vx", ColumnarWriter::FLOAT32);
+#endif
+#ifdef EVENT_MOMY
+  create_column("vy", ColumnarWriter::FLOAT32);
+#endif
+#ifdef EVENT_MOMZ
+  create_column("vz", ColumnarWriter::FLOAT32);
+#endif
+#endif
+  if (run_format == ROOT_FORMAT) {
+    analysisManager->FinishNtuple();
+  }
+}
+
+void OutputWriter::OpenFile(const G4String &filename) {
+  if (run_format == HISTOGRAM_FORMAT) {
+    histogram_filename = filename;
+  } else if (run_format == ROOT_FORMAT) {
+    G4RootAnalysisManager::Instance()->OpenFile(filename);
+  } else if (!columnar_writer.Open(filename)) {
+    G4cerr << "ERROR: Could not open outputfile '" << filename << "'! Aborting..." << G4endl;
+    throw std::exception();
+  }
+}
+
+void OutputWriter::CloseFile() {
+  if (run_format == ROOT_FORMAT) {
+    G4RootAnalysisManager *analysisManager = G4RootAnalysisManager::Instance();
+
+    analysisManager->Write();
+    analysisManager->CloseFile();
+
+    delete G4RootAnalysisManager::Instance();
+  } else if (run_format == HISTOGRAM_FORMAT) {
+    if (G4Threading::IsMasterThread()) {
+      // The master thread ends the run after all worker threads
+      write_histograms();
+    } else {
+      std::lock_guard<std::mutex> lock(merged_histograms_mutex);
+      merged_histograms.Add(histograms);
+    }
+  } else {
+    columnar_writer.Close();
+  }
+}
+
+void OutputWriter::write_histograms() {
+  // Sequential mode: the master thread has filled the histograms itself
+  if (!G4Threading::IsMultithreadedApplication()) {
+    merged_histograms.Add(histograms);
+  }
+
+  G4RootAnalysisManager *analysisManager = G4RootAnalysisManager::Instance();
+
+  const G4int n_bins = (G4int)merged_histograms.GetNBins();
+  const G4double e_min = merged_histograms.GetEMin();
+  const G4double e_max = merged_histograms.GetEMax();
+  const G4double bin_width = (e_max - e_min) / n_bins;
+
+  vector<G4int> histogram_ids;
+  for (unsigned int i = 0; i < merged_histograms.GetNDetectors(); ++i) {
+    histogram_ids.push_back(analysisManager->CreateH1("det" + std::to_string(i), "Energy deposition in Detector " + std::to_string(i), n_bins, e_min, e_max));
+  }
+  histogram_ids.push_back(analysisManager->CreateH1("sum", "Sum spectrum of all detectors", n_bins, e_min, e_max));
+
+  analysisManager->OpenFile(histogram_filename);
+
+  // Set the bin contents as if each energy deposition had been filled with weight 1
+  for (unsigned int i = 0; i < histogram_ids.size(); ++i) {
+    auto h1 = analysisManager->GetH1(histogram_ids[i]);
+    for (G4int bin = 0; bin <= n_bins + 1; ++bin) {
+      const uint64_t count = i < merged_histograms.GetNDetectors() ? merged_histograms.GetCount(i, (unsigned int)bin) : merged_histograms.GetSumCount((unsigned int)bin);
+      if (count == 0) {
+        continue;
+      }
+      const G4double n = (G4double)count;
+      const G4double x = e_min + (bin - 0.5) * bin_width;
+      h1->set_bin_content((unsigned int)bin, (unsigned int)std::min(count, (uint64_t)UINT_MAX), n, n, n * x, n * x * x);
+    }
+  }
+
+  analysisManager->Write();
+  analysisManager->CloseFile();
+  delete G4RootAnalysisManager::Instance();
+
+  G4cout << "========================================================================" << G4endl;
+  G4cout << "Wrote histograms of the energy deposition in detectors 0 to " << merged_histograms.GetNDetectors() - 1 << " to '" << histogram_filename << "'" << G4endl;
+  if (merged_histograms.GetNSkipped() > 0) {
+    G4cout << "WARNING: Skipped " << merged_histograms.GetNSkipped() << " energy depositions in detectors with IDs larger than " << merged_histograms.GetNDetectors() - 1 << " (see /utr/output/histogram/maxID)" << G4endl;
+  }
+  G4cout << "========================================================================" << G4endl;
+}
+
+template <typename T>
+void OutputWriter::fill(unsigned int column, T value) {
+  if (run_format == ROOT_FORMAT) {
+    G4RootAnalysisManager::Instance()->FillNtupleDColumn(column, value);
+  } else {
+    columnar_writer.Fill(column, value);
+  }
+}
+
+void OutputWriter::AddRow(const OutputRow &row) {
+  if (run_format == HISTOGRAM_FORMAT) {
+    histograms.Fill(row.volume, row.edep);
+    return;
+  }
+
+  unsigned int nentry = 0;
+
+#ifdef EVENT_ID
+  fill(nentry, row.event);
+  ++nentry;
+#endif
+#ifdef EVENT_EDEP
+  fill(nentry, row.edep);
+  ++nentry;
+#endif
+#ifdef EVENT_EKIN
+  fill(nentry, row.ekin);
+  ++nentry;
+#endif
+#ifdef EVENT_PARTICLE
+  fill(nentry, row.particle);
+  ++nentry;
+#endif
+#ifdef EVENT_VOLUME
+  fill(nentry, row.volume);
+  ++nentry;
+#endif
+#ifdef EVENT_POSX
+  fill(nentry, row.position.x());
+  ++nentry;
+#endif
+#ifdef EVENT_POSY
+  fill(nentry, row.position.y());
+  ++nentry;
+#endif
+#ifdef EVENT_POSZ
+  fill(nentry, row.position.z());
+  ++nentry;
+#endif
+#ifdef EVENT_MOMX
+  fill(nentry, row.momentum.x());
+  ++nentry;
+#endif
+#ifdef EVENT_MOMY
+  fill(nentry, row.momentum.y());
+  ++nentry;
+#endif
+#ifdef EVENT_MOMZ
+  fill(nentry, row.momentum.z());
+#endif
+
+  if (run_format == ROOT_FORMAT) {
+    G4RootAnalysisManager::Instance()->AddNtupleRow();
+  } else {
+    columnar_writer.AddRow();
+  }
+}
+
+void OutputWriter::AddEventwiseRow(G4int event, const vector<G4double> &edep, const vector<G4int> &hit_detectors) {
+  if (run_format == HISTOGRAM_FORMAT) {
+    for (auto detector : hit_detectors) {
+      histograms.Fill(detector, edep[detector]);
+    }
+    return;
+  }
+
+#ifdef EVENT_EVENTWISE_SPARSE
+  for (auto detector : hit_detectors) {
+    fill(0, event);
+    fill(1, detector);
+    fill(2, edep[detector]);
+    if (run_format == ROOT_FORMAT) {
+      G4RootAnalysisManager::Instance()->AddNtupleRow();
+    } else {
+      columnar_writer.AddRow();
+    }
+  }
+#else
+  (void)event;
+  (void)hit_detectors;
+  for (unsigned int detector = 0; detector < edep.size(); ++detector) {
+    fill(detector, edep[detector]);
+  }
+  if (run_format == ROOT_FORMAT) {
+    G4RootAnalysisManager::Instance()->AddNtupleRow();
+  } else {
+    columnar_writer.AddRow();
+  }
+#endif
+}
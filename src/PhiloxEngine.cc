@@ -0,0 +1,188 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <fstream>
+
+#include "CLHEP/Random/engineIDulong.h"
+
+#include "PhiloxEngine.hh"
+
+// Constants of Philox4x32 (Random123)
+#define PHILOX_M0 0xD2511F53U
+#define PHILOX_M1 0xCD9E8D57U
+#define PHILOX_W0 0x9E3779B9U
+#define PHILOX_W1 0xBB67AE85U
+#define PHILOX_ROUNDS 10
+
+// Number of 32 bit words in the output of put()
+#define PHILOX_STATE_SIZE 11
+
+PhiloxEngine::PhiloxEngine() : PhiloxEngine(0) {}
+
+PhiloxEngine::PhiloxEngine(long seed) : HepRandomEngine(), key{}, counter{}, block{}, position(4) {
+  setSeed(seed);
+}
+
+void PhiloxEngine::Block(const uint32_t ctr[4], const uint32_t k[2], uint32_t result[4]) {
+  uint32_t c0 = ctr[0], c1 = ctr[1], c2 = ctr[2], c3 = ctr[3];
+  uint32_t k0 = k[0], k1 = k[1];
+  for (unsigned int round = 0; round < PHILOX_ROUNDS; ++round) {
+    const uint64_t product0 = (uint64_t)PHILOX_M0 * c0;
+    const uint64_t product1 = (uint64_t)PHILOX_M1 * c2;
+    c0 = (uint32_t)(product1 >> 32) ^ c1 ^ k0;
+    c1 = (uint32_t)product1;
+    c2 = (uint32_t)(product0 >> 32) ^ c3 ^ k1;
+    c3 = (uint32_t)product0;
+    k0 += PHILOX_W0;
+    k1 += PHILOX_W1;
+  }
+  result[0] = c0;
+  result[1] = c1;
+  result[2] = c2;
+  result[3] = c3;
+}
+
+void PhiloxEngine::next_block() {
+  Block(counter, key, block);
+  // 128 bit increment of the counter
+  for (unsigned int i = 0; i < 4 && ++counter[i] == 0; ++i) {
+  }
+  position = 0;
+}
+
+double PhiloxEngine::flat() {
+  if (position == 4) {
+    next_block();
+  }
+  // 53 random bits, shifted by half a step to exclude 0 and 1
+  const uint64_t bits = ((uint64_t)block[position] << 21) ^ (block[position + 1] >> 11);
+  position += 2;
+  return ((double)bits + 0.5) * 0x1p-53;
+}
+
+void PhiloxEngine::flatArray(const int size, double *vect) {
+  for (int i = 0; i < size; ++i) {
+    vect[i] = flat();
+  }
+}
+
+void PhiloxEngine::setSeed(long seed, int) {
+  theSeed = seed;
+  key[0] = (uint32_t)((unsigned long)seed);
+  key[1] = (uint32_t)((unsigned long)seed >> 16 >> 16);
+  counter[0] = counter[1] = counter[2] = counter[3] = 0;
+  block[0] = block[1] = block[2] = block[3] = 0;
+  position = 4;
+}
+
+void PhiloxEngine::setSeeds(const long *seeds, int) {
+  theSeeds = seeds;
+  if (seeds == nullptr || seeds[0] == 0) {
+    setSeed(0);
+    return;
+  }
+  theSeed = seeds[0];
+  key[0] = (uint32_t)((unsigned long)seeds[0]);
+  key[1] = seeds[1] == 0 ? 0 : (uint32_t)((unsigned long)seeds[1]);
+  counter[0] = counter[1] = counter[2] = counter[3] = 0;
+  block[0] = block[1] = block[2] = block[3] = 0;
+  position = 4;
+}
+
+void PhiloxEngine::saveStatus(const char filename[]) const {
+  std::ofstream file(filename);
+  put(file);
+}
+
+void PhiloxEngine::restoreStatus(const char filename[]) {
+  std::ifstream file(filename);
+  if (!file.is_open()) {
+    std::cerr << "PhiloxEngine::restoreStatus: could not open '" << filename << "'" << std::endl;
+    return;
+  }
+  get(file);
+}
+
+void PhiloxEngine::showStatus() const {
+  std::cout << "--------------------- Philox engine status ---------------------" << std::endl;
+  std::cout << " Key      = " << key[0] << " " << key[1] << std::endl;
+  std::cout << " Counter  = " << counter[0] << " " << counter[1] << " " << counter[2] << " " << counter[3] << std::endl;
+  std::cout << " Position = " << position << std::endl;
+  std::cout << "----------------------------------------------------------------" << std::endl;
+}
+
+std::vector<unsigned long> PhiloxEngine::put() const {
+  // The engine ID is the CRC32 of the engine name, as for the engines of CLHEP
+  std::vector<unsigned long> v = {CLHEP::engineIDulong<PhiloxEngine>(), key[0], key[1], counter[0], counter[1], counter[2], counter[3], block[0], block[1], block[2], block[3], position};
+  return v;
+}
+
+bool PhiloxEngine::get(const std::vector<unsigned long> &v) {
+  if (v.empty() || v[0] != CLHEP::engineIDulong<PhiloxEngine>()) {
+    std::cerr << "PhiloxEngine::get: the state does not belong to a PhiloxEngine" << std::endl;
+    return false;
+  }
+  return getState(v);
+}
+
+bool PhiloxEngine::getState(const std::vector<unsigned long> &v) {
+  if (v.size() != PHILOX_STATE_SIZE + 1) {
+    std::cerr << "PhiloxEngine::getState: wrong size of the state vector" << std::endl;
+    return false;
+  }
+  key[0] = (uint32_t)v[1];
+  key[1] = (uint32_t)v[2];
+  for (unsigned int i = 0; i < 4; ++i) {
+    counter[i] = (uint32_t)v[3 + i];
+    block[i] = (uint32_t)v[7 + i];
+  }
+  position = (unsigned int)v[11] <= 4 ? (unsigned int)v[11] : 4;
+  return true;
+}
+
+std::ostream &PhiloxEngine::put(std::ostream &os) const {
+  os << beginTag() << std::endl;
+  for (auto value : put()) {
+    os << value << std::endl;
+  }
+  return os;
+}
+
+std::istream &PhiloxEngine::get(std::istream &is) {
+  std::string tag;
+  is >> tag;
+  if (tag != beginTag()) {
+    is.clear(std::ios::badbit | is.rdstate());
+    std::cerr << "PhiloxEngine::get: no PhiloxEngine state found" << std::endl;
+    return is;
+  }
+  return getState(is);
+}
+
+std::istream &PhiloxEngine::getState(std::istream &is) {
+  std::vector<unsigned long> v(PHILOX_STATE_SIZE + 1);
+  for (auto &value : v) {
+    is >> value;
+  }
+  if (!is || !get(v)) {
+    is.clear(std::ios::badbit | is.rdstate());
+  }
+  return is;
+}
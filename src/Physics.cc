@@ -19,6 +19,8 @@ along with utr.  If not, see <http://www.gnu.org/licenses/>.
 */
 
 #include "Physics.hh"
+#include "PhysicsTableCache.hh"
+#include "utrRegions.hh"
 
 // Electromagnetic modular physics lists
 #ifdef EM_FAST
@@ -41,6 +43,10 @@ along with utr.  If not, see <http://www.gnu.org/licenses/>.
 #include "G4EmStandardPhysics_option4.hh"
 #endif
 
+#ifdef EM_REGIONAL
+#include "EmRegionalPhysics.hh"
+#endif
+
 // Hadronic elastic modular physics lists
 #ifdef HADRON_ELASTIC_STANDARD
 #include "G4HadronElasticPhysics.hh"
@@ -67,12 +73,25 @@ along with utr.  If not, see <http://www.gnu.org/licenses/>.
 #include "G4EmExtraPhysics.hh"
 #endif
 
+#ifdef PHYSICS_LEAN
+#include "EmLeanPhysics.hh"
+#endif
+
 Physics::Physics() {
   G4cout << "================================================================"
             "================"
          << G4endl;
   G4cout << "Using the following physics lists:" << G4endl;
 
+// Lean physics for photons, electrons and positrons only. Replaces all EM and hadronic modular physics lists.
+#ifdef PHYSICS_LEAN
+  G4cout << "\tEmLeanPhysics (gamma, e- and e+ only) ..." << G4endl;
+  RegisterPhysics(new EmLeanPhysics());
+#ifdef EM_EXTRA
+  G4cout << "\tG4EmExtraPhysics ..." << G4endl;
+  RegisterPhysics(new G4EmExtraPhysics());
+#endif
+#else
 // Electromagnetic modular physics lists
 #ifdef EM_FAST
   G4cout << "\tG4EmStandardPhysics_option1 ..." << G4endl;
@@ -94,6 +113,10 @@ Physics::Physics() {
   G4cout << "\tG4EmStandardPhysics_option4 ..." << G4endl;
   RegisterPhysics(new G4EmStandardPhysics_option4());
 #endif
+#ifdef EM_REGIONAL
+  G4cout << "\tEmRegionalPhysics (G4EmStandardPhysics_option1 + polarized Livermore gamma models in selected regions) ..." << G4endl;
+  RegisterPhysics(new EmRegionalPhysics());
+#endif
 
 // EM extra physics. Contains photonuclear processes.
 #ifdef EM_EXTRA
@@ -131,9 +154,23 @@ Physics::Physics() {
 #ifdef HADRON_INELASTIC_LEND
   G4cout << "\tG4HadronPhysicsShieldingLEND ..." << G4endl;
   RegisterPhysics(new G4HadronPhysicsShieldingLEND());
+#endif
 #endif
 
   G4cout << "================================================================"
             "================"
          << G4endl;
 }
+
+void Physics::SetCuts() {
+  G4VUserPhysicsList::SetCuts();
+
+  // The regions are shared by all threads
+  if (G4Threading::IsMasterThread()) {
+    utrRegions::Setup();
+#ifdef EM_REGIONAL
+    EmRegionalPhysics::CheckRegions();
+#endif
+    PhysicsTableCache::Prepare(this);
+  }
+}
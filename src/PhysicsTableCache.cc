@@ -0,0 +1,223 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "G4Element.hh"
+#include "G4EmParameters.hh"
+#include "G4Isotope.hh"
+#include "G4LogicalVolume.hh"
+#include "G4Material.hh"
+#include "G4ProductionCuts.hh"
+#include "G4Region.hh"
+#include "G4RegionStore.hh"
+#include "G4SystemOfUnits.hh"
+#include "G4VPhysicsConstructor.hh"
+#include "G4Version.hh"
+
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <unistd.h>
+
+#include "PhysicsTableCache.hh"
+#include "utrConfig.h"
+
+#ifdef EM_REGIONAL
+#include "EmRegionalPhysics.hh"
+#endif
+
+G4bool PhysicsTableCache::enabled = false;
+G4String PhysicsTableCache::directory = "";
+
+G4VUserPhysicsList *PhysicsTableCache::cached_physics_list = nullptr;
+G4String PhysicsTableCache::key = "";
+G4String PhysicsTableCache::key_description = "";
+G4bool PhysicsTableCache::hit = false;
+G4bool PhysicsTableCache::done = false;
+std::chrono::steady_clock::time_point PhysicsTableCache::start_time = std::chrono::steady_clock::now();
+
+G4String PhysicsTableCache::GetDirectory() {
+  if (!directory.empty()) {
+    return directory;
+  }
+  const char *xdg_cache_home = std::getenv("XDG_CACHE_HOME");
+  if (xdg_cache_home != nullptr && xdg_cache_home[0] != '\0') {
+    return G4String(xdg_cache_home) + "/utr";
+  }
+  const char *home = std::getenv("HOME");
+  if (home != nullptr && home[0] != '\0') {
+    return G4String(home) + "/.cache/utr";
+  }
+  return "";
+}
+
+G4String PhysicsTableCache::get_key_description(const G4VUserPhysicsList *physics_list) {
+  std::stringstream description;
+  description << std::setprecision(17);
+
+  description << "Geant4 " << G4VERSION_NUMBER << "\n";
+  for (auto variable : {"G4LEDATA", "G4LEVELGAMMADATA", "G4PARTICLEXSDATA", "G4ENSDFSTATEDATA"}) {
+    const char *value = std::getenv(variable);
+    description << variable << " " << (value == nullptr ? "" : value) << "\n";
+  }
+
+  const G4VModularPhysicsList *modular_physics_list = dynamic_cast<const G4VModularPhysicsList *>(physics_list);
+  if (modular_physics_list != nullptr) {
+    for (G4int i = 0; modular_physics_list->GetPhysics(i) != nullptr; ++i) {
+      description << "Constructor " << modular_physics_list->GetPhysics(i)->GetPhysicsName() << "\n";
+    }
+  }
+#ifdef EM_REGIONAL
+  for (auto region : EmRegionalPhysics::GetPolarizedRegions()) {
+    description << "Polarized region " << region << "\n";
+  }
+#endif
+  G4EmParameters::Instance()->StreamInfo(description);
+
+  description << "Default cut " << physics_list->GetDefaultCutValue() / mm << " mm\n";
+  for (auto region : *G4RegionStore::GetInstance()) {
+    description << "Region " << region->GetName();
+    G4ProductionCuts *cuts = region->GetProductionCuts();
+    for (auto particle : {"gamma", "e-", "e+", "proton"}) {
+      description << " " << (cuts == nullptr ? -1. : cuts->GetProductionCut(particle) / mm);
+    }
+    std::vector<G4LogicalVolume *>::iterator root_volume = region->GetRootLogicalVolumeIterator();
+    for (size_t i = 0; i < region->GetNumberOfRootVolumes(); ++i, ++root_volume) {
+      description << " " << (*root_volume)->GetName();
+    }
+    description << "\n";
+  }
+
+  for (auto material : *G4Material::GetMaterialTable()) {
+    description << "Material " << material->GetName() << " " << material->GetDensity() / (g / cm3) << " " << material->GetState() << " "
+                << material->GetTemperature() / kelvin << " " << material->GetPressure() / bar << " "
+                << material->GetIonisation()->GetMeanExcitationEnergy() / eV << "\n";
+    for (size_t i = 0; i < material->GetNumberOfElements(); ++i) {
+      const G4Element *element = material->GetElement((G4int)i);
+      description << "\tElement " << element->GetName() << " " << material->GetFractionVector()[i];
+      for (size_t j = 0; j < element->GetNumberOfIsotopes(); ++j) {
+        const G4Isotope *isotope = element->GetIsotope((G4int)j);
+        description << " " << isotope->GetZ() << "/" << isotope->GetN() << "/" << isotope->GetA() / (g / mole) << "/"
+                    << element->GetRelativeAbundanceVector()[j];
+      }
+      description << "\n";
+    }
+  }
+
+  return description.str();
+}
+
+G4String PhysicsTableCache::hash(const G4String &text) {
+  // 64-bit FNV-1a hash, which does not depend on the platform or the standard library
+  uint64_t h = 14695981039346656037ULL;
+  for (auto c : text) {
+    h ^= (uint64_t)(unsigned char)c;
+    h *= 1099511628211ULL;
+  }
+  std::stringstream hex;
+  hex << std::hex << std::setw(16) << std::setfill('0') << h;
+  return hex.str();
+}
+
+void PhysicsTableCache::Prepare(G4VUserPhysicsList *physics_list) {
+  if (!enabled) {
+    return;
+  }
+  if (GetDirectory().empty()) {
+    G4cout << "WARNING: PhysicsTableCache: Neither HOME nor XDG_CACHE_HOME are set, the physics tables are not cached" << G4endl;
+    enabled = false;
+    return;
+  }
+
+  cached_physics_list = physics_list;
+  key_description = get_key_description(physics_list);
+  key = hash(key_description);
+
+  const G4String entry = GetDirectory() + "/" + key;
+  std::error_code error;
+  hit = std::filesystem::is_directory(entry.c_str(), error);
+  if (hit) {
+    physics_list->SetPhysicsTableRetrieved(entry);
+  }
+  G4cout << "PhysicsTableCache: " << (hit ? "Retrieving the physics tables from " : "No physics tables found in ") << entry << G4endl;
+}
+
+void PhysicsTableCache::BeginOfRun() {
+  if (done) {
+    return;
+  }
+  done = true;
+
+  G4String status = "disabled";
+  if (enabled && cached_physics_list != nullptr) {
+    if (hit && cached_physics_list->IsPhysicsTableRetrieved()) {
+      status = "hit";
+    } else {
+      // Either the entry did not exist, or Geant4 rejected it and built the tables from scratch
+      status = hit ? "invalid entry, rebuilt" : "miss";
+      store();
+    }
+  }
+
+  G4cout << "================================================================================" << G4endl;
+  G4cout << "Startup time: " << std::fixed << std::setprecision(1)
+         << std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count() << " s" << std::defaultfloat << G4endl;
+  G4cout << "Physics table cache: " << status;
+  if (status != "disabled") {
+    G4cout << " (" << GetDirectory() << "/" << key << ")";
+  }
+  G4cout << G4endl;
+  G4cout << "================================================================================" << G4endl;
+}
+
+void PhysicsTableCache::store() {
+  // The tables are written to a temporary directory first, so that other instances of utr,
+  // which may start at the same time, never see an incomplete entry
+  const G4String entry = GetDirectory() + "/" + key;
+  const G4String temporary = entry + ".tmp" + std::to_string(getpid());
+  std::error_code error;
+
+  std::filesystem::create_directories(temporary.c_str(), error);
+  if (error || !cached_physics_list->StorePhysicsTable(temporary)) {
+    G4cout << "WARNING: PhysicsTableCache: Failed to store the physics tables in " << temporary << G4endl;
+    std::filesystem::remove_all(temporary.c_str(), error);
+    return;
+  }
+  std::ofstream(temporary + "/key.txt") << key_description;
+
+  uintmax_t size = 0;
+  for (auto &file : std::filesystem::recursive_directory_iterator(temporary.c_str(), error)) {
+    if (file.is_regular_file(error)) {
+      size += file.file_size(error);
+    }
+  }
+  G4cout << "PhysicsTableCache: Stored " << std::fixed << std::setprecision(1) << (double)size / (1024. * 1024.) << std::defaultfloat << " MiB of physics tables in " << entry << G4endl;
+
+  if (hit) {
+    std::filesystem::remove_all(entry.c_str(), error);
+  }
+  std::filesystem::rename(temporary.c_str(), entry.c_str(), error);
+  if (error) {
+    // Another instance of utr has stored the same entry in the meantime
+    std::filesystem::remove_all(temporary.c_str(), error);
+  }
+}
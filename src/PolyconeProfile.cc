@@ -0,0 +1,94 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <cmath>
+
+#include "PolyconeProfile.hh"
+
+// Number of points between two planes at which the deviation from the profile is evaluated
+#define N_CHECK_POINTS 16
+// Number of bisections to find the largest possible distance to the next plane
+#define N_BISECTIONS 40
+
+PolyconeProfile::PolyconeProfile(const std::function<double(double)> &r_in, const std::function<double(double)> &r_out) : r_inner(r_in), r_outer(r_out), max_observed_deviation(0.) {}
+
+void PolyconeProfile::Build(const vector<double> &breakpoints, double max_deviation) {
+  z_planes.clear();
+  r_inner_planes.clear();
+  r_outer_planes.clear();
+  max_observed_deviation = 0.;
+
+  if (breakpoints.empty()) {
+    return;
+  }
+
+  add_plane(breakpoints[0]);
+  for (size_t i = 1; i < breakpoints.size(); ++i) {
+    const double z_end = breakpoints[i];
+    double z = z_planes.back();
+    while (z != z_end) {
+      double z_next = z_end;
+      double d = deviation(z, z_next);
+      if (d > max_deviation) {
+        // The deviation grows with the distance between the planes for convex and concave
+        // profiles, so the largest allowed distance can be found by bisection.
+        double z_good = z;
+        double z_bad = z_end;
+        for (unsigned int j = 0; j < N_BISECTIONS; ++j) {
+          const double z_mid = 0.5 * (z_good + z_bad);
+          if (deviation(z, z_mid) > max_deviation) {
+            z_bad = z_mid;
+          } else {
+            z_good = z_mid;
+          }
+        }
+        // Ensure progress even if the tolerance is below the numerical precision
+        z_next = (z_good != z) ? z_good : z_bad;
+        d = deviation(z, z_next);
+      }
+      max_observed_deviation = std::max(max_observed_deviation, d);
+      add_plane(z_next);
+      z = z_next;
+    }
+  }
+}
+
+double PolyconeProfile::deviation(double z_1, double z_2) const {
+  const double r_inner_1 = r_inner(z_1);
+  const double r_inner_2 = r_inner(z_2);
+  const double r_outer_1 = r_outer(z_1);
+  const double r_outer_2 = r_outer(z_2);
+
+  double max_d = 0.;
+  for (unsigned int i = 1; i <= N_CHECK_POINTS; ++i) {
+    const double t = (double)i / (N_CHECK_POINTS + 1);
+    const double z = z_1 + t * (z_2 - z_1);
+    max_d = std::max(max_d, fabs(r_inner(z) - (r_inner_1 + t * (r_inner_2 - r_inner_1))));
+    max_d = std::max(max_d, fabs(r_outer(z) - (r_outer_1 + t * (r_outer_2 - r_outer_1))));
+  }
+  return max_d;
+}
+
+void PolyconeProfile::add_plane(double z) {
+  z_planes.push_back(z);
+  r_inner_planes.push_back(r_inner(z));
+  r_outer_planes.push_back(r_outer(z));
+}
@@ -0,0 +1,190 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <unistd.h>
+
+#include "G4Threading.hh"
+
+#include "ProgressMonitor.hh"
+#include "utrConfig.h"
+#include "utrFilenameTools.hh"
+
+using std::setw;
+
+G4double ProgressMonitor::interval = progress_interval;
+G4bool ProgressMonitor::json = false;
+
+std::unique_ptr<ProgressMonitor::Counter[]> ProgressMonitor::counters;
+G4int ProgressMonitor::n_counters = 0;
+G4int ProgressMonitor::run = 0;
+G4long ProgressMonitor::n_events_to_process = 0;
+
+std::thread ProgressMonitor::reporter;
+std::mutex ProgressMonitor::reporter_mutex;
+std::condition_variable ProgressMonitor::reporter_condition;
+G4bool ProgressMonitor::stop_reporter = false;
+
+std::chrono::steady_clock::time_point ProgressMonitor::start_time;
+std::chrono::steady_clock::time_point ProgressMonitor::last_time;
+vector<G4long> ProgressMonitor::last_events;
+std::ofstream ProgressMonitor::json_file;
+
+// Format a duration like '  0d  1h  12mn  5s'
+static G4String format_duration(G4double seconds) {
+  const long total = (long)seconds;
+  std::stringstream duration;
+  duration << setw(3) << total / (24 * 3600) << "d " << setw(2) << total % (24 * 3600) / 3600 << "h "
+           << setw(3) << total % 3600 / 60 << "mn " << setw(3) << total % 60 << "s";
+  return duration.str();
+}
+
+void ProgressMonitor::BeginOfRun(G4int run_id, G4long n_events, G4int n_threads) {
+  // The counters of the worker threads, or of the master thread in sequential mode
+  n_counters = std::max(n_threads, 1);
+  counters.reset(new Counter[n_counters]);
+  for (G4int i = 0; i < n_counters; ++i) {
+    counters[i].events.store(0, std::memory_order_relaxed);
+  }
+  run = run_id;
+  n_events_to_process = n_events;
+
+  start_time = std::chrono::steady_clock::now();
+  last_time = start_time;
+  last_events.assign(n_counters, 0);
+
+  if (json) {
+    const G4String json_filename = utrFilenameTools::getRunFilename() + "_progress.jsonl";
+    json_file.open(json_filename);
+    if (!json_file.is_open()) {
+      G4cerr << "ERROR: ProgressMonitor: Could not open '" << json_filename << "'! Aborting..." << G4endl;
+      throw std::exception();
+    }
+    json_file << std::fixed;
+  }
+
+  if (interval > 0.) {
+    stop_reporter = false;
+    reporter = std::thread(run_reporter);
+  }
+}
+
+void ProgressMonitor::EndOfRun() {
+  if (reporter.joinable()) {
+    {
+      std::lock_guard<std::mutex> lock(reporter_mutex);
+      stop_reporter = true;
+    }
+    reporter_condition.notify_one();
+    reporter.join();
+  }
+  if (counters) {
+    report(true);
+  }
+  if (json_file.is_open()) {
+    json_file.close();
+  }
+  counters.reset();
+  n_counters = 0;
+}
+
+void ProgressMonitor::CountEvent() {
+  const G4int thread_id = std::max(G4Threading::G4GetThreadId(), 0);
+  if (thread_id < n_counters) {
+    counters[thread_id].events.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+size_t ProgressMonitor::GetResidentMemory() {
+  // The second entry of statm is the number of resident pages
+  std::ifstream statm("/proc/self/statm");
+  size_t size = 0, resident = 0;
+  if (!(statm >> size >> resident)) {
+    return 0;
+  }
+  return resident * (size_t)sysconf(_SC_PAGESIZE);
+}
+
+void ProgressMonitor::run_reporter() {
+  std::unique_lock<std::mutex> lock(reporter_mutex);
+  while (!reporter_condition.wait_for(lock, std::chrono::duration<G4double>(interval), [] { return stop_reporter; })) {
+    report(false);
+  }
+}
+
+void ProgressMonitor::report(G4bool final) {
+  const auto now = std::chrono::steady_clock::now();
+  const G4double elapsed = std::chrono::duration<G4double>(now - start_time).count();
+  // The rates are averaged over the last interval, the final report gives the mean rates of the run
+  const G4double dt = final ? elapsed : std::chrono::duration<G4double>(now - last_time).count();
+
+  G4long n_events = 0;
+  vector<G4double> thread_rates(n_counters, 0.);
+  for (G4int i = 0; i < n_counters; ++i) {
+    const G4long events = counters[i].events.load(std::memory_order_relaxed);
+    if (dt > 0.) {
+      thread_rates[i] = (G4double)(events - (final ? 0 : last_events[i])) / dt;
+    }
+    last_events[i] = events;
+    n_events += events;
+  }
+  last_time = now;
+
+  G4double rate = 0.;
+  for (auto thread_rate : thread_rates) {
+    rate += thread_rate;
+  }
+  const G4double eta = rate > 0. ? (G4double)(n_events_to_process - n_events) / rate : -1.;
+  const G4double rss_mb = (G4double)GetResidentMemory() / (1024. * 1024.);
+  const auto minmax_rate = std::minmax_element(thread_rates.begin(), thread_rates.end());
+
+  std::stringstream line;
+  line << (final ? "Finished: [" : "Progress: [") << setw(16) << n_events << "/" << n_events_to_process << "] "
+       << std::fixed << std::setprecision(2) << setw(6) << (n_events_to_process > 0 ? 100. * (G4double)n_events / (G4double)n_events_to_process : 100.) << " %"
+       << "  Running time: " << format_duration(elapsed)
+       << "  Rate: " << std::setprecision(1) << rate << " ev/s";
+  if (n_counters > 1) {
+    line << " (per thread: " << rate / n_counters << ", min " << *minmax_rate.first << ", max " << *minmax_rate.second << ")";
+  }
+  if (!final) {
+    line << "  ETA: " << (eta >= 0. ? format_duration(eta) : G4String("unknown"));
+  }
+  line << "  RSS: " << std::setprecision(0) << rss_mb << " MB";
+  G4cout << line.str() << G4endl;
+
+  if (json_file.is_open()) {
+    json_file << "{\"run\": " << run << ", \"final\": " << (final ? "true" : "false")
+              << ", \"time\": " << std::setprecision(3) << elapsed
+              << ", \"events\": " << n_events << ", \"total\": " << n_events_to_process
+              << ", \"rate\": " << rate << ", \"thread_rates\": [";
+    for (G4int i = 0; i < n_counters; ++i) {
+      json_file << (i > 0 ? ", " : "") << thread_rates[i];
+    }
+    json_file << "], \"eta\": ";
+    if (final || eta >= 0.) {
+      json_file << (final ? 0. : eta);
+    } else {
+      json_file << "null";
+    }
+    json_file << ", \"rss_mb\": " << rss_mb << "}" << std::endl;
+  }
+}
@@ -28,10 +28,18 @@ along with utr.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "G4FileUtilities.hh"
 
-#include "DetectorConstruction.hh"
+#include "EventTimer.hh"
 #include "G4RootAnalysisManager.hh"
+#include "OutputWriter.hh"
+#include "PhysicsTableCache.hh"
+#include "ProgressMonitor.hh"
 #include "RunAction.hh"
+#include "StackingAction.hh"
+#include "SteppingAction.hh"
+#include "SteppingProfiler.hh"
 #include "utrFilenameTools.hh"
+#include "utrRandom.hh"
+#include "utrRegions.hh"
 #include <limits.h>
 
 #include "utrConfig.h"
@@ -40,94 +48,89 @@ RunAction::RunAction() : G4UserRunAction() {}
 
 RunAction::~RunAction() { delete G4RootAnalysisManager::Instance(); }
 
-void RunAction::BeginOfRunAction(const G4Run *) {
-  // Get analysis manager
-  G4RootAnalysisManager *analysisManager = G4RootAnalysisManager::Instance();
+void RunAction::BeginOfRunAction(const G4Run *run) {
+  if (IsMaster() && pre_run_validation) {
+    pre_run_validation();
+  }
 
-#ifdef EVENT_EVENTWISE
-  analysisManager->CreateNtuple("edep", "Energy Deposition");
-  auto max_sensitive_detector_ID = ((DetectorConstruction *)G4RunManager::GetRunManager()->GetUserDetectorConstruction())->Max_Sensitive_Detector_ID;
-  for (size_t i = 0; i < max_sensitive_detector_ID + 1; ++i) {
-    analysisManager->CreateNtupleDColumn("det" + std::to_string(i));
+  // The physics tables have been built or retrieved by the master thread at this point
+  if (IsMaster()) {
+    PhysicsTableCache::BeginOfRun();
   }
-#else
-  analysisManager->CreateNtuple("utr", "Particle information");
-#ifdef EVENT_ID
-  analysisManager->CreateNtupleDColumn("event");
-#endif
-#ifdef EVENT_EDEP
-  analysisManager->CreateNtupleDColumn("edep");
-#endif
-#ifdef EVENT_EKIN
-  analysisManager->CreateNtupleDColumn("ekin");
-#endif
-#ifdef EVENT_PARTICLE
-  analysisManager->CreateNtupleDColumn("particle");
-#endif
-#ifdef EVENT_VOLUME
-  analysisManager->CreateNtupleDColumn("volume");
-#endif
-#ifdef EVENT_POSX
-  analysisManager->CreateNtupleDColumn("x");
-#endif
-#ifdef EVENT_POSY
-  analysisManager->CreateNtupleDColumn("y");
-#endif
-#ifdef EVENT_POSZ
-  analysisManager->CreateNtupleDColumn("z");
-#endif
-#ifdef EVENT_MOMX
-  analysisManager->CreateNtupleDColumn("vx");
-#endif
-#ifdef EVENT_MOMY
-  analysisManager->CreateNtupleDColumn("vy");
-#endif
-#ifdef EVENT_MOMZ
-  analysisManager->CreateNtupleDColumn("vz");
-#endif
-#endif
-  analysisManager->FinishNtuple();
+
+  OutputWriter *outputWriter = OutputWriter::Instance();
+  outputWriter->CreateColumns();
 
   // Open an output file
-  // Geant4 in Multithreading mode creates files with naming convention
+  // Geant4 in Multithreading mode creates root files with naming convention
   //
   // <filename>_t<threadId>.root
   //
-  // where the filename is given by the user in analysisManager->OpenFile()
+  // where the filename is given by the user in analysisManager->OpenFile().
+  // Columnar output files follow the same convention, but only the worker threads write one.
+  // In the histogram format, only the master thread writes a file <filename>_hist.root.
 
   if (IsMaster()) { // G4UserRunAction::IsMaster should be equivalent to G4Threading::G4GetThreadId() == -1
     // Master thread (running this function before all other threads) increments the file ID to use, if used
     if (utrFilenameTools::getUseFilenameID()) {
       utrFilenameTools::incrementFilenameID();
     }
-    analysisManager->OpenFile(utrFilenameTools::getMasterFilename());
-  } else {
+    if (OutputWriter::GetFormat() == ROOT_FORMAT) {
+      outputWriter->OpenFile(utrFilenameTools::getMasterFilename());
+    } else if (OutputWriter::GetFormat() == HISTOGRAM_FORMAT) {
+      // The master thread writes the histograms of all threads to the same file as getHistogram would
+      G4FileUtilities fu;
+      std::stringstream filename;
+      filename << utrFilenameTools::getRunFilename() << "_hist.root";
+      if (fu.FileExists(filename.str())) {
+        G4cerr << "ERROR: Designated outputfile '" << filename.str() << "' already exists! Aborting..." << G4endl;
+        throw std::exception();
+      }
+      outputWriter->OpenFile(filename.str());
+    }
+  } else if (OutputWriter::GetFormat() != HISTOGRAM_FORMAT) {
     // Worker threads check whether their designated output file already exists and if so abort
     G4FileUtilities fu;
+    const G4String extension = OutputWriter::GetFileExtension(OutputWriter::GetFormat());
     std::stringstream filename;
-    filename << utrFilenameTools::getOutputDir() << "/" << utrFilenameTools::getFilenamePrefix();
-    if (utrFilenameTools::getUseFilenameID()) {
-      filename << utrFilenameTools::getFilenameID();
-    }
+    filename << utrFilenameTools::getRunFilename();
     std::stringstream filenameWithThreadID;
-    filenameWithThreadID << filename.str() << "_t" << G4Threading::G4GetThreadId() << ".root";
-    filename << ".root";
+    filenameWithThreadID << filename.str() << "_t" << G4Threading::G4GetThreadId() << extension;
+    filename << extension;
     if (fu.FileExists(filenameWithThreadID.str())) {
       G4cerr << "ERROR: Designated outputfile '" << filenameWithThreadID.str() << "' already exists! Aborting..." << G4endl;
       throw std::exception();
+    } else if (OutputWriter::GetFormat() == ROOT_FORMAT) {
+      outputWriter->OpenFile(filename.str());
     } else {
-      analysisManager->OpenFile(filename.str());
+      outputWriter->OpenFile(filenameWithThreadID.str());
     }
   }
-}
-
-void RunAction::EndOfRunAction(const G4Run *) {
-  G4RootAnalysisManager *analysisManager = G4RootAnalysisManager::Instance();
 
-  analysisManager->Write();
-  analysisManager->CloseFile();
+  // The file ID of the run is known at this point, and the worker threads have not started yet
+  if (IsMaster()) {
+    ProgressMonitor::BeginOfRun(run->GetRunID(), run->GetNumberOfEventToBeProcessed(), G4RunManager::GetRunManager()->GetNumberOfThreads());
+  }
+}
 
-  delete G4RootAnalysisManager::Instance();
+void RunAction::EndOfRunAction(const G4Run *run) {
+  OutputWriter::Instance()->CloseFile();
+
+  // The master thread runs this function after all worker threads
+  StackingAction::MergeStatistics();
+  SteppingAction::MergeStatistics();
+  SteppingProfiler::MergeStatistics();
+  EventTimer::MergeStatistics();
+  utrRegions::MergeStatistics();
+  if (IsMaster()) {
+    ProgressMonitor::EndOfRun();
+    StackingAction::PrintStatistics();
+    SteppingAction::PrintStatistics();
+    SteppingProfiler::PrintStatistics();
+    EventTimer::PrintStatistics();
+    utrRegions::PrintStatistics();
+    utrRandom::WriteManifest(run);
+  }
 }
 
 G4String RunAction::GetOutputFlagName(unsigned int n) {
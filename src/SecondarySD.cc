@@ -21,7 +21,6 @@ along with utr.  If not, see <http://www.gnu.org/licenses/>.
 #include "SecondarySD.hh"
 #include "G4Event.hh"
 #include "G4HCofThisEvent.hh"
-#include "G4RootAnalysisManager.hh"
 #include "G4RunManager.hh"
 #include "G4SDManager.hh"
 #include "G4Step.hh"
@@ -29,6 +28,7 @@ along with utr.  If not, see <http://www.gnu.org/licenses/>.
 #include "G4ThreeVector.hh"
 #include "G4VProcess.hh"
 #include "G4ios.hh"
+#include "OutputWriter.hh"
 #include "RunAction.hh"
 
 #include "utrConfig.h"
@@ -62,55 +62,16 @@ G4bool SecondarySD::ProcessHits(G4Step *aStep, G4TouchableHistory *) {
     if (track->GetKineticEnergy() == 0.)
       return false;
 
-    G4RootAnalysisManager *analysisManager = G4RootAnalysisManager::Instance();
-
-    unsigned int nentry = 0;
-
-#ifdef EVENT_ID
-    analysisManager->FillNtupleDColumn(nentry, eventID);
-    ++nentry;
-#endif
-#ifdef EVENT_EDEP
-    analysisManager->FillNtupleDColumn(nentry, aStep->GetTotalEnergyDeposit());
-    ++nentry;
-#endif
-#ifdef EVENT_EKIN
-    analysisManager->FillNtupleDColumn(nentry, aStep->GetPreStepPoint()->GetKineticEnergy());
-    ++nentry;
-#endif
-#ifdef EVENT_PARTICLE
-    analysisManager->FillNtupleDColumn(nentry, track->GetDefinition()->GetPDGEncoding());
-    ++nentry;
-#endif
-#ifdef EVENT_VOLUME
-    analysisManager->FillNtupleDColumn(nentry, getDetectorID());
-    ++nentry;
-#endif
-#ifdef EVENT_POSX
-    analysisManager->FillNtupleDColumn(nentry, track->GetPosition().x());
-    ++nentry;
-#endif
-#ifdef EVENT_POSY
-    analysisManager->FillNtupleDColumn(nentry, track->GetPosition().y());
-    ++nentry;
-#endif
-#ifdef EVENT_POSZ
-    analysisManager->FillNtupleDColumn(nentry, track->GetPosition().z());
-    ++nentry;
-#endif
-#ifdef EVENT_MOMX
-    analysisManager->FillNtupleDColumn(nentry, track->GetMomentum().x());
-    ++nentry;
-#endif
-#ifdef EVENT_MOMY
-    analysisManager->FillNtupleDColumn(nentry, track->GetMomentum().y());
-    ++nentry;
-#endif
-#ifdef EVENT_MOMZ
-    analysisManager->FillNtupleDColumn(nentry, track->GetMomentum().z());
-#endif
-
-    analysisManager->AddNtupleRow();
+    OutputRow row;
+    row.event = eventID;
+    row.edep = aStep->GetTotalEnergyDeposit();
+    row.ekin = aStep->GetPreStepPoint()->GetKineticEnergy();
+    row.particle = track->GetDefinition()->GetPDGEncoding();
+    row.volume = getDetectorID();
+    row.position = track->GetPosition();
+    row.momentum = track->GetMomentum();
+
+    OutputWriter::Instance()->AddRow(row);
   }
 
   return true;
@@ -0,0 +1,217 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+
+#include "G4LogicalVolume.hh"
+#include "G4TransportationManager.hh"
+
+#include "G4SystemOfUnits.hh"
+
+#include "SourceVolumeSampler.hh"
+
+void SourceVolumeSampler::Initialize(const vector<G4String> &source_PV_names, const G4ThreeVector &box_center, const G4ThreeVector &box_size) {
+  Clear();
+
+  container_min = box_center - 0.5 * box_size;
+  container_max = box_center + 0.5 * box_size;
+
+  G4VPhysicalVolume *world = G4TransportationManager::GetTransportationManager()->GetNavigatorForTracking()->GetWorldVolume();
+  find_placements(world, G4RotationMatrix(), G4ThreeVector(), source_PV_names);
+
+  for (auto source_PV_name : source_PV_names) {
+    G4bool found = false;
+    for (auto placement : placements) {
+      if (placement.physical_volume->GetName() == source_PV_name) {
+        found = true;
+        break;
+      }
+    }
+    if (!found) {
+      G4cerr << "ERROR: SourceVolumeSampler: Source physical volume " << source_PV_name << " not found in the geometry! Aborting..." << G4endl;
+      throw std::exception();
+    }
+  }
+
+  // Placements whose extent is completely outside the container box can never be sampled
+  placements.erase(std::remove_if(placements.begin(), placements.end(), [](const Placement &placement) {
+                     return placement.box_min.x() >= placement.box_max.x() || placement.box_min.y() >= placement.box_max.y() || placement.box_min.z() >= placement.box_max.z();
+                   }),
+                   placements.end());
+  if (placements.empty()) {
+    G4cerr << "ERROR: SourceVolumeSampler: None of the source physical volumes is inside the container box! Aborting..." << G4endl;
+    throw std::exception();
+  }
+
+  G4double volume = 0.;
+  for (auto placement : placements) {
+    G4ThreeVector extent = placement.box_max - placement.box_min;
+    volume += extent.x() * extent.y() * extent.z();
+    cumulative_volume.push_back(volume);
+  }
+
+  initialized = true;
+}
+
+void SourceVolumeSampler::Clear() {
+  placements.clear();
+  cumulative_volume.clear();
+  initialized = false;
+}
+
+void SourceVolumeSampler::find_placements(G4VPhysicalVolume *physical_volume, const G4RotationMatrix &rotation, const G4ThreeVector &translation, const vector<G4String> &source_PV_names) {
+  G4LogicalVolume *logical_volume = physical_volume->GetLogicalVolume();
+
+  if (std::find(source_PV_names.begin(), source_PV_names.end(), physical_volume->GetName()) != source_PV_names.end()) {
+    Placement placement;
+    placement.physical_volume = physical_volume;
+    placement.inverse_rotation = rotation.inverse();
+    placement.translation = translation;
+
+    for (size_t i = 0; i < logical_volume->GetNoDaughters(); ++i) {
+      G4VPhysicalVolume *daughter = logical_volume->GetDaughter(i);
+      if (daughter->IsReplicated()) {
+        G4cerr << "ERROR: SourceVolumeSampler: Source physical volume " << physical_volume->GetName() << " has the replicated daughter " << daughter->GetName() << ", which is not supported! Aborting..." << G4endl;
+        throw std::exception();
+      }
+      placement.daughters.push_back({daughter->GetLogicalVolume()->GetSolid(), daughter->GetObjectRotationValue().inverse(), daughter->GetObjectTranslation()});
+    }
+
+    // Transform the corners of the bounding box of the solid to the world frame
+    G4ThreeVector local_min, local_max;
+    logical_volume->GetSolid()->BoundingLimits(local_min, local_max);
+    G4ThreeVector world_min(kInfinity, kInfinity, kInfinity);
+    G4ThreeVector world_max(-kInfinity, -kInfinity, -kInfinity);
+    for (int n_corner = 0; n_corner < 8; ++n_corner) {
+      G4ThreeVector corner = rotation * G4ThreeVector(n_corner & 1 ? local_max.x() : local_min.x(), n_corner & 2 ? local_max.y() : local_min.y(), n_corner & 4 ? local_max.z() : local_min.z()) + translation;
+      world_min.set(std::min(world_min.x(), corner.x()), std::min(world_min.y(), corner.y()), std::min(world_min.z(), corner.z()));
+      world_max.set(std::max(world_max.x(), corner.x()), std::max(world_max.y(), corner.y()), std::max(world_max.z(), corner.z()));
+    }
+
+    placement.box_min.set(std::max(world_min.x(), container_min.x()), std::max(world_min.y(), container_min.y()), std::max(world_min.z(), container_min.z()));
+    placement.box_max.set(std::min(world_max.x(), container_max.x()), std::min(world_max.y(), container_max.y()), std::min(world_max.z(), container_max.z()));
+    placement.clipped = placement.box_min != world_min || placement.box_max != world_max;
+
+    placement.n_tries = 0;
+    placement.n_accepted = 0;
+
+    placements.push_back(placement);
+  }
+
+  for (size_t i = 0; i < logical_volume->GetNoDaughters(); ++i) {
+    G4VPhysicalVolume *daughter = logical_volume->GetDaughter(i);
+    // The position of a replica is not unique, so their daughters are not searched
+    if (daughter->IsReplicated())
+      continue;
+    find_placements(daughter, rotation * daughter->GetObjectRotationValue(), rotation * daughter->GetObjectTranslation() + translation, source_PV_names);
+  }
+}
+
+G4bool SourceVolumeSampler::TrySample(G4ThreeVector &position) {
+  size_t n_placement = std::upper_bound(cumulative_volume.begin(), cumulative_volume.end(), uniform_random() * cumulative_volume.back()) - cumulative_volume.begin();
+  if (n_placement == placements.size())
+    n_placement = placements.size() - 1;
+  Placement &placement = placements[n_placement];
+
+  ++placement.n_tries;
+
+  G4ThreeVector global(placement.box_min.x() + uniform_random() * (placement.box_max.x() - placement.box_min.x()),
+                       placement.box_min.y() + uniform_random() * (placement.box_max.y() - placement.box_min.y()),
+                       placement.box_min.z() + uniform_random() * (placement.box_max.z() - placement.box_min.z()));
+  G4ThreeVector local = placement.inverse_rotation * (global - placement.translation);
+
+  if (placement.physical_volume->GetLogicalVolume()->GetSolid()->Inside(local) != kInside)
+    return false;
+  for (auto daughter : placement.daughters) {
+    if (daughter.solid->Inside(daughter.inverse_rotation * (local - daughter.translation)) != kOutside)
+      return false;
+  }
+
+  ++placement.n_accepted;
+  position = global;
+  return true;
+}
+
+G4bool SourceVolumeSampler::Sample(G4ThreeVector &position, G4int max_tries) {
+  for (G4int i = 0; i < max_tries; ++i) {
+    if (TrySample(position))
+      return true;
+  }
+  return false;
+}
+
+unsigned long SourceVolumeSampler::GetNTries() const {
+  unsigned long n_tries = 0;
+  for (auto placement : placements)
+    n_tries += placement.n_tries;
+  return n_tries;
+}
+
+unsigned long SourceVolumeSampler::GetNAccepted() const {
+  unsigned long n_accepted = 0;
+  for (auto placement : placements)
+    n_accepted += placement.n_accepted;
+  return n_accepted;
+}
+
+G4double SourceVolumeSampler::GetAcceptance() const {
+  unsigned long n_tries = GetNTries();
+  if (n_tries == 0)
+    return 0.;
+  return (G4double)GetNAccepted() / n_tries;
+}
+
+void SourceVolumeSampler::ResetStatistics() {
+  for (auto &placement : placements) {
+    placement.n_tries = 0;
+    placement.n_accepted = 0;
+  }
+}
+
+void SourceVolumeSampler::AddStatistics(const SourceVolumeSampler &copy) {
+  for (size_t i = 0; i < placements.size(); ++i) {
+    placements[i].n_tries += copy.placements[i].n_tries;
+    placements[i].n_accepted += copy.placements[i].n_accepted;
+  }
+}
+
+G4bool SourceVolumeSampler::IsClipped() const {
+  for (auto placement : placements) {
+    if (placement.clipped)
+      return true;
+  }
+  return false;
+}
+
+void SourceVolumeSampler::PrintStatistics() const {
+  for (auto placement : placements) {
+    G4cout << "Volume " << placement.physical_volume->GetName() << " (copy " << placement.physical_volume->GetCopyNo() << ")" << G4endl;
+    G4cout << "\tSampling box : [ " << placement.box_min.x() / mm << ", " << placement.box_max.x() / mm << " ] x [ "
+           << placement.box_min.y() / mm << ", " << placement.box_max.y() / mm << " ] x [ "
+           << placement.box_min.z() / mm << ", " << placement.box_max.z() / mm << " ] mm^3";
+    if (placement.clipped)
+      G4cout << " (clipped by the container box)";
+    G4cout << G4endl;
+    G4cout << "\tAcceptance   : " << placement.n_accepted << " / " << placement.n_tries;
+    if (placement.n_tries > 0)
+      G4cout << " ( " << (G4double)placement.n_accepted / placement.n_tries / perCent << " % )";
+    G4cout << G4endl;
+  }
+}
@@ -0,0 +1,125 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "G4Electron.hh"
+#include "G4Gamma.hh"
+#include "G4Positron.hh"
+#include "G4Run.hh"
+#include "G4RunManager.hh"
+#include "G4SystemOfUnits.hh"
+#include "G4Track.hh"
+
+#include "StackingAction.hh"
+#include "utrConfig.h"
+
+G4bool StackingAction::culling = false;
+G4double StackingAction::culling_energy = 0.;
+G4double StackingAction::culling_margin = 0.;
+
+G4ThreadLocal unsigned long StackingAction::n_examined = 0;
+G4ThreadLocal unsigned long StackingAction::n_killed = 0;
+G4ThreadLocal G4double StackingAction::killed_energy = 0.;
+
+unsigned long StackingAction::total_examined = 0;
+unsigned long StackingAction::total_killed = 0;
+G4double StackingAction::total_killed_energy = 0.;
+size_t StackingAction::n_detectors = 0;
+std::mutex StackingAction::statistics_mutex;
+
+StackingAction::StackingAction() : G4UserStackingAction(), acceptance_run_ID(-1) {}
+
+StackingAction::~StackingAction() {}
+
+void StackingAction::PrepareNewEvent() {
+  if (!culling) {
+    return;
+  }
+
+  // The sensitive detectors of a thread exist only after its geometry has been constructed,
+  // so the acceptance is determined at the first event of each run
+  const G4int run_ID = G4RunManager::GetRunManager()->GetCurrentRun()->GetRunID();
+  if (run_ID != acceptance_run_ID) {
+    acceptance.Build();
+    acceptance.SetMargin(culling_margin);
+    acceptance_run_ID = run_ID;
+
+    std::lock_guard<std::mutex> lock(statistics_mutex);
+    n_detectors = acceptance.GetNDetectors();
+  }
+}
+
+G4ClassificationOfNewTrack StackingAction::ClassifyNewTrack(const G4Track *track) {
+#ifdef PHYSICS_LEAN
+  // Without hadronic physics, the hadrons and nuclei from photonuclear reactions would only
+  // be transported through the geometry without any interaction
+  if (track->GetParentID() != 0 && track->GetDefinition() != G4Gamma::Definition() && track->GetDefinition() != G4Electron::Definition() &&
+      track->GetDefinition() != G4Positron::Definition()) {
+    return fKill;
+  }
+#endif
+
+  if (!culling || track->GetParentID() == 0 || track->GetDefinition() != G4Gamma::Definition()) {
+    return fUrgent;
+  }
+
+  ++n_examined;
+  if (track->GetKineticEnergy() >= culling_energy || acceptance.CanReach(track->GetPosition(), track->GetMomentumDirection())) {
+    return fUrgent;
+  }
+
+  ++n_killed;
+  killed_energy += track->GetKineticEnergy();
+  return fKill;
+}
+
+void StackingAction::MergeStatistics() {
+  std::lock_guard<std::mutex> lock(statistics_mutex);
+  total_examined += n_examined;
+  total_killed += n_killed;
+  total_killed_energy += killed_energy;
+  n_examined = 0;
+  n_killed = 0;
+  killed_energy = 0.;
+}
+
+void StackingAction::PrintStatistics() {
+  if (!culling) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(statistics_mutex);
+  G4cout << "================================================================================" << G4endl;
+  G4cout << "StackingAction: Culling of secondary photons below " << culling_energy / keV << " keV which cannot reach any of " << n_detectors << " sensitive volumes" << G4endl;
+  if (n_detectors == 0) {
+    G4cout << "WARNING: StackingAction: No sensitive volumes found, no photons were killed" << G4endl;
+  }
+  G4cout << "\tExamined secondary photons : " << total_examined << G4endl;
+  G4cout << "\tKilled secondary photons   : " << total_killed;
+  if (total_examined > 0) {
+    G4cout << " (" << 100. * total_killed / total_examined << " %)";
+  }
+  G4cout << G4endl;
+  G4cout << "\tTotal energy of the killed photons : " << total_killed_energy / MeV << " MeV" << G4endl;
+  G4cout << "================================================================================" << G4endl;
+
+  total_examined = 0;
+  total_killed = 0;
+  total_killed_energy = 0.;
+}
@@ -0,0 +1,161 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "G4Electron.hh"
+#include "G4LogicalVolume.hh"
+#include "G4LossTableManager.hh"
+#include "G4Positron.hh"
+#include "G4Step.hh"
+#include "G4SystemOfUnits.hh"
+#include "G4Track.hh"
+#include "G4VPhysicalVolume.hh"
+
+#include "SteppingAction.hh"
+#include "SteppingProfiler.hh"
+#include "utrRegions.hh"
+
+G4bool SteppingAction::range_rejection = false;
+G4double SteppingAction::max_energy = DBL_MAX;
+G4bool SteppingAction::reject_positrons = false;
+
+G4ThreadLocal unsigned long SteppingAction::n_steps = 0;
+G4ThreadLocal unsigned long SteppingAction::n_electron_steps = 0;
+G4ThreadLocal G4double SteppingAction::electron_step_length = 0.;
+G4ThreadLocal unsigned long SteppingAction::n_rejected = 0;
+G4ThreadLocal G4double SteppingAction::rejected_energy = 0.;
+G4ThreadLocal G4double SteppingAction::rejected_range = 0.;
+G4ThreadLocal G4double SteppingAction::start_time = 0.;
+
+unsigned long SteppingAction::total_steps = 0;
+unsigned long SteppingAction::total_electron_steps = 0;
+G4double SteppingAction::total_electron_step_length = 0.;
+unsigned long SteppingAction::total_rejected = 0;
+G4double SteppingAction::total_rejected_energy = 0.;
+G4double SteppingAction::total_rejected_range = 0.;
+G4double SteppingAction::total_seconds = 0.;
+size_t SteppingAction::n_detectors = 0;
+std::mutex SteppingAction::statistics_mutex;
+
+SteppingAction::SteppingAction() : G4UserSteppingAction() {}
+
+SteppingAction::~SteppingAction() {}
+
+void SteppingAction::UserSteppingAction(const G4Step *step) {
+  if (SteppingProfiler::GetEnabled()) {
+    SteppingProfiler::CountStep(step);
+  }
+  if (utrRegions::GetStatistics()) {
+    utrRegions::CountStep(step);
+  }
+
+  if (!range_rejection) {
+    return;
+  }
+
+  // The first step of a thread in a run. The sensitive detectors of a thread exist only
+  // after its geometry has been constructed, so the acceptance is determined here.
+  if (n_steps == 0) {
+    start_time = now();
+    acceptance.Build();
+
+    std::lock_guard<std::mutex> lock(statistics_mutex);
+    n_detectors = acceptance.GetNDetectors();
+  }
+  ++n_steps;
+
+  G4Track *track = step->GetTrack();
+  const G4ParticleDefinition *particle = track->GetDefinition();
+  if (particle != G4Electron::Definition() && (!reject_positrons || particle != G4Positron::Definition())) {
+    return;
+  }
+  ++n_electron_steps;
+  electron_step_length += step->GetStepLength();
+
+  // The volume after the step, which is nullptr if the particle left the world
+  G4VPhysicalVolume *volume = track->GetVolume();
+  const G4double kinetic_energy = track->GetKineticEnergy();
+  if (volume == nullptr || kinetic_energy <= 0. || kinetic_energy > max_energy || volume->GetLogicalVolume()->GetSensitiveDetector() != nullptr) {
+    return;
+  }
+
+  const G4double range = G4LossTableManager::Instance()->GetRange(particle, kinetic_energy, track->GetMaterialCutsCouple());
+  if (!acceptance.IsFartherThan(track->GetPosition(), range)) {
+    return;
+  }
+
+  track->SetTrackStatus(fStopAndKill);
+  ++n_rejected;
+  rejected_energy += kinetic_energy;
+  rejected_range += range;
+}
+
+void SteppingAction::MergeStatistics() {
+  std::lock_guard<std::mutex> lock(statistics_mutex);
+  total_steps += n_steps;
+  total_electron_steps += n_electron_steps;
+  total_electron_step_length += electron_step_length;
+  total_rejected += n_rejected;
+  total_rejected_energy += rejected_energy;
+  total_rejected_range += rejected_range;
+  if (n_steps > 0) {
+    total_seconds += now() - start_time;
+  }
+  n_steps = 0;
+  n_electron_steps = 0;
+  electron_step_length = 0.;
+  n_rejected = 0;
+  rejected_energy = 0.;
+  rejected_range = 0.;
+}
+
+void SteppingAction::PrintStatistics() {
+  if (!range_rejection) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(statistics_mutex);
+  G4cout << "================================================================================" << G4endl;
+  G4cout << "SteppingAction: Range rejection of " << (reject_positrons ? "electrons and positrons" : "electrons");
+  if (max_energy < DBL_MAX) {
+    G4cout << " below " << max_energy / keV << " keV";
+  }
+  G4cout << " which cannot reach any of " << n_detectors << " sensitive volumes" << G4endl;
+  if (n_detectors == 0) {
+    G4cout << "WARNING: SteppingAction: No sensitive volumes found, no tracks were killed" << G4endl;
+  }
+  G4cout << "\tRejected tracks                      : " << total_rejected << G4endl;
+  G4cout << "\tEnergy deposited by rejected tracks  : " << total_rejected_energy / MeV << " MeV" << G4endl;
+  if (total_electron_steps > 0 && total_steps > 0 && total_electron_step_length > 0.) {
+    const G4double mean_step_length = total_electron_step_length / total_electron_steps;
+    const G4double saved_steps = total_rejected_range / mean_step_length;
+    const G4double seconds_per_step = total_seconds / total_steps;
+    G4cout << "\tEstimated saved steps                : " << saved_steps << " (" << 100. * saved_steps / (total_steps + saved_steps) << " %)" << G4endl;
+    G4cout << "\tEstimated saved CPU time             : " << saved_steps * seconds_per_step << " s (summed over all threads)" << G4endl;
+  }
+  G4cout << "================================================================================" << G4endl;
+
+  total_steps = 0;
+  total_electron_steps = 0;
+  total_electron_step_length = 0.;
+  total_rejected = 0;
+  total_rejected_energy = 0.;
+  total_rejected_range = 0.;
+  total_seconds = 0.;
+}
@@ -0,0 +1,138 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <iomanip>
+#include <utility>
+#include <vector>
+
+#include "G4StepPoint.hh"
+#include "G4VPhysicalVolume.hh"
+
+#include "SteppingProfiler.hh"
+
+using std::vector;
+
+G4bool SteppingProfiler::enabled = false;
+G4int SteppingProfiler::n_rows = 20;
+
+G4ThreadLocal SteppingProfiler::ThreadProfile *SteppingProfiler::profile = nullptr;
+
+std::map<std::tuple<const G4LogicalVolume *, const G4Material *, const G4ParticleDefinition *, G4String>, SteppingProfiler::Counts> SteppingProfiler::total;
+std::mutex SteppingProfiler::statistics_mutex;
+
+void SteppingProfiler::BeginOfEvent() {
+  if (profile == nullptr) {
+    profile = new ThreadProfile;
+  }
+  profile->last_time = std::chrono::steady_clock::now();
+}
+
+void SteppingProfiler::CountStep(const G4Step *step) {
+  const auto now = std::chrono::steady_clock::now();
+  if (profile == nullptr) {
+    // The profiler was enabled during an event
+    profile = new ThreadProfile;
+    profile->last_time = now;
+  }
+
+  const G4StepPoint *pre_step_point = step->GetPreStepPoint();
+  const Key key = {pre_step_point->GetPhysicalVolume()->GetLogicalVolume(), pre_step_point->GetMaterial(), step->GetTrack()->GetDefinition(), step->GetPostStepPoint()->GetProcessDefinedStep()};
+  Counts &counts = profile->counts[key];
+  ++counts.steps;
+  counts.seconds += std::chrono::duration<G4double>(now - profile->last_time).count();
+  profile->last_time = now;
+}
+
+void SteppingProfiler::MergeStatistics() {
+  if (profile == nullptr) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(statistics_mutex);
+  for (auto &entry : profile->counts) {
+    const G4String process_name = entry.first.process != nullptr ? entry.first.process->GetProcessName() : G4String("none");
+    Counts &counts = total[std::make_tuple(entry.first.volume, entry.first.material, entry.first.particle, process_name)];
+    counts.steps += entry.second.steps;
+    counts.seconds += entry.second.seconds;
+  }
+  profile->counts.clear();
+}
+
+// Print the entries with the most steps
+static void print_table(const G4String &title, const std::map<G4String, std::pair<unsigned long, G4double>> &table, unsigned long sum_steps, G4double sum_seconds, G4int n_rows) {
+  vector<std::pair<G4String, std::pair<unsigned long, G4double>>> rows(table.begin(), table.end());
+  std::sort(rows.begin(), rows.end(), [](const auto &a, const auto &b) { return a.second.first > b.second.first; });
+
+  G4cout << title << G4endl;
+  G4cout << "\t" << std::left << std::setw(48) << "" << std::right << std::setw(14) << "steps" << std::setw(9) << "%" << std::setw(12) << "time [s]" << std::setw(9) << "%" << std::setw(13) << "time/step" << G4endl;
+  for (size_t i = 0; i < rows.size() && i < (size_t)n_rows; ++i) {
+    const unsigned long steps = rows[i].second.first;
+    const G4double seconds = rows[i].second.second;
+    G4cout << "\t" << std::left << std::setw(48) << rows[i].first << std::right << std::fixed
+           << std::setw(14) << steps << std::setw(8) << std::setprecision(1) << 100. * (G4double)steps / (G4double)sum_steps << "%"
+           << std::setw(12) << std::setprecision(2) << seconds << std::setw(8) << std::setprecision(1) << (sum_seconds > 0. ? 100. * seconds / sum_seconds : 0.) << "%"
+           << std::setw(10) << std::setprecision(2) << 1e6 * seconds / (G4double)steps << " us" << G4endl;
+  }
+  if (rows.size() > (size_t)n_rows) {
+    G4cout << "\t(" << rows.size() - (size_t)n_rows << " more)" << G4endl;
+  }
+}
+
+void SteppingProfiler::PrintStatistics() {
+  if (!enabled) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(statistics_mutex);
+  unsigned long sum_steps = 0;
+  G4double sum_seconds = 0.;
+  std::map<G4String, std::pair<unsigned long, G4double>> by_volume, by_material, by_particle, by_process, by_combination;
+  for (auto &entry : total) {
+    const G4String volume = std::get<0>(entry.first)->GetName();
+    const G4String material = std::get<1>(entry.first) != nullptr ? std::get<1>(entry.first)->GetName() : G4String("none");
+    const G4String particle = std::get<2>(entry.first)->GetParticleName();
+    const G4String &process = std::get<3>(entry.first);
+    const auto add = [&entry](std::map<G4String, std::pair<unsigned long, G4double>> &table, const G4String &name) {
+      table[name].first += entry.second.steps;
+      table[name].second += entry.second.seconds;
+    };
+    add(by_volume, volume);
+    add(by_material, material);
+    add(by_particle, particle);
+    add(by_process, process);
+    add(by_combination, particle + " in " + volume + " (" + material + ")");
+    sum_steps += entry.second.steps;
+    sum_seconds += entry.second.seconds;
+  }
+  total.clear();
+  if (sum_steps == 0) {
+    return;
+  }
+
+  G4cout << "================================================================================" << G4endl;
+  G4cout << "SteppingProfiler: " << sum_steps << " steps, " << std::fixed << std::setprecision(2) << sum_seconds << " s (summed over all threads)" << G4endl;
+  print_table("Logical volumes", by_volume, sum_steps, sum_seconds, n_rows);
+  print_table("Materials", by_material, sum_steps, sum_seconds, n_rows);
+  print_table("Particles", by_particle, sum_steps, sum_seconds, n_rows);
+  print_table("Processes which limited the step", by_process, sum_steps, sum_seconds, n_rows);
+  print_table("Particles in logical volumes", by_combination, sum_steps, sum_seconds, n_rows);
+  G4cout << "================================================================================" << G4endl;
+}
@@ -30,10 +30,8 @@ along with utr.  If not, see <http://www.gnu.org/licenses/>.
 #include "Physics.hh"
 #include "utrFilenameTools.hh"
 #include "utrMessenger.hh"
-
-#ifdef EVENT_EVENTWISE
-#include "EnergyDepositionSD.hh"
-#endif
+#include "utrRandom.hh"
+#include "utrWorkerThreadInitialization.hh"
 
 #include "G4UIExecutive.hh"
 #include "G4UImanager.hh"
@@ -42,7 +40,6 @@ along with utr.  If not, see <http://www.gnu.org/licenses/>.
 #include <dirent.h>
 #include <sys/stat.h>
 #include <sys/types.h>
-#include <time.h>
 
 using namespace std;
 
@@ -55,6 +52,8 @@ static struct argp_option options[] = {
     {"nthreads", 't', "THREAD", 0, "Number of threads", 0},
     {"outputdir", 'o', "OUTPUTDIR", 0, "Output directory", 0},
     {"filename", 'f', "PREFIX", 0, "Output files' name prefix", 0},
+    {"seed", 's', "SEED", 0, "Seed of the random number generator. Each event is seeded with a seed derived from SEED, the shard, the run and the event ID (default: time, no per-event seeds)", 0},
+    {"shard", 'S', "I/N", 0, "Simulate shard I of N (0 <= I < N) with independent seeds, and tag the output files with '_shard<I>of<N>' (requires --seed)", 0},
     {0, 0, 0, 0, 0, 0}};
 
 struct arguments {
@@ -62,6 +61,8 @@ struct arguments {
   char *macrofile = 0;
   string outputdir = "output";
   string filenameprefix = "utr";
+  char *seed = 0;
+  char *shard = 0;
 };
 
 static error_t parse_opt(int key, char *arg, struct argp_state *state) {
@@ -79,6 +80,12 @@ static error_t parse_opt(int key, char *arg, struct argp_state *state) {
     case 'f':
       arguments->filenameprefix = arg;
       break;
+    case 's':
+      arguments->seed = arg;
+      break;
+    case 'S':
+      arguments->shard = arg;
+      break;
     default:
       return ARGP_ERR_UNKNOWN;
   }
@@ -92,12 +99,29 @@ int main(int argc, char *argv[]) {
   struct arguments arguments;
   argp_parse(&argp, argc, argv, 0, 0, &arguments);
 
-  G4Random::setTheEngine(new CLHEP::RanecuEngine);
-  // 'Real' random results
-  time_t timer;
-  G4Random::setTheSeed(time(&timer));
-  // Deterministic results
-  // G4Random::setTheSeed(1);
+  if (arguments.seed) {
+    char *end;
+    const unsigned long long seed = strtoull(arguments.seed, &end, 10);
+    if (*end != '\0' || end == arguments.seed) {
+      G4cerr << "ERROR: Invalid seed '" << arguments.seed << "'! Aborting..." << G4endl;
+      return 1;
+    }
+    utrRandom::SetSeed(seed);
+  }
+  if (arguments.shard) {
+    if (!arguments.seed) {
+      G4cerr << "ERROR: A sharded simulation requires a seed (--seed)! Aborting..." << G4endl;
+      return 1;
+    }
+    if (!utrRandom::SetShard(arguments.shard)) {
+      G4cerr << "ERROR: Invalid shard '" << arguments.shard << "', expected I/N with 0 <= I < N! Aborting..." << G4endl;
+      return 1;
+    }
+  }
+
+  // Seeded from the time, or deterministically if a seed was given.
+  // The engine of the master thread may be replaced later with /utr/random/engine.
+  utrRandom::SetupMasterEngine();
 
   // Pass output directory and filenamePrefix to RunAction via utrFilenameTools, also find next free filename ID
   utrFilenameTools::setOutputDir(arguments.outputdir);
@@ -107,6 +131,7 @@ int main(int argc, char *argv[]) {
 #ifdef G4MULTITHREADED
   G4MTRunManager *runManager = new G4MTRunManager;
   runManager->SetNumberOfThreads(arguments.nthreads);
+  runManager->SetUserInitialization(new utrWorkerThreadInitialization);
 #else
   G4RunManager *runManager = new G4RunManager;
 #endif
@@ -123,11 +148,6 @@ int main(int argc, char *argv[]) {
   actionInitialization->setNThreads(arguments.nthreads);
   runManager->SetUserInitialization(actionInitialization);
 
-#ifdef EVENT_EVENTWISE
-  G4cout << "Initializing EnergyDepositionSD::anyDetectorHitInEvent vector..." << G4endl;
-  EnergyDepositionSD::anyDetectorHitInEvent = std::vector<bool>(arguments.nthreads, false);
-#endif
-
   if (!arguments.macrofile) {
     G4cout << "Initializing VisManager" << G4endl;
     G4VisManager *visManager = new G4VisExecutive;
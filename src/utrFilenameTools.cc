@@ -19,6 +19,7 @@ along with utr.  If not, see <http://www.gnu.org/licenses/>.
 */
 
 #include "utrFilenameTools.hh"
+#include "utrRandom.hh"
 
 #include "G4FileUtilities.hh"
 #include "globals.hh"
@@ -44,26 +45,45 @@ string utrFilenameTools::masterFilename = "";
 unsigned int utrFilenameTools::findNextFreeFilenameID() {
   // Determine the next free filename (with ID) by searching for files with the name
   // '{utrFilenameTools::filenamePrefix}N.root' or '{utrFilenameTools::filenamePrefix}N_t0.root' in the requested directory
+  // (or '{utrFilenameTools::filenamePrefix}N_t0.utrc' and '{utrFilenameTools::filenamePrefix}N_hist.root' for the columnar and histogram output formats)
+  // In sharded simulations, the shard tag follows N.
   G4FileUtilities fileutil;
   stringstream filename_single;
   stringstream filename_multi;
+  stringstream filename_columnar;
+  stringstream filename_histogram;
+  const string shardTag = utrRandom::GetShardTag();
   unsigned int fid = 0;
   for (fid = 0; fid < INT_MAX; ++fid) {
-    filename_single << outputDir << "/" << filenamePrefix << fid << ".root";
-    filename_multi << outputDir << "/" << filenamePrefix << fid << "_t0.root";
+    filename_single << outputDir << "/" << filenamePrefix << fid << shardTag << ".root";
+    filename_multi << outputDir << "/" << filenamePrefix << fid << shardTag << "_t0.root";
+    filename_columnar << outputDir << "/" << filenamePrefix << fid << shardTag << "_t0.utrc";
+    filename_histogram << outputDir << "/" << filenamePrefix << fid << shardTag << "_hist.root";
 
-    if (fileutil.FileExists(filename_single.str()) || fileutil.FileExists(filename_multi.str())) {
+    if (fileutil.FileExists(filename_single.str()) || fileutil.FileExists(filename_multi.str()) || fileutil.FileExists(filename_columnar.str()) || fileutil.FileExists(filename_histogram.str())) {
       filename_single.str("");
       filename_multi.str("");
+      filename_columnar.str("");
+      filename_histogram.str("");
       continue;
     }
     break;
   }
-  G4cout << "Using file name prefix '" << filenamePrefix << fid << "' ..." << G4endl;
+  G4cout << "Using file name prefix '" << filenamePrefix << fid << shardTag << "' ..." << G4endl;
   filenameID = fid - 1;
   return fid;
 }
 
+string utrFilenameTools::getRunName() {
+  stringstream runName;
+  runName << filenamePrefix;
+  if (useFilenameID) {
+    runName << filenameID;
+  }
+  runName << utrRandom::GetShardTag();
+  return runName.str();
+}
+
 bool utrFilenameTools::setOutputDir(string odir) {
   // If output directory does not exists try to create it
   if (!opendir(odir.c_str())) {
@@ -21,7 +21,22 @@ along with utr.  If not, see <http://www.gnu.org/licenses/>.
 #include "utrMessenger.hh"
 #include "G4UIcmdWithAnInteger.hh"
 #include "G4UImanager.hh"
+#include "BrickEnvelope.hh"
+#include "EmRegionalPhysics.hh"
+#include "EventTimer.hh"
+#include "GeometryDetail.hh"
+#include "NavigationBenchmark.hh"
+#include "OutputWriter.hh"
+#include "PhysicsTableCache.hh"
+#include "ProgressMonitor.hh"
+#include "StackingAction.hh"
+#include "SteppingAction.hh"
+#include "SteppingProfiler.hh"
+#include "G4SystemOfUnits.hh"
+#include "G4Threading.hh"
 #include "utrFilenameTools.hh"
+#include "utrRandom.hh"
+#include "utrRegions.hh"
 
 utrMessenger::utrMessenger() {
   utrDirectory = new G4UIdirectory("/utr/");
@@ -40,11 +55,262 @@ utrMessenger::utrMessenger() {
   appendZerosToVarCmd = new G4UIcmdWithAString("/utr/appendZerosToVar", this);
   appendZerosToVarCmd->SetGuidance("Set an UI/macro alias (a variable) to the given numerical value appending a decimal dot and the requested number of zeros if necessary");
   appendZerosToVarCmd->SetParameterName("variableName> <variableValue> <numberOfDecimalDigits", false);
+
+  outputDirectory = new G4UIdirectory("/utr/output/");
+  outputDirectory->SetGuidance("Controls for the output files.");
+
+  outputFormatCmd = new G4UIcmdWithAString("/utr/output/format", this);
+  outputFormatCmd->SetGuidance("Set the format of the output files of the following runs (default: root)\n'root': ROOT n-tuple of double values, one file per thread\n'columnar': binary file with typed columns (see OutputProcessing/ColumnarReader.hh), one file <prefix>_t<thread>.utrc per worker thread\n'histogram': histograms of the energy deposition in each detector, like the output of getHistogram, in a single file <prefix>_hist.root");
+  outputFormatCmd->SetParameterName("format", false);
+  outputFormatCmd->SetCandidates("root columnar histogram");
+
+  histogramDirectory = new G4UIdirectory("/utr/output/histogram/");
+  histogramDirectory->SetGuidance("Binning of the histograms of the 'histogram' output format. The histograms of detector 0 to maxID and their sum are written.");
+
+  histogramBinWidthCmd = new G4UIcmdWithADoubleAndUnit("/utr/output/histogram/binWidth", this);
+  histogramBinWidthCmd->SetGuidance("Set the bin width of the histograms. The first bin is centered around 0. (default: 1 keV)");
+  histogramBinWidthCmd->SetParameterName("binWidth", false);
+  histogramBinWidthCmd->SetRange("binWidth > 0.");
+  histogramBinWidthCmd->SetDefaultUnit("keV");
+
+  histogramEMaxCmd = new G4UIcmdWithADoubleAndUnit("/utr/output/histogram/eMax", this);
+  histogramEMaxCmd->SetGuidance("Set the maximum energy of the histograms, which is rounded up to match the bin width (default: 10 MeV)");
+  histogramEMaxCmd->SetParameterName("eMax", false);
+  histogramEMaxCmd->SetRange("eMax > 0.");
+  histogramEMaxCmd->SetDefaultUnit("MeV");
+
+  histogramMaxIDCmd = new G4UIcmdWithAnInteger("/utr/output/histogram/maxID", this);
+  histogramMaxIDCmd->SetGuidance("Set the highest detector ID for which a histogram is created. A negative value selects the highest ID of the sensitive detectors in the DetectorConstruction (default: -1)");
+  histogramMaxIDCmd->SetParameterName("maxID", false);
+
+  cullingDirectory = new G4UIdirectory("/utr/culling/");
+  cullingDirectory->SetGuidance("Kill secondary photons below an energy threshold whose straight path cannot reach any sensitive detector.");
+
+  cullingEnableCmd = new G4UIcmdWithABool("/utr/culling/enable", this);
+  cullingEnableCmd->SetGuidance("Enable the culling of secondary photons (default: false)");
+  cullingEnableCmd->SetParameterName("enable", true);
+  cullingEnableCmd->SetDefaultValue(true);
+
+  cullingEnergyCmd = new G4UIcmdWithADoubleAndUnit("/utr/culling/energy", this);
+  cullingEnergyCmd->SetGuidance("Only secondary photons below this energy are killed (default: 0 keV, i.e. no photon is killed)");
+  cullingEnergyCmd->SetParameterName("energy", false);
+  cullingEnergyCmd->SetRange("energy >= 0.");
+  cullingEnergyCmd->SetDefaultUnit("keV");
+
+  cullingMarginCmd = new G4UIcmdWithADoubleAndUnit("/utr/culling/margin", this);
+  cullingMarginCmd->SetGuidance("Increase the radius of the spheres around the sensitive volumes by this margin (default: 0 mm)");
+  cullingMarginCmd->SetParameterName("margin", false);
+  cullingMarginCmd->SetRange("margin >= 0.");
+  cullingMarginCmd->SetDefaultUnit("mm");
+
+  rangeRejectionDirectory = new G4UIdirectory("/utr/rangeRejection/");
+  rangeRejectionDirectory->SetGuidance("Kill electrons outside of the sensitive volumes whose range is shorter than the distance to any sensitive volume.");
+
+  rangeRejectionEnableCmd = new G4UIcmdWithABool("/utr/rangeRejection/enable", this);
+  rangeRejectionEnableCmd->SetGuidance("Enable the range rejection (default: false)");
+  rangeRejectionEnableCmd->SetParameterName("enable", true);
+  rangeRejectionEnableCmd->SetDefaultValue(true);
+
+  rangeRejectionMaxEnergyCmd = new G4UIcmdWithADoubleAndUnit("/utr/rangeRejection/maxEnergy", this);
+  rangeRejectionMaxEnergyCmd->SetGuidance("Only kill particles below this kinetic energy, to preserve bremsstrahlung photons above this energy (default: no limit)");
+  rangeRejectionMaxEnergyCmd->SetParameterName("maxEnergy", false);
+  rangeRejectionMaxEnergyCmd->SetRange("maxEnergy > 0.");
+  rangeRejectionMaxEnergyCmd->SetDefaultUnit("keV");
+
+  rangeRejectionPositronsCmd = new G4UIcmdWithABool("/utr/rangeRejection/positrons", this);
+  rangeRejectionPositronsCmd->SetGuidance("Also kill positrons, which removes their annihilation photons (default: false)");
+  rangeRejectionPositronsCmd->SetParameterName("positrons", true);
+  rangeRejectionPositronsCmd->SetDefaultValue(true);
+
+  regionDirectory = new G4UIdirectory("/utr/region/");
+  regionDirectory->SetGuidance("Assign logical volumes to regions with their own production cuts. Only available before /run/initialize.");
+
+  regionAddVolumesCmd = new G4UIcmdWithAString("/utr/region/addVolumes", this);
+  regionAddVolumesCmd->SetGuidance("Assign all logical volumes whose name matches a pattern with wildcards (*, ?) to a region, for example '/utr/region/addVolumes shielding *Brick*'");
+  regionAddVolumesCmd->SetParameterName("region> <pattern", false);
+  regionAddVolumesCmd->AvailableForStates(G4State_PreInit);
+
+  regionAddMaterialCmd = new G4UIcmdWithAString("/utr/region/addMaterial", this);
+  regionAddMaterialCmd->SetGuidance("Assign all logical volumes whose material name matches a pattern with wildcards (*, ?) to a region, for example '/utr/region/addMaterial shielding G4_Pb'");
+  regionAddMaterialCmd->SetParameterName("region> <pattern", false);
+  regionAddMaterialCmd->AvailableForStates(G4State_PreInit);
+
+  regionSetCutCmd = new G4UIcmdWithAString("/utr/region/setCut", this);
+  regionSetCutCmd->SetGuidance("Set the production cut of all particles in a region, for example '/utr/region/setCut shielding 1 cm'. Regions without a cut use the default cut (/run/setCut).");
+  regionSetCutCmd->SetParameterName("region> <cut> <unit", false);
+  regionSetCutCmd->AvailableForStates(G4State_PreInit);
+
+  regionDetectorsCmd = new G4UIcmdWithABool("/utr/region/detectors", this);
+  regionDetectorsCmd->SetGuidance("Assign all logical volumes with a sensitive detector to the region 'detectors' (default: true)");
+  regionDetectorsCmd->SetParameterName("detectors", true);
+  regionDetectorsCmd->SetDefaultValue(true);
+  regionDetectorsCmd->AvailableForStates(G4State_PreInit);
+
+  regionStatisticsCmd = new G4UIcmdWithABool("/utr/region/statistics", this);
+  regionStatisticsCmd->SetGuidance("Print the number of steps and secondaries in each region at the end of a run (default: false)");
+  regionStatisticsCmd->SetParameterName("statistics", true);
+  regionStatisticsCmd->SetDefaultValue(true);
+
+  physicsDirectory = new G4UIdirectory("/utr/physics/");
+  physicsDirectory->SetGuidance("Controls for the physics list.");
+
+  polarizedRegionsCmd = new G4UIcmdWithAString("/utr/physics/polarizedRegions", this);
+  polarizedRegionsCmd->SetGuidance("Set the regions in which the EM_REGIONAL physics uses the polarized Livermore gamma models, separated by spaces (default: 'detectors target'). 'DefaultRegionForTheWorld' selects the whole geometry, 'none' no region.");
+  polarizedRegionsCmd->SetParameterName("regions", false);
+  polarizedRegionsCmd->AvailableForStates(G4State_PreInit);
+
+  tableCacheCmd = new G4UIcmdWithABool("/utr/physics/tableCache", this);
+  tableCacheCmd->SetGuidance("Store the physics tables in a cache directory after the first initialization and retrieve them at later starts with the same physics list, production cuts and materials (default: false)");
+  tableCacheCmd->SetParameterName("tableCache", true);
+  tableCacheCmd->SetDefaultValue(true);
+  tableCacheCmd->AvailableForStates(G4State_PreInit);
+
+  tableCacheDirectoryCmd = new G4UIcmdWithAString("/utr/physics/tableCacheDirectory", this);
+  tableCacheDirectoryCmd->SetGuidance("Set the directory of the physics table cache (default: $XDG_CACHE_HOME/utr or ~/.cache/utr)");
+  tableCacheDirectoryCmd->SetParameterName("directory", false);
+  tableCacheDirectoryCmd->AvailableForStates(G4State_PreInit);
+
+  geometryDirectory = new G4UIdirectory("/utr/geometry/");
+  geometryDirectory->SetGuidance("Controls for the construction of the geometry and the navigation in it.");
+
+  brickEnvelopesCmd = new G4UIcmdWithABool("/utr/geometry/brickEnvelopes", this);
+  brickEnvelopesCmd->SetGuidance("Collect the bricks of walls and lead castles in envelope volumes, if the DetectorConstruction defines envelopes (see BrickEnvelope.hh). Switching them off only changes the speed of the navigation (default: true)");
+  brickEnvelopesCmd->SetParameterName("brickEnvelopes", true);
+  brickEnvelopesCmd->SetDefaultValue(true);
+  brickEnvelopesCmd->AvailableForStates(G4State_PreInit);
+
+  detailCmd = new G4UIcmdWithAString("/utr/geometry/detail", this);
+  detailCmd->SetGuidance("Set the level of detail of distant support structures like the wheel and the tables (default given by the CMake option GEOMETRY_DETAIL)\n'full': all parts are constructed\n'homogenized': the parts are replaced by a single volume with a mixture of their materials and the same mass");
+  detailCmd->SetParameterName("detail", false);
+  detailCmd->SetCandidates("full homogenized");
+  detailCmd->AvailableForStates(G4State_PreInit);
+
+  g3SetupCmd = new G4UIcmdWithABool("/utr/geometry/g3Setup", this);
+  g3SetupCmd->SetGuidance("Construct the detectors, the target and the wheel at the g3 target position, if the DetectorConstruction supports it (default given by the CMake option USE_G3_SETUP)");
+  g3SetupCmd->SetParameterName("g3Setup", true);
+  g3SetupCmd->SetDefaultValue(true);
+  g3SetupCmd->AvailableForStates(G4State_PreInit);
+
+  secondSetupCmd = new G4UIcmdWithABool("/utr/geometry/secondSetup", this);
+  secondSetupCmd->SetGuidance("Construct the detectors, the target and table 2 at the second target position, if the DetectorConstruction supports it (default given by the CMake option USE_SECOND_SETUP)");
+  secondSetupCmd->SetParameterName("secondSetup", true);
+  secondSetupCmd->SetDefaultValue(true);
+  secondSetupCmd->AvailableForStates(G4State_PreInit);
+
+  navigationBenchmarkCmd = new G4UIcmdWithAnInteger("/utr/geometry/navigationBenchmark", this);
+  navigationBenchmarkCmd->SetGuidance("Locate the given number of random points in the world volume and transport geantinos from them, and print the time per point and per step");
+  navigationBenchmarkCmd->SetParameterName("nPoints", true);
+  navigationBenchmarkCmd->SetDefaultValue(100000);
+  navigationBenchmarkCmd->SetRange("nPoints > 0");
+  navigationBenchmarkCmd->AvailableForStates(G4State_Idle);
+
+  randomDirectory = new G4UIdirectory("/utr/random/");
+  randomDirectory->SetGuidance("Controls for the random number engines.");
+
+  randomEngineCmd = new G4UIcmdWithAString("/utr/random/engine", this);
+  randomEngineCmd->SetGuidance("Set the random number engine of all threads (default: mixmax)\n'ranecu': RanecuEngine, the former default of utr, with a period of about 2^60\n'mixmax': MixMaxRng, the default of Geant4\n'ranluxpp': RanluxppEngine (Geant4 10.7 or later)\n'philox': the counter-based engine Philox4x32-10 (see PhiloxEngine.hh)\nEach event is seeded individually, so every event uses its own stream of random numbers.");
+  randomEngineCmd->SetParameterName("engine", false);
+  randomEngineCmd->SetCandidates("ranecu mixmax ranluxpp philox");
+  randomEngineCmd->AvailableForStates(G4State_PreInit);
+
+  progressDirectory = new G4UIdirectory("/utr/progress/");
+  progressDirectory->SetGuidance("Controls for the progress reports during a run.");
+
+  progressIntervalCmd = new G4UIcmdWithADoubleAndUnit("/utr/progress/interval", this);
+  progressIntervalCmd->SetGuidance("Set the interval between two progress reports, 0 for a single report at the end of each run (default given by the CMake option PROGRESS_INTERVAL)");
+  progressIntervalCmd->SetParameterName("interval", false);
+  progressIntervalCmd->SetRange("interval >= 0.");
+  progressIntervalCmd->SetDefaultUnit("s");
+
+  progressJsonCmd = new G4UIcmdWithABool("/utr/progress/json", this);
+  progressJsonCmd->SetGuidance("Append the progress reports as JSON lines to the file <prefix><ID>_progress.jsonl in the output directory (default: false)");
+  progressJsonCmd->SetParameterName("json", true);
+  progressJsonCmd->SetDefaultValue(true);
+
+  profileDirectory = new G4UIdirectory("/utr/profile/");
+  profileDirectory->SetGuidance("Profile of the steps and the time of a run by logical volume, material, particle and process.");
+
+  profileEnableCmd = new G4UIcmdWithABool("/utr/profile/enable", this);
+  profileEnableCmd->SetGuidance("Count the steps and their wall time in each thread, and print a report at the end of each run (default: false)");
+  profileEnableCmd->SetParameterName("enable", true);
+  profileEnableCmd->SetDefaultValue(true);
+
+  profileRowsCmd = new G4UIcmdWithAnInteger("/utr/profile/rows", this);
+  profileRowsCmd->SetGuidance("Set the number of entries of each table of the report (default: 20)");
+  profileRowsCmd->SetParameterName("rows", false);
+  profileRowsCmd->SetRange("rows > 0");
+
+  eventTimingDirectory = new G4UIdirectory("/utr/eventTiming/");
+  eventTimingDirectory->SetGuidance("Wall time of the events, and capture of slow events for a replay with /utr/replayEvent.");
+
+  eventTimingHistogramCmd = new G4UIcmdWithABool("/utr/eventTiming/histogram", this);
+  eventTimingHistogramCmd->SetGuidance("Print a histogram of the wall time of the events at the end of each run (default: false)");
+  eventTimingHistogramCmd->SetParameterName("histogram", true);
+  eventTimingHistogramCmd->SetDefaultValue(true);
+
+  eventTimingSlowThresholdCmd = new G4UIcmdWithADoubleAndUnit("/utr/eventTiming/slowThreshold", this);
+  eventTimingSlowThresholdCmd->SetGuidance("Capture the events which take longer than this wall time with their primaries and the state of the random number engine, and write them to <prefix><ID>_slow_events.txt at the end of each run. 0 disables the capture (default: 0 s)");
+  eventTimingSlowThresholdCmd->SetParameterName("threshold", false);
+  eventTimingSlowThresholdCmd->SetRange("threshold >= 0.");
+  eventTimingSlowThresholdCmd->SetDefaultUnit("s");
+
+  eventTimingMaxSlowEventsCmd = new G4UIcmdWithAnInteger("/utr/eventTiming/maxSlowEvents", this);
+  eventTimingMaxSlowEventsCmd->SetGuidance("Set the maximum number of captured events per run. The slowest events are kept (default: 100)");
+  eventTimingMaxSlowEventsCmd->SetParameterName("maxSlowEvents", false);
+  eventTimingMaxSlowEventsCmd->SetRange("maxSlowEvents > 0");
+
+  replayEventCmd = new G4UIcmdWithAString("/utr/replayEvent", this);
+  replayEventCmd->SetGuidance("Simulate events from a file written by /utr/eventTiming/slowThreshold again, with their primaries and the state of the random number engine, and with the given level of /tracking/verbose (default: all events, verbose level 1). The geometry, physics and settings have to be the same as in the original run.");
+  replayEventCmd->SetParameterName("file> <event> <verbose", false);
+  replayEventCmd->AvailableForStates(G4State_Idle);
 }
 
 utrMessenger::~utrMessenger() {
   delete setFilenameCmd;
   delete setUseFilenameIDCmd;
+  delete histogramBinWidthCmd;
+  delete histogramEMaxCmd;
+  delete histogramMaxIDCmd;
+  delete cullingEnableCmd;
+  delete cullingEnergyCmd;
+  delete cullingMarginCmd;
+  delete cullingDirectory;
+  delete rangeRejectionEnableCmd;
+  delete rangeRejectionMaxEnergyCmd;
+  delete rangeRejectionPositronsCmd;
+  delete rangeRejectionDirectory;
+  delete regionAddVolumesCmd;
+  delete regionAddMaterialCmd;
+  delete regionSetCutCmd;
+  delete regionDetectorsCmd;
+  delete regionStatisticsCmd;
+  delete regionDirectory;
+  delete polarizedRegionsCmd;
+  delete tableCacheCmd;
+  delete tableCacheDirectoryCmd;
+  delete physicsDirectory;
+  delete brickEnvelopesCmd;
+  delete detailCmd;
+  delete g3SetupCmd;
+  delete secondSetupCmd;
+  delete navigationBenchmarkCmd;
+  delete geometryDirectory;
+  delete randomEngineCmd;
+  delete randomDirectory;
+  delete progressIntervalCmd;
+  delete progressJsonCmd;
+  delete progressDirectory;
+  delete profileEnableCmd;
+  delete profileRowsCmd;
+  delete profileDirectory;
+  delete eventTimingHistogramCmd;
+  delete eventTimingSlowThresholdCmd;
+  delete eventTimingMaxSlowEventsCmd;
+  delete eventTimingDirectory;
+  delete replayEventCmd;
+  delete histogramDirectory;
+  delete outputFormatCmd;
+  delete outputDirectory;
   delete utrDirectory;
 }
 
@@ -122,6 +388,122 @@ void utrMessenger::SetNewValue(G4UIcommand *command, G4String newValues) {
       G4UImanager *UImanager = G4UImanager::GetUIpointer();
       UImanager->ApplyCommand(aliasCommand.str());
     }
+  } else if (command == outputFormatCmd) {
+    G4cout << "Setting output format : '" << newValues << "'" << G4endl;
+    OutputWriter::SetFormat(newValues);
+  } else if (command == histogramBinWidthCmd) {
+    OutputWriter::SetHistogramBinWidth(histogramBinWidthCmd->GetNewDoubleValue(newValues));
+  } else if (command == histogramEMaxCmd) {
+    OutputWriter::SetHistogramEMax(histogramEMaxCmd->GetNewDoubleValue(newValues));
+  } else if (command == histogramMaxIDCmd) {
+    OutputWriter::SetHistogramMaxID(histogramMaxIDCmd->GetNewIntValue(newValues));
+  } else if (command == cullingEnableCmd) {
+    StackingAction::SetCulling(cullingEnableCmd->GetNewBoolValue(newValues));
+  } else if (command == cullingEnergyCmd) {
+    StackingAction::SetCullingEnergy(cullingEnergyCmd->GetNewDoubleValue(newValues));
+  } else if (command == cullingMarginCmd) {
+    StackingAction::SetCullingMargin(cullingMarginCmd->GetNewDoubleValue(newValues));
+  } else if (command == rangeRejectionEnableCmd) {
+    SteppingAction::SetRangeRejection(rangeRejectionEnableCmd->GetNewBoolValue(newValues));
+  } else if (command == rangeRejectionMaxEnergyCmd) {
+    SteppingAction::SetRangeRejectionMaxEnergy(rangeRejectionMaxEnergyCmd->GetNewDoubleValue(newValues));
+  } else if (command == rangeRejectionPositronsCmd) {
+    SteppingAction::SetRangeRejectionPositrons(rangeRejectionPositronsCmd->GetNewBoolValue(newValues));
+  } else if (command == regionAddVolumesCmd || command == regionAddMaterialCmd || command == regionSetCutCmd) {
+    std::vector<G4String> parameters;
+    std::istringstream iStrStream(newValues);
+    for (std::string s; iStrStream >> s;) {
+      parameters.push_back(s);
+    }
+    if (command == regionSetCutCmd && parameters.size() == 3) {
+      utrRegions::SetProductionCut(parameters[0], G4UIcommand::ConvertToDouble(parameters[1]) * G4UIcommand::ValueOf(parameters[2]));
+    } else if (command != regionSetCutCmd && parameters.size() == 2) {
+      if (command == regionAddVolumesCmd) {
+        utrRegions::AddVolumesByName(parameters[0], parameters[1]);
+      } else {
+        utrRegions::AddVolumesByMaterial(parameters[0], parameters[1]);
+      }
+    } else {
+      G4cerr << "Error! Wrong number of parameters!" << G4endl;
+    }
+  } else if (command == regionDetectorsCmd) {
+    utrRegions::SetAssignDetectors(regionDetectorsCmd->GetNewBoolValue(newValues));
+  } else if (command == regionStatisticsCmd) {
+    utrRegions::SetStatistics(regionStatisticsCmd->GetNewBoolValue(newValues));
+  } else if (command == polarizedRegionsCmd) {
+    std::vector<G4String> regions;
+    std::istringstream iStrStream(newValues);
+    for (std::string s; iStrStream >> s;) {
+      if (s != "none") {
+        regions.push_back(s);
+      }
+    }
+    EmRegionalPhysics::SetPolarizedRegions(regions);
+  } else if (command == tableCacheCmd) {
+    PhysicsTableCache::SetEnabled(tableCacheCmd->GetNewBoolValue(newValues));
+  } else if (command == tableCacheDirectoryCmd) {
+    PhysicsTableCache::SetDirectory(newValues);
+  } else if (command == brickEnvelopesCmd) {
+    BrickEnvelope::SetEnabled(brickEnvelopesCmd->GetNewBoolValue(newValues));
+  } else if (command == detailCmd) {
+    GeometryDetail::SetLevel(newValues);
+  } else if (command == g3SetupCmd || command == secondSetupCmd) {
+    if (!GeometryDetail::GetSetupSwitchesSupported()) {
+      G4cout << "Warning: " << command->GetCommandPath() << " has no effect, since the DetectorConstruction does not support the setup switches (see README.md)" << G4endl;
+    }
+    if (command == g3SetupCmd) {
+      GeometryDetail::SetG3Setup(g3SetupCmd->GetNewBoolValue(newValues));
+    } else {
+      GeometryDetail::SetSecondSetup(secondSetupCmd->GetNewBoolValue(newValues));
+    }
+  } else if (command == navigationBenchmarkCmd) {
+    NavigationBenchmark::Run(navigationBenchmarkCmd->GetNewIntValue(newValues));
+  } else if (command == eventTimingHistogramCmd) {
+    EventTimer::SetHistogram(eventTimingHistogramCmd->GetNewBoolValue(newValues));
+  } else if (command == eventTimingSlowThresholdCmd) {
+    EventTimer::SetSlowThreshold(eventTimingSlowThresholdCmd->GetNewDoubleValue(newValues));
+  } else if (command == eventTimingMaxSlowEventsCmd) {
+    EventTimer::SetMaxSlowEvents(eventTimingMaxSlowEventsCmd->GetNewIntValue(newValues));
+  } else if (command == replayEventCmd) {
+    std::vector<G4String> parameters;
+    std::istringstream iStrStream(newValues);
+    for (std::string s; iStrStream >> s;) {
+      parameters.push_back(s);
+    }
+    if (parameters.empty() || parameters.size() > 3) {
+      G4cerr << "Error! Wrong number of parameters!" << G4endl;
+      return;
+    }
+    const G4int n_events = EventTimer::LoadReplay(parameters[0], parameters.size() > 1 ? parameters[1] : G4String("all"));
+    if (n_events > 0) {
+      G4UImanager *UImanager = G4UImanager::GetUIpointer();
+      const G4String tracking_verbose = UImanager->GetCurrentValues("/tracking/verbose");
+      UImanager->ApplyCommand("/tracking/verbose " + (parameters.size() > 2 ? parameters[2] : G4String("1")));
+      EventTimer::SetReplaying(true);
+      UImanager->ApplyCommand("/run/beamOn " + std::to_string(n_events));
+      EventTimer::SetReplaying(false);
+      UImanager->ApplyCommand("/tracking/verbose " + tracking_verbose);
+    }
+  } else if (command == profileEnableCmd) {
+    SteppingProfiler::SetEnabled(profileEnableCmd->GetNewBoolValue(newValues));
+  } else if (command == profileRowsCmd) {
+    SteppingProfiler::SetNRows(profileRowsCmd->GetNewIntValue(newValues));
+  } else if (command == progressIntervalCmd) {
+    ProgressMonitor::SetInterval(progressIntervalCmd->GetNewDoubleValue(newValues) / second);
+  } else if (command == progressJsonCmd) {
+    ProgressMonitor::SetJson(progressJsonCmd->GetNewBoolValue(newValues));
+  } else if (command == randomEngineCmd) {
+    if (!utrRandom::SetEngine(newValues)) {
+      G4cerr << "Error! The random number engine '" << newValues << "' is not available in this version of Geant4!" << G4endl;
+      return;
+    }
+    G4cout << "Setting random number engine : '" << newValues << "'" << G4endl;
+    // In multithreaded mode, the master thread only generates the seeds of the events, using the
+    // engine which existed when the run manager was constructed. The worker threads create engines
+    // of the selected type (see utrWorkerThreadInitialization).
+    if (!G4Threading::IsMultithreadedApplication()) {
+      utrRandom::SetupMasterEngine();
+    }
   } else {
     G4cerr << "Error! Unknown command!" << G4endl;
   }
@@ -132,6 +514,64 @@ G4String utrMessenger::GetCurrentValue(G4UIcommand *command) {
     return utrFilenameTools::getFilenamePrefix();
   } else if (command == setUseFilenameIDCmd) {
     return setUseFilenameIDCmd->ConvertToString(utrFilenameTools::getUseFilenameID());
+  } else if (command == outputFormatCmd) {
+    return OutputWriter::GetFormatName(OutputWriter::GetFormat());
+  } else if (command == histogramBinWidthCmd) {
+    return histogramBinWidthCmd->ConvertToString(OutputWriter::GetHistogramBinWidth(), "keV");
+  } else if (command == histogramEMaxCmd) {
+    return histogramEMaxCmd->ConvertToString(OutputWriter::GetHistogramEMax(), "MeV");
+  } else if (command == histogramMaxIDCmd) {
+    return histogramMaxIDCmd->ConvertToString(OutputWriter::GetHistogramMaxID());
+  } else if (command == cullingEnableCmd) {
+    return cullingEnableCmd->ConvertToString(StackingAction::GetCulling());
+  } else if (command == cullingEnergyCmd) {
+    return cullingEnergyCmd->ConvertToString(StackingAction::GetCullingEnergy(), "keV");
+  } else if (command == cullingMarginCmd) {
+    return cullingMarginCmd->ConvertToString(StackingAction::GetCullingMargin(), "mm");
+  } else if (command == rangeRejectionEnableCmd) {
+    return rangeRejectionEnableCmd->ConvertToString(SteppingAction::GetRangeRejection());
+  } else if (command == rangeRejectionMaxEnergyCmd) {
+    return rangeRejectionMaxEnergyCmd->ConvertToString(SteppingAction::GetRangeRejectionMaxEnergy(), "keV");
+  } else if (command == rangeRejectionPositronsCmd) {
+    return rangeRejectionPositronsCmd->ConvertToString(SteppingAction::GetRangeRejectionPositrons());
+  } else if (command == regionDetectorsCmd) {
+    return regionDetectorsCmd->ConvertToString(utrRegions::GetAssignDetectors());
+  } else if (command == regionStatisticsCmd) {
+    return regionStatisticsCmd->ConvertToString(utrRegions::GetStatistics());
+  } else if (command == polarizedRegionsCmd) {
+    G4String regions;
+    for (auto region : EmRegionalPhysics::GetPolarizedRegions()) {
+      regions += (regions.empty() ? "" : " ") + region;
+    }
+    return regions.empty() ? G4String("none") : regions;
+  } else if (command == tableCacheCmd) {
+    return tableCacheCmd->ConvertToString(PhysicsTableCache::GetEnabled());
+  } else if (command == tableCacheDirectoryCmd) {
+    return PhysicsTableCache::GetDirectory();
+  } else if (command == brickEnvelopesCmd) {
+    return brickEnvelopesCmd->ConvertToString(BrickEnvelope::GetEnabled());
+  } else if (command == detailCmd) {
+    return GeometryDetail::GetLevelName(GeometryDetail::GetLevel());
+  } else if (command == g3SetupCmd) {
+    return g3SetupCmd->ConvertToString(GeometryDetail::GetG3Setup());
+  } else if (command == secondSetupCmd) {
+    return secondSetupCmd->ConvertToString(GeometryDetail::GetSecondSetup());
+  } else if (command == randomEngineCmd) {
+    return utrRandom::GetEngineName();
+  } else if (command == progressIntervalCmd) {
+    return progressIntervalCmd->ConvertToString(ProgressMonitor::GetInterval() * second, "s");
+  } else if (command == eventTimingHistogramCmd) {
+    return eventTimingHistogramCmd->ConvertToString(EventTimer::GetHistogram());
+  } else if (command == eventTimingSlowThresholdCmd) {
+    return eventTimingSlowThresholdCmd->ConvertToString(EventTimer::GetSlowThreshold(), "s");
+  } else if (command == eventTimingMaxSlowEventsCmd) {
+    return eventTimingMaxSlowEventsCmd->ConvertToString(EventTimer::GetMaxSlowEvents());
+  } else if (command == profileEnableCmd) {
+    return profileEnableCmd->ConvertToString(SteppingProfiler::GetEnabled());
+  } else if (command == profileRowsCmd) {
+    return profileRowsCmd->ConvertToString(SteppingProfiler::GetNRows());
+  } else if (command == progressJsonCmd) {
+    return progressJsonCmd->ConvertToString(ProgressMonitor::GetJson());
   }
   return "Error! unknown command!";
 }
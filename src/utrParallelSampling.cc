@@ -0,0 +1,47 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <climits>
+#include <thread>
+#include <vector>
+
+#include "CLHEP/Random/MixMaxRng.h"
+#include "Randomize.hh"
+
+#include "utrParallelSampling.hh"
+
+using std::vector;
+
+void utrParallelSampling::run(G4int n_threads, G4long n_samples, const std::function<void(G4int, G4long, CLHEP::HepRandomEngine *)> &sample) {
+  if (n_threads < 1)
+    n_threads = 1;
+
+  vector<CLHEP::MixMaxRng> engines(n_threads);
+  for (auto &engine : engines)
+    engine.setSeed((long)(G4UniformRand() * LONG_MAX), 0);
+
+  vector<std::thread> threads;
+  for (G4int n_thread = 0; n_thread < n_threads; ++n_thread) {
+    G4long n_samples_of_thread = n_samples / n_threads + (n_thread < n_samples % n_threads ? 1 : 0);
+    threads.push_back(std::thread(sample, n_thread, n_samples_of_thread, &engines[n_thread]));
+  }
+  for (auto &thread : threads)
+    thread.join();
+}
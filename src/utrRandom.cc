@@ -0,0 +1,210 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <chrono>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <time.h>
+#include <unistd.h>
+
+#include "CLHEP/Random/MixMaxRng.h"
+#include "CLHEP/Random/RanecuEngine.h"
+#include "G4RunManager.hh"
+#include "G4Version.hh"
+#include "Randomize.hh"
+#if G4VERSION_NUMBER >= 1070
+#include "CLHEP/Random/RanluxppEngine.h"
+#endif
+
+#include "OutputWriter.hh"
+#include "PhiloxEngine.hh"
+#include "utrFilenameTools.hh"
+#include "utrRandom.hh"
+
+random_engine utrRandom::engine = MIXMAX_ENGINE;
+uint64_t utrRandom::seed = 0;
+G4bool utrRandom::per_event_seeds = false;
+unsigned int utrRandom::shard_index = 0;
+unsigned int utrRandom::shard_count = 1;
+
+// Finalizer of the splitmix64 generator, a bijective hash of 64 bit integers with good avalanche properties
+static uint64_t splitmix64(uint64_t x) {
+  x += 0x9e3779b97f4a7c15ULL;
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+  return x ^ (x >> 31);
+}
+
+// Fill a zero-terminated seed array for G4Random::setTheSeeds() with positive 31 bit numbers.
+// Engines which need fewer seeds (for example RanecuEngine, which uses two) ignore the rest.
+static void fill_seeds(uint64_t state, long seeds[5]) {
+  for (unsigned int i = 0; i < 4; ++i) {
+    state = splitmix64(state);
+    seeds[i] = (long)(state >> 33) | 1;
+  }
+  seeds[4] = 0;
+}
+
+G4bool utrRandom::SetEngine(const G4String &name) {
+  for (auto e : {RANECU_ENGINE, MIXMAX_ENGINE, RANLUXPP_ENGINE, PHILOX_ENGINE}) {
+    if (name == GetEngineName(e)) {
+#if G4VERSION_NUMBER < 1070
+      // RanluxppEngine was added in CLHEP 2.4.4.0, which is part of Geant4 10.7
+      if (e == RANLUXPP_ENGINE) {
+        return false;
+      }
+#endif
+      engine = e;
+      return true;
+    }
+  }
+  return false;
+}
+
+G4String utrRandom::GetEngineName(random_engine e) {
+  switch (e) {
+    case RANECU_ENGINE:
+      return "ranecu";
+    case MIXMAX_ENGINE:
+      return "mixmax";
+    case RANLUXPP_ENGINE:
+      return "ranluxpp";
+    case PHILOX_ENGINE:
+      return "philox";
+  }
+  return "";
+}
+
+CLHEP::HepRandomEngine *utrRandom::CreateEngine(random_engine e) {
+  switch (e) {
+    case RANECU_ENGINE:
+      return new CLHEP::RanecuEngine;
+    case MIXMAX_ENGINE:
+      return new CLHEP::MixMaxRng;
+#if G4VERSION_NUMBER >= 1070
+    case RANLUXPP_ENGINE:
+      return new CLHEP::RanluxppEngine;
+#endif
+    case PHILOX_ENGINE:
+      return new PhiloxEngine;
+    default:
+      G4cerr << "ERROR: The random number engine '" << GetEngineName(e) << "' is not available in this version of Geant4! Aborting..." << G4endl;
+      throw std::exception();
+  }
+}
+
+void utrRandom::SetupMasterEngine() {
+  // The previous engine is not deleted, since the run manager may still refer to it
+  G4Random::setTheEngine(CreateEngine(engine));
+  SeedMaster();
+}
+
+G4bool utrRandom::SetShard(const string &shard) {
+  std::istringstream shard_stream(shard);
+  long index = -1, count = 0;
+  char slash = 0;
+  if (!(shard_stream >> index >> slash >> count) || slash != '/' || !shard_stream.eof() || count < 1 || index < 0 || index >= count) {
+    return false;
+  }
+  shard_index = (unsigned int)index;
+  shard_count = (unsigned int)count;
+  per_event_seeds = true;
+  return true;
+}
+
+string utrRandom::GetShardTag() {
+  if (!IsSharded()) {
+    return "";
+  }
+  std::stringstream tag;
+  tag << "_shard" << shard_index << "of" << shard_count;
+  return tag.str();
+}
+
+void utrRandom::SeedMaster() {
+  long seeds[5];
+  if (!per_event_seeds) {
+    // 'Real' random results. The time in seconds alone would give the same seed to all jobs
+    // which are started at the same time, for example by utrwrapper.
+    std::random_device device;
+    uint64_t entropy = splitmix64((uint64_t)time(nullptr));
+    entropy = splitmix64(entropy ^ (uint64_t)std::chrono::steady_clock::now().time_since_epoch().count());
+    entropy = splitmix64(entropy ^ (uint64_t)getpid());
+    entropy = splitmix64(entropy ^ ((uint64_t)device() << 32 | device()));
+    fill_seeds(entropy, seeds);
+  } else {
+    fill_seeds(splitmix64(splitmix64(seed) ^ shard_index), seeds);
+  }
+  G4Random::setTheSeeds(seeds);
+}
+
+uint64_t utrRandom::EventSeed(uint64_t s, unsigned int shard, G4int run_id, G4int event_id) {
+  // Each value is hashed together with the hash of the previous ones, so that neighbouring
+  // values of any of them give unrelated seeds
+  uint64_t h = splitmix64(s);
+  h = splitmix64(h ^ shard);
+  h = splitmix64(h ^ (uint64_t)(uint32_t)run_id);
+  return splitmix64(h ^ (uint64_t)(uint32_t)event_id);
+}
+
+void utrRandom::SeedEvent(const G4Event *event) {
+  if (!per_event_seeds) {
+    return;
+  }
+  long seeds[5];
+  fill_seeds(EventSeed(seed, shard_index, G4RunManager::GetRunManager()->GetCurrentRun()->GetRunID(), event->GetEventID()), seeds);
+  G4Random::setTheSeeds(seeds);
+}
+
+void utrRandom::WriteManifest(const G4Run *run) {
+  if (!IsSharded()) {
+    return;
+  }
+
+  const string manifest_filename = utrFilenameTools::getRunFilename() + ".manifest";
+  std::ofstream manifest(manifest_filename);
+  if (!manifest.is_open()) {
+    G4cerr << "ERROR: Could not write the manifest '" << manifest_filename << "'! Aborting..." << G4endl;
+    throw std::exception();
+  }
+
+  // The output files are listed relative to the output directory
+  const string run_name = utrFilenameTools::getRunName();
+  const output_format format = OutputWriter::GetFormat();
+  manifest << "# utr shard manifest" << std::endl;
+  manifest << "name " << run_name.substr(0, run_name.size() - GetShardTag().size()) << std::endl;
+  manifest << "shard " << shard_index << std::endl;
+  manifest << "shards " << shard_count << std::endl;
+  manifest << "seed " << seed << std::endl;
+  manifest << "run " << run->GetRunID() << std::endl;
+  manifest << "events " << run->GetNumberOfEvent() << std::endl;
+  manifest << "requested " << run->GetNumberOfEventToBeProcessed() << std::endl;
+  manifest << "format " << OutputWriter::GetFormatName(format) << std::endl;
+  if (format == HISTOGRAM_FORMAT) {
+    manifest << "file " << run_name << "_hist.root" << std::endl;
+  } else {
+    for (G4int i = 0; i < G4RunManager::GetRunManager()->GetNumberOfThreads(); ++i) {
+      manifest << "file " << run_name << "_t" << i << OutputWriter::GetFileExtension(format) << std::endl;
+    }
+  }
+
+  G4cout << "Wrote the manifest of shard " << shard_index << "/" << shard_count << " to '" << manifest_filename << "'" << G4endl;
+}
@@ -0,0 +1,214 @@
+/*
+utr - Geant4 simulation of the UTR at HIGS
+Copyright (C) 2017 the developing team (see README.md)
+
+This file is part of utr.
+
+utr is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+utr is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with utr.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "utrRegions.hh"
+
+#include "G4LogicalVolumeStore.hh"
+#include "G4Material.hh"
+#include "G4ProductionCuts.hh"
+#include "G4ProductionCutsTable.hh"
+#include "G4Region.hh"
+#include "G4RegionStore.hh"
+#include "G4SystemOfUnits.hh"
+#include "G4TransportationManager.hh"
+#include "G4VPhysicalVolume.hh"
+
+#include <algorithm>
+#include <fnmatch.h>
+#include <iomanip>
+
+G4bool utrRegions::assign_detectors = true;
+vector<utrRegions::Assignment> utrRegions::assignments;
+vector<utrRegions::Cut> utrRegions::cuts;
+
+G4bool utrRegions::statistics = false;
+G4ThreadLocal vector<unsigned long> *utrRegions::n_steps = nullptr;
+G4ThreadLocal vector<unsigned long> *utrRegions::n_secondaries = nullptr;
+vector<unsigned long> utrRegions::total_steps;
+vector<unsigned long> utrRegions::total_secondaries;
+std::mutex utrRegions::statistics_mutex;
+
+void utrRegions::AddVolume(const G4String &region_name, G4LogicalVolume *logical_volume) {
+  assign(region_name, logical_volume);
+}
+
+void utrRegions::AddVolumesByName(const G4String &region_name, const G4String &pattern) {
+  assignments.push_back({region_name, pattern, false});
+}
+
+void utrRegions::AddVolumesByMaterial(const G4String &region_name, const G4String &pattern) {
+  assignments.push_back({region_name, pattern, true});
+}
+
+void utrRegions::SetProductionCut(const G4String &region_name, G4double cut) {
+  cuts.push_back({region_name, cut});
+}
+
+void utrRegions::assign(const G4String &region_name, G4LogicalVolume *logical_volume) {
+  if (logical_volume->IsRootRegion()) {
+    if (logical_volume->GetRegion()->GetName() != region_name) {
+      G4cout << "utrRegions: " << logical_volume->GetName() << " is already the root volume of the region " << logical_volume->GetRegion()->GetName() << ", not assigned to " << region_name << G4endl;
+    }
+    return;
+  }
+  G4RegionStore::GetInstance()->FindOrCreateRegion(region_name)->AddRootLogicalVolume(logical_volume);
+}
+
+void utrRegions::find_sensitive_volumes(G4LogicalVolume *logical_volume, vector<G4LogicalVolume *> &sensitive_volumes) {
+  if (logical_volume->GetSensitiveDetector() != nullptr) {
+    if (std::find(sensitive_volumes.begin(), sensitive_volumes.end(), logical_volume) == sensitive_volumes.end()) {
+      sensitive_volumes.push_back(logical_volume);
+    }
+    return;
+  }
+  for (size_t i = 0; i < logical_volume->GetNoDaughters(); ++i) {
+    find_sensitive_volumes(logical_volume->GetDaughter(i)->GetLogicalVolume(), sensitive_volumes);
+  }
+}
+
+void utrRegions::Setup() {
+  G4LogicalVolume *world = G4TransportationManager::GetTransportationManager()->GetNavigatorForTracking()->GetWorldVolume()->GetLogicalVolume();
+
+  if (assign_detectors) {
+    vector<G4LogicalVolume *> sensitive_volumes;
+    find_sensitive_volumes(world, sensitive_volumes);
+    if (sensitive_volumes.empty()) {
+      G4cout << "WARNING: utrRegions: No sensitive volumes found, the region 'detectors' is not created" << G4endl;
+    }
+    for (auto logical_volume : sensitive_volumes) {
+      assign("detectors", logical_volume);
+    }
+  }
+
+  for (auto assignment : assignments) {
+    size_t n_volumes = 0;
+    for (auto logical_volume : *G4LogicalVolumeStore::GetInstance()) {
+      if (logical_volume == world) {
+        continue;
+      }
+      const G4String &name = assignment.by_material ? logical_volume->GetMaterial()->GetName() : logical_volume->GetName();
+      if (fnmatch(assignment.pattern.c_str(), name.c_str(), 0) == 0) {
+        assign(assignment.region_name, logical_volume);
+        ++n_volumes;
+      }
+    }
+    if (n_volumes == 0) {
+      G4cout << "WARNING: utrRegions: No logical volume with the " << (assignment.by_material ? "material " : "name ") << assignment.pattern << " found for the region " << assignment.region_name << G4endl;
+    }
+  }
+
+  G4ProductionCuts *default_cuts = G4ProductionCutsTable::GetProductionCutsTable()->GetDefaultProductionCuts();
+  for (auto region : *G4RegionStore::GetInstance()) {
+    if (region->GetProductionCuts() == nullptr) {
+      // Sharing the default cuts instead of a copy, so that the region follows /run/setCut
+      region->SetProductionCuts(default_cuts);
+    }
+  }
+  for (auto cut : cuts) {
+    G4Region *region = G4RegionStore::GetInstance()->GetRegion(cut.region_name, false);
+    if (region == nullptr) {
+      G4cerr << "ERROR: utrRegions: Production cut for the region " << cut.region_name << ", which does not exist! Aborting..." << G4endl;
+      throw std::exception();
+    }
+    if (region->GetProductionCuts() == default_cuts) {
+      region->SetProductionCuts(new G4ProductionCuts(*default_cuts));
+    }
+    region->GetProductionCuts()->SetProductionCut(cut.cut);
+  }
+
+  G4cout << "================================================================================" << G4endl;
+  G4cout << "utrRegions: Regions and production cuts" << G4endl;
+  for (auto region : *G4RegionStore::GetInstance()) {
+    if (region->GetNumberOfRootVolumes() == 0) {
+      continue;
+    }
+    G4cout << "\t" << std::setw(32) << std::left << region->GetName() << std::right << std::setw(6) << region->GetNumberOfRootVolumes() << " root volumes, gamma cut: ";
+    if (region->GetProductionCuts() == default_cuts) {
+      G4cout << "default" << G4endl;
+    } else {
+      G4cout << region->GetProductionCuts()->GetProductionCut("gamma") / mm << " mm" << G4endl;
+    }
+  }
+  G4cout << "================================================================================" << G4endl;
+}
+
+void utrRegions::CountStep(const G4Step *step) {
+  if (n_steps == nullptr) {
+    n_steps = new vector<unsigned long>;
+    n_secondaries = new vector<unsigned long>;
+  }
+
+  const size_t ID = (size_t)step->GetPreStepPoint()->GetPhysicalVolume()->GetLogicalVolume()->GetRegion()->GetInstanceID();
+  if (ID >= n_steps->size()) {
+    n_steps->resize(ID + 1, 0);
+    n_secondaries->resize(ID + 1, 0);
+  }
+  ++(*n_steps)[ID];
+  (*n_secondaries)[ID] += step->GetSecondaryInCurrentStep()->size();
+}
+
+void utrRegions::MergeStatistics() {
+  if (n_steps == nullptr) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(statistics_mutex);
+  if (total_steps.size() < n_steps->size()) {
+    total_steps.resize(n_steps->size(), 0);
+    total_secondaries.resize(n_steps->size(), 0);
+  }
+  for (size_t i = 0; i < n_steps->size(); ++i) {
+    total_steps[i] += (*n_steps)[i];
+    total_secondaries[i] += (*n_secondaries)[i];
+  }
+  n_steps->assign(n_steps->size(), 0);
+  n_secondaries->assign(n_secondaries->size(), 0);
+}
+
+void utrRegions::PrintStatistics() {
+  if (!statistics) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(statistics_mutex);
+  unsigned long sum_steps = 0;
+  for (auto steps : total_steps) {
+    sum_steps += steps;
+  }
+  if (sum_steps == 0) {
+    return;
+  }
+
+  G4cout << "================================================================================" << G4endl;
+  G4cout << "utrRegions: Steps and secondaries in each region" << G4endl;
+  for (auto region : *G4RegionStore::GetInstance()) {
+    const size_t ID = (size_t)region->GetInstanceID();
+    if (ID >= total_steps.size() || total_steps[ID] == 0) {
+      continue;
+    }
+    G4cout << "\t" << std::setw(32) << std::left << region->GetName() << std::right
+           << " steps: " << std::setw(14) << total_steps[ID] << " (" << std::setw(5) << std::setprecision(1) << std::fixed << 100. * total_steps[ID] / sum_steps << " %)"
+           << "  secondaries: " << std::setw(14) << total_secondaries[ID] << G4endl;
+  }
+  G4cout << "================================================================================" << G4endl;
+
+  total_steps.assign(total_steps.size(), 0);
+  total_secondaries.assign(total_secondaries.size(), 0);
+}
@@ -0,0 +1,176 @@
+#include <argp.h>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include "AngularDistribution.hh"
+
+static char doc[] = "AngularDistribution_Benchmark";
+static char args_doc[] = "Compare the evaluation speed of AngularDistribution::AngDist, which looks up the spin cascade on every call, with the function returned by AngularDistribution::GetAngDistFunction for all implemented cascades";
+
+struct arguments {
+  unsigned long n_calls;
+  unsigned long seed;
+
+  arguments() : n_calls(1000000), seed(0){};
+};
+
+static struct argp_option options[] = {
+    {0, 'n', "NCALLS", 0, "Number of calls per cascade (default: 1000000)"},
+    {0, 's', "SEED", 0, "Random number seed (default: 0)"},
+    {0, 0, 0, 0, 0}};
+
+static error_t parse_opt(int key, char *arg, struct argp_state *state) {
+
+  struct arguments *args = (struct arguments *)state->input;
+
+  switch (key) {
+    case ARGP_KEY_ARG:
+      break;
+    case 'n':
+      args->n_calls = strtoul(arg, nullptr, 10);
+      break;
+    case 's':
+      args->seed = strtoul(arg, nullptr, 10);
+      break;
+    case ARGP_KEY_END:
+      break;
+    default:
+      return ARGP_ERR_UNKNOWN;
+  }
+
+  return 0;
+}
+
+static struct argp argp = {options, parse_opt, args_doc, doc, 0, 0, 0};
+
+using namespace std;
+
+struct Cascade {
+  int nst;
+  double st[4];
+  AngDistFunction ang_dist;
+};
+
+// Find all implemented cascades by trying every combination of the spin-parity quantum numbers
+// that are used in AngularDistribution.cc. Combinations which are mapped to the same function
+// (for example the two parity-mirrored versions of a cascade) are only listed once.
+vector<Cascade> find_cascades(const AngularDistribution &angdist) {
+  vector<double> jpi = {0., -0.1, 0.1};
+  for (int i = 1; i <= 12; ++i) {
+    jpi.push_back(0.5 * i);
+    jpi.push_back(-0.5 * i);
+  }
+
+  vector<Cascade> cascades;
+  for (int nst = 3; nst <= 4; ++nst) {
+    size_t n_combinations = 1;
+    for (int i = 0; i < nst; ++i)
+      n_combinations *= jpi.size();
+
+    for (size_t n = 0; n < n_combinations; ++n) {
+      Cascade cascade;
+      cascade.nst = nst;
+      size_t index = n;
+      for (int i = 0; i < nst; ++i) {
+        cascade.st[i] = jpi[index % jpi.size()];
+        index /= jpi.size();
+      }
+      cascade.ang_dist = angdist.GetAngDistFunction(cascade.st, nst);
+      if (cascade.ang_dist == nullptr)
+        continue;
+
+      bool known = false;
+      for (auto c : cascades) {
+        if (c.ang_dist == cascade.ang_dist) {
+          known = true;
+          break;
+        }
+      }
+      if (!known)
+        cascades.push_back(cascade);
+    }
+  }
+
+  return cascades;
+}
+
+int main(int argc, char *argv[]) {
+  struct arguments args;
+  argp_parse(&argp, argc, argv, 0, 0, &args);
+
+  AngularDistribution angdist;
+  vector<Cascade> cascades = find_cascades(angdist);
+
+  // Use the same random directions for both methods
+  mt19937_64 engine(args.seed);
+  uniform_real_distribution<double> uniform(0., 1.);
+  vector<double> theta(args.n_calls);
+  vector<double> phi(args.n_calls);
+  for (unsigned long i = 0; i < args.n_calls; ++i) {
+    theta[i] = acos(2. * uniform(engine) - 1.);
+    phi[i] = 2. * M_PI * uniform(engine);
+  }
+  double mix[3] = {0.1, -0.2, 0.3};
+
+  cout << "Evaluating " << args.n_calls << " random directions for each of " << cascades.size() << " cascades" << endl;
+  cout << left << setw(30) << "Cascade" << right << setw(16) << "lookup [1/s]" << setw(16) << "resolved [1/s]" << setw(10) << "speedup" << endl;
+
+  double total_lookup = 0.;
+  double total_resolved = 0.;
+  unsigned long n_mismatch = 0;
+
+  for (auto cascade : cascades) {
+    double sum_lookup = 0.;
+    auto start = chrono::steady_clock::now();
+    for (unsigned long i = 0; i < args.n_calls; ++i)
+      sum_lookup += angdist.AngDist(theta[i], phi[i], cascade.st, cascade.nst, mix);
+    auto stop = chrono::steady_clock::now();
+    double t_lookup = chrono::duration<double>(stop - start).count();
+
+    double sum_resolved = 0.;
+    start = chrono::steady_clock::now();
+    AngDistFunction ang_dist = angdist.GetAngDistFunction(cascade.st, cascade.nst);
+    for (unsigned long i = 0; i < args.n_calls; ++i)
+      sum_resolved += ang_dist(theta[i], phi[i], mix);
+    stop = chrono::steady_clock::now();
+    double t_resolved = chrono::duration<double>(stop - start).count();
+
+    // Both methods evaluate the same expressions, so the results have to be identical
+    if (sum_lookup != sum_resolved && !(std::isnan(sum_lookup) && std::isnan(sum_resolved)))
+      ++n_mismatch;
+
+    total_lookup += t_lookup;
+    total_resolved += t_resolved;
+
+    string name;
+    for (int i = 0; i < cascade.nst; ++i) {
+      ostringstream state;
+      state << cascade.st[i];
+      name += state.str();
+      if (i < cascade.nst - 1)
+        name += " -> ";
+    }
+
+    cout << left << setw(30) << name << right << scientific << setprecision(3)
+         << setw(16) << (double)args.n_calls / t_lookup
+         << setw(16) << (double)args.n_calls / t_resolved
+         << fixed << setprecision(2) << setw(10) << t_lookup / t_resolved << endl;
+  }
+
+  cout << left << setw(30) << "Total" << right << scientific << setprecision(3)
+       << setw(16) << (double)(args.n_calls * cascades.size()) / total_lookup
+       << setw(16) << (double)(args.n_calls * cascades.size()) / total_resolved
+       << fixed << setprecision(2) << setw(10) << total_lookup / total_resolved << endl;
+
+  if (n_mismatch > 0) {
+    cerr << "ERROR: The results of both methods differ for " << n_mismatch << " cascade(s)." << endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,194 @@
+#include <argp.h>
+#include <chrono>
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "ColumnarReader.hh"
+#include "ColumnarWriter.hh"
+
+static char doc[] = "ColumnarOutput_Test";
+static char args_doc[] = "Write random hits with all columns of utr's output to a columnar file, read them back with the header-only reader of OutputProcessing and compare. Reports the size of a row compared to a row of double values, and the time per filled row.";
+
+struct arguments {
+  unsigned long n_rows;
+  unsigned int chunk_size;
+  unsigned long seed;
+  const char *filename;
+
+  arguments() : n_rows(1000000), chunk_size(4096), seed(0), filename("columnar_test.utrc"){};
+};
+
+static struct argp_option options[] = {
+    {0, 'n', "NROWS", 0, "Number of rows (default: 1000000)"},
+    {0, 'c', "CHUNKSIZE", 0, "Number of rows per chunk (default: 4096)"},
+    {0, 's', "SEED", 0, "Random number seed (default: 0)"},
+    {0, 'f', "FILENAME", 0, "Name of the temporary output file (default: columnar_test.utrc)"},
+    {0, 0, 0, 0, 0}};
+
+static error_t parse_opt(int key, char *arg, struct argp_state *state) {
+
+  struct arguments *args = (struct arguments *)state->input;
+
+  switch (key) {
+    case ARGP_KEY_ARG:
+      break;
+    case 'n':
+      args->n_rows = strtoul(arg, nullptr, 10);
+      break;
+    case 'c':
+      args->chunk_size = (unsigned int)strtoul(arg, nullptr, 10);
+      break;
+    case 's':
+      args->seed = strtoul(arg, nullptr, 10);
+      break;
+    case 'f':
+      args->filename = arg;
+      break;
+    case ARGP_KEY_END:
+      break;
+    default:
+      return ARGP_ERR_UNKNOWN;
+  }
+
+  return 0;
+}
+
+static struct argp argp = {options, parse_opt, args_doc, doc, 0, 0, 0};
+
+using namespace std;
+
+// Same columns and types as the output of utr with all EVENT_* options enabled
+struct Row {
+  long event;
+  double edep;
+  double ekin;
+  int particle;
+  int volume;
+  double x, y, z, vx, vy, vz;
+};
+
+Row random_row(mt19937_64 &engine, unsigned long n) {
+  uniform_real_distribution<double> energy(0., 10.);
+  uniform_real_distribution<double> length(-1000., 1000.);
+  uniform_int_distribution<int> particle(0, 2);
+  uniform_int_distribution<int> volume(0, 20);
+  const int pdg[3] = {22, 11, -11};
+
+  Row row;
+  row.event = (long)(n / 3) + 3000000000L;
+  row.edep = energy(engine);
+  row.ekin = energy(engine);
+  row.particle = pdg[particle(engine)];
+  row.volume = volume(engine);
+  row.x = length(engine);
+  row.y = length(engine);
+  row.z = length(engine);
+  row.vx = energy(engine);
+  row.vy = energy(engine);
+  row.vz = energy(engine);
+  return row;
+}
+
+int main(int argc, char *argv[]) {
+  struct arguments args;
+  argp_parse(&argp, argc, argv, 0, 0, &args);
+
+  const char *names[] = {"event", "edep", "ekin", "particle", "volume", "x", "y", "z", "vx", "vy", "vz"};
+  const ColumnarWriter::ColumnType types[] = {ColumnarWriter::INT64, ColumnarWriter::FLOAT32, ColumnarWriter::FLOAT32, ColumnarWriter::INT32, ColumnarWriter::INT32,
+                                              ColumnarWriter::FLOAT32, ColumnarWriter::FLOAT32, ColumnarWriter::FLOAT32, ColumnarWriter::FLOAT32, ColumnarWriter::FLOAT32, ColumnarWriter::FLOAT32};
+  const unsigned int n_columns = 11;
+
+  // Write
+  ColumnarWriter writer(args.chunk_size);
+  for (unsigned int i = 0; i < n_columns; ++i)
+    writer.AddColumn(names[i], types[i]);
+  if (!writer.Open(args.filename)) {
+    cout << "Error: Could not open '" << args.filename << "'" << endl;
+    return 1;
+  }
+
+  mt19937_64 engine(args.seed);
+  vector<Row> rows(args.n_rows);
+  for (unsigned long n = 0; n < args.n_rows; ++n)
+    rows[n] = random_row(engine, n);
+
+  auto start = chrono::steady_clock::now();
+  for (unsigned long n = 0; n < args.n_rows; ++n) {
+    const Row &row = rows[n];
+    // Leave the ekin column empty in every 10th row, it has to be read back as zero
+    writer.Fill(0, row.event);
+    writer.Fill(1, row.edep);
+    if (n % 10 != 0)
+      writer.Fill(2, row.ekin);
+    writer.Fill(3, row.particle);
+    writer.Fill(4, row.volume);
+    writer.Fill(5, row.x);
+    writer.Fill(6, row.y);
+    writer.Fill(7, row.z);
+    writer.Fill(8, row.vx);
+    writer.Fill(9, row.vy);
+    writer.Fill(10, row.vz);
+    writer.AddRow();
+  }
+  writer.Close();
+  auto stop = chrono::steady_clock::now();
+  const double t_write = chrono::duration<double>(stop - start).count();
+
+  // Read and compare
+  unsigned long n_read = 0;
+  unsigned long n_mismatches = 0;
+  try {
+    ColumnarReader reader(args.filename);
+    if (reader.GetNColumns() != n_columns) {
+      cout << "Error: Found " << reader.GetNColumns() << " instead of " << n_columns << " columns" << endl;
+      return 1;
+    }
+    for (unsigned int i = 0; i < n_columns; ++i) {
+      if (reader.GetColumnName(i) != names[i] || reader.GetColumnIndex(names[i]) != i || (uint8_t)reader.GetColumnType(i) != (uint8_t)types[i]) {
+        cout << "Error: Column " << i << " ('" << reader.GetColumnName(i) << "') does not match the header" << endl;
+        return 1;
+      }
+    }
+
+    while (reader.ReadChunk()) {
+      const int64_t *event = reader.GetColumn<int64_t>(0);
+      const float *edep = reader.GetColumn<float>(1);
+      const int32_t *particle = reader.GetColumn<int32_t>(3);
+      for (size_t i = 0; i < reader.GetNRows(); ++i, ++n_read) {
+        if (n_read >= args.n_rows) {
+          ++n_mismatches;
+          continue;
+        }
+        const Row &row = rows[n_read];
+        const double expected[] = {(double)row.event, (float)row.edep, n_read % 10 != 0 ? (float)row.ekin : 0.f, (double)row.particle, (double)row.volume,
+                                   (float)row.x, (float)row.y, (float)row.z, (float)row.vx, (float)row.vy, (float)row.vz};
+        bool match = event[i] == row.event && edep[i] == (float)row.edep && particle[i] == row.particle;
+        for (unsigned int j = 0; j < n_columns; ++j)
+          match = match && reader.GetValue(j, i) == expected[j];
+        if (!match)
+          ++n_mismatches;
+      }
+    }
+  } catch (std::runtime_error &e) {
+    cout << "Error: " << e.what() << endl;
+    return 1;
+  }
+  remove(args.filename);
+
+  cout << "Wrote and read " << args.n_rows << " rows with " << n_columns << " columns in chunks of " << args.chunk_size << " rows" << endl;
+  const double bytes_per_row = (double)writer.GetNBytesWritten() / (double)max(args.n_rows, 1UL);
+  cout << "Bytes per row         : " << fixed << setprecision(2) << bytes_per_row << " (" << 8 * n_columns << " as doubles, ratio " << 8. * n_columns / bytes_per_row << ")" << endl;
+  cout << "Time per row          : " << setprecision(1) << 1e9 * t_write / (double)max(args.n_rows, 1UL) << " ns" << endl;
+  cout << "Rows read             : " << n_read << endl;
+  cout << "Mismatches            : " << n_mismatches << endl;
+
+  if (n_read != args.n_rows || n_mismatches > 0) {
+    cout << "Test failed." << endl;
+    return 1;
+  }
+  cout << "Test passed." << endl;
+  return 0;
+}
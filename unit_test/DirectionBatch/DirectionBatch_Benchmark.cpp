@@ -0,0 +1,222 @@
+#include <algorithm>
+#include <argp.h>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include "AngularDistribution.hh"
+#include "DirectionBatch.hh"
+
+static char doc[] = "DirectionBatch_Benchmark";
+static char args_doc[] = "Compare the throughput (primaries per second in a single thread) of the rejection sampling of momentum directions one by one, as in the scalar path of the angular generators, with the batched sampling of DirectionBatch for all implemented cascades";
+
+struct arguments {
+  unsigned long n_primaries;
+  unsigned int batch_size;
+  unsigned long seed;
+
+  arguments() : n_primaries(1000000), batch_size(1024), seed(0){};
+};
+
+static struct argp_option options[] = {
+    {0, 'n', "NPRIMARIES", 0, "Number of sampled directions per cascade (default: 1000000)"},
+    {0, 'b', "BATCHSIZE", 0, "Number of directions per batch (default: 1024)"},
+    {0, 's', "SEED", 0, "Random number seed (default: 0)"},
+    {0, 0, 0, 0, 0}};
+
+static error_t parse_opt(int key, char *arg, struct argp_state *state) {
+
+  struct arguments *args = (struct arguments *)state->input;
+
+  switch (key) {
+    case ARGP_KEY_ARG:
+      break;
+    case 'n':
+      args->n_primaries = strtoul(arg, nullptr, 10);
+      break;
+    case 'b':
+      args->batch_size = (unsigned int)strtoul(arg, nullptr, 10);
+      break;
+    case 's':
+      args->seed = strtoul(arg, nullptr, 10);
+      break;
+    case ARGP_KEY_END:
+      break;
+    default:
+      return ARGP_ERR_UNKNOWN;
+  }
+
+  return 0;
+}
+
+static struct argp argp = {options, parse_opt, args_doc, doc, 0, 0, 0};
+
+using namespace std;
+
+struct Cascade {
+  int nst;
+  double st[4];
+  AngDistFunction ang_dist;
+  AngDistBatchFunction ang_dist_batch;
+};
+
+// Find all implemented cascades by trying every combination of the spin-parity quantum numbers
+// that are used in AngularDistribution.cc. Combinations which are mapped to the same function
+// are only listed once. The wildcard for test distributions is skipped, because it is nearly
+// zero everywhere.
+vector<Cascade> find_cascades(const AngularDistribution &angdist) {
+  vector<double> jpi = {0., -0.1, 0.1};
+  for (int i = 1; i <= 12; ++i) {
+    jpi.push_back(0.5 * i);
+    jpi.push_back(-0.5 * i);
+  }
+
+  vector<Cascade> cascades;
+  for (int nst = 3; nst <= 4; ++nst) {
+    size_t n_combinations = 1;
+    for (int i = 0; i < nst; ++i)
+      n_combinations *= jpi.size();
+
+    for (size_t n = 0; n < n_combinations; ++n) {
+      Cascade cascade;
+      cascade.nst = nst;
+      size_t index = n;
+      for (int i = 0; i < nst; ++i) {
+        cascade.st[i] = jpi[index % jpi.size()];
+        index /= jpi.size();
+      }
+      if (nst == 3 && cascade.st[0] == 0.1 && cascade.st[1] == 0.1 && cascade.st[2] == 0.1)
+        continue;
+      cascade.ang_dist = angdist.GetAngDistFunction(cascade.st, nst);
+      if (cascade.ang_dist == nullptr)
+        continue;
+      cascade.ang_dist_batch = angdist.GetAngDistBatchFunction(cascade.st, nst);
+
+      bool known = false;
+      for (auto c : cascades) {
+        if (c.ang_dist == cascade.ang_dist) {
+          known = true;
+          break;
+        }
+      }
+      if (!known)
+        cascades.push_back(cascade);
+    }
+  }
+
+  return cascades;
+}
+
+// Maximum of W on a grid, increased by the same margin as in the AngularDistributionGenerator
+double find_envelope(AngDistFunction ang_dist, const double *mix) {
+  double max_w = 0.;
+  for (int i = 0; i <= 100; ++i) {
+    for (int j = 0; j <= 200; ++j)
+      max_w = max(max_w, ang_dist(acos(-1. + 0.02 * i), 2. * M_PI * j / 200., mix));
+  }
+  return 1.1 * max_w;
+}
+
+int main(int argc, char *argv[]) {
+  struct arguments args;
+  argp_parse(&argp, argc, argv, 0, 0, &args);
+
+  AngularDistribution angdist;
+  vector<Cascade> cascades = find_cascades(angdist);
+  double mix[3] = {0.1, -0.2, 0.3};
+
+  mt19937_64 engine(args.seed);
+  uniform_real_distribution<double> uniform(0., 1.);
+  DirectionBatch::UniformFunction uniform_array = [&engine, &uniform](unsigned int n, double *u) {
+    for (unsigned int i = 0; i < n; ++i)
+      u[i] = uniform(engine);
+  };
+
+  DirectionBatch batch(args.batch_size);
+
+  cout << "Sampling " << args.n_primaries << " directions for each of " << cascades.size() << " cascades, batch size " << args.batch_size << endl;
+  cout << left << setw(30) << "Cascade" << right << setw(16) << "scalar [1/s]" << setw(16) << "batched [1/s]" << setw(10) << "speedup" << endl;
+
+  double total_scalar = 0.;
+  double total_batched = 0.;
+  unsigned long n_failed = 0;
+
+  for (auto cascade : cascades) {
+    const double envelope = find_envelope(cascade.ang_dist, mix);
+
+    // Scalar path: one direction after the other, as in AngularDistributionGenerator::GeneratePrimaries
+    double sum_scalar = 0.;
+    auto start = chrono::steady_clock::now();
+    for (unsigned long n = 0; n < args.n_primaries; ++n) {
+      for (;;) {
+        double theta = acos(2. * uniform(engine) - 1.);
+        double phi = 2. * M_PI * uniform(engine);
+        double w = uniform(engine) * envelope;
+        if (w <= cascade.ang_dist(theta, phi, mix)) {
+          sum_scalar += sin(theta) * cos(phi) + sin(theta) * sin(phi) + cos(theta);
+          break;
+        }
+      }
+    }
+    auto stop = chrono::steady_clock::now();
+    double t_scalar = chrono::duration<double>(stop - start).count();
+
+    // Batched path
+    double sum_batched = 0.;
+    start = chrono::steady_clock::now();
+    for (unsigned long n = 0; n < args.n_primaries; ++n) {
+      if (batch.Empty()) {
+        if (!batch.Fill(
+                uniform_array,
+                [&](unsigned int n_candidates, double *theta, double *phi, double *env) { DirectionBatch::ProposeIsotropic(uniform_array, n_candidates, theta, phi, env, envelope); },
+                [&](const double *theta, const double *phi, double *w, unsigned int n_candidates) { cascade.ang_dist_batch(theta, phi, mix, w, n_candidates); },
+                1000)) {
+          ++n_failed;
+          break;
+        }
+      }
+      double x, y, z;
+      batch.Pop(x, y, z);
+      sum_batched += x + y + z;
+    }
+    stop = chrono::steady_clock::now();
+    double t_batched = chrono::duration<double>(stop - start).count();
+    batch.Clear();
+
+    total_scalar += t_scalar;
+    total_batched += t_batched;
+
+    string name;
+    for (int i = 0; i < cascade.nst; ++i) {
+      ostringstream state;
+      state << cascade.st[i];
+      name += state.str();
+      if (i < cascade.nst - 1)
+        name += " -> ";
+    }
+
+    // The sums of the components are only printed to make sure that the compiler does not
+    // optimize the sampling away. Both should be close to zero.
+    cout << left << setw(30) << name << right << scientific << setprecision(3)
+         << setw(16) << (double)args.n_primaries / t_scalar
+         << setw(16) << (double)args.n_primaries / t_batched
+         << fixed << setprecision(2) << setw(10) << t_scalar / t_batched
+         << scientific << setprecision(1) << setw(10) << sum_scalar / (double)args.n_primaries << setw(10) << sum_batched / (double)args.n_primaries << endl;
+  }
+
+  cout << left << setw(30) << "Total" << right << scientific << setprecision(3)
+       << setw(16) << (double)(args.n_primaries * cascades.size()) / total_scalar
+       << setw(16) << (double)(args.n_primaries * cascades.size()) / total_batched
+       << fixed << setprecision(2) << setw(10) << total_scalar / total_batched << endl;
+
+  if (n_failed > 0) {
+    cerr << "ERROR: The batched sampling failed for " << n_failed << " cascade(s)." << endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,236 @@
+#include <algorithm>
+#include <argp.h>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "G4Polycone.hh"
+#include "G4SystemOfUnits.hh"
+
+#include "HPGe_Coaxial.hh"
+#include "HPGe_Collection.hh"
+#include "OptimizePolycone.hh"
+
+static char doc[] = "PolyconeProfile_Benchmark";
+static char args_doc[] = "Compare the number of z-planes and the navigation speed of the crystal polycones of all coaxial HPGe detectors in HPGe_Collection, sampled uniformly with 500 steps as in previous versions of HPGe_Coaxial, and adaptively with a maximum deviation";
+
+struct arguments {
+  unsigned long n_points;
+  double max_deviation;
+  unsigned long seed;
+
+  arguments() : n_points(1000000), max_deviation(10.), seed(0){};
+};
+
+static struct argp_option options[] = {
+    {0, 'n', "NPOINTS", 0, "Number of random points and directions per crystal (default: 1000000)"},
+    {0, 'd', "DEVIATION", 0, "Maximum deviation of the adaptive profile in micrometers (default: 10)"},
+    {0, 's', "SEED", 0, "Random number seed (default: 0)"},
+    {0, 0, 0, 0, 0}};
+
+static error_t parse_opt(int key, char *arg, struct argp_state *state) {
+
+  struct arguments *args = (struct arguments *)state->input;
+
+  switch (key) {
+    case ARGP_KEY_ARG:
+      break;
+    case 'n':
+      args->n_points = strtoul(arg, nullptr, 10);
+      break;
+    case 'd':
+      args->max_deviation = strtod(arg, nullptr);
+      break;
+    case 's':
+      args->seed = strtoul(arg, nullptr, 10);
+      break;
+    case ARGP_KEY_END:
+      break;
+    default:
+      return ARGP_ERR_UNKNOWN;
+  }
+
+  return 0;
+}
+
+static struct argp argp = {options, parse_opt, args_doc, doc, 0, 0, 0};
+
+using namespace std;
+
+struct Crystal {
+  string name;
+  HPGe_Coaxial_Properties properties;
+};
+
+// Crystal polycone as constructed by previous versions of HPGe_Coaxial: the profile is sampled at
+// 500 uniformly spaced planes, and OptimizePolycone removes the planes inside cylindrical parts.
+G4Polycone *uniform_polycone(const PolyconeProfile &profile, double length, const G4String &name, int &n_planes) {
+  const int nsteps = 500;
+  double z_plane_temp[nsteps], r_inner_temp[nsteps], r_outer_temp[nsteps];
+  double z_plane[nsteps], r_inner[nsteps], r_outer[nsteps];
+  for (int i = 0; i < nsteps; ++i) {
+    z_plane_temp[i] = (1. - (double)i / (nsteps - 1)) * length;
+    r_inner_temp[i] = profile.RInner(z_plane_temp[i]);
+    r_outer_temp[i] = profile.ROuter(z_plane_temp[i]);
+  }
+  OptimizePolycone optimize;
+  n_planes = optimize.Optimize(z_plane_temp, r_inner_temp, r_outer_temp, z_plane, r_inner, r_outer, nsteps, name);
+  return new G4Polycone(name, 0., 360. * deg, n_planes, z_plane, r_inner, r_outer);
+}
+
+// Largest radial deviation of a polycone from the true profile, evaluated on a fine grid
+double max_deviation(const PolyconeProfile &profile, const G4Polycone *polycone, double length) {
+  const G4PolyconeHistorical *parameters = polycone->GetOriginalParameters();
+  double max_d = 0.;
+  const int n = 100000;
+  for (int i = 0; i <= n; ++i) {
+    const double z = length * i / n;
+    for (int j = 0; j < parameters->Num_z_planes - 1; ++j) {
+      const double z_1 = parameters->Z_values[j];
+      const double z_2 = parameters->Z_values[j + 1];
+      if (z_1 != z_2 && (z - z_1) * (z - z_2) <= 0.) {
+        const double t = (z - z_1) / (z_2 - z_1);
+        max_d = max(max_d, fabs(profile.RInner(z) - (parameters->Rmin[j] + t * (parameters->Rmin[j + 1] - parameters->Rmin[j]))));
+        max_d = max(max_d, fabs(profile.ROuter(z) - (parameters->Rmax[j] + t * (parameters->Rmax[j + 1] - parameters->Rmax[j]))));
+        break;
+      }
+    }
+  }
+  return max_d;
+}
+
+// Time per call of the navigation functions which are called most frequently in a sensitive
+// volume. Points are sampled uniformly in a cylinder which is slightly larger than the crystal,
+// and directions isotropically.
+struct NavigationTimes {
+  double inside;
+  double distance_to_in;
+  double distance_to_out;
+  double checksum;
+};
+
+NavigationTimes benchmark(const G4VSolid *solid, const vector<G4ThreeVector> &points, const vector<G4ThreeVector> &directions) {
+  NavigationTimes times{0., 0., 0., 0.};
+
+  vector<EInside> inside(points.size());
+  auto start = chrono::steady_clock::now();
+  for (size_t i = 0; i < points.size(); ++i)
+    inside[i] = solid->Inside(points[i]);
+  auto stop = chrono::steady_clock::now();
+  times.inside = chrono::duration<double, nano>(stop - start).count() / (double)points.size();
+
+  size_t n = 0;
+  start = chrono::steady_clock::now();
+  for (size_t i = 0; i < points.size(); ++i) {
+    if (inside[i] == kOutside) {
+      const double d = solid->DistanceToIn(points[i], directions[i]);
+      times.checksum += (d == kInfinity) ? 0. : d;
+      ++n;
+    }
+  }
+  stop = chrono::steady_clock::now();
+  times.distance_to_in = chrono::duration<double, nano>(stop - start).count() / (double)max(n, (size_t)1);
+
+  n = 0;
+  start = chrono::steady_clock::now();
+  for (size_t i = 0; i < points.size(); ++i) {
+    if (inside[i] == kInside) {
+      times.checksum += solid->DistanceToOut(points[i], directions[i]);
+      ++n;
+    }
+  }
+  stop = chrono::steady_clock::now();
+  times.distance_to_out = chrono::duration<double, nano>(stop - start).count() / (double)max(n, (size_t)1);
+
+  return times;
+}
+
+int main(int argc, char *argv[]) {
+  struct arguments args;
+  argp_parse(&argp, argc, argv, 0, 0, &args);
+
+  HPGe_Collection collection;
+  const vector<Crystal> crystals = {
+      {"HPGe_55_TUNL_21638", collection.HPGe_55_TUNL_21638},
+      {"HPGe_55_TUNL_31524", collection.HPGe_55_TUNL_31524},
+      {"HPGe_60_TUNL_21033", collection.HPGe_60_TUNL_21033},
+      {"HPGe_60_TUNL_30986", collection.HPGe_60_TUNL_30986},
+      {"HPGe_60_TUNL_31061", collection.HPGe_60_TUNL_31061},
+      {"HPGe_60_TUNL_40663", collection.HPGe_60_TUNL_40663},
+      {"HPGe_120_TUNL_40383", collection.HPGe_120_TUNL_40383},
+      {"HPGe_80_TUD_90006", collection.HPGe_80_TUD_90006},
+      {"HPGe_100_TUD_72902", collection.HPGe_100_TUD_72902},
+      {"HPGe_100_TUD_72930", collection.HPGe_100_TUD_72930},
+      {"HPGe_100_TUD_73760", collection.HPGe_100_TUD_73760},
+      {"HPGe_100_Cologne_73954", collection.HPGe_100_Cologne_73954},
+      {"HPGe_86_Stuttgart_31120", collection.HPGe_86_Stuttgart_31120},
+      {"HPGe_ANL_31670", collection.HPGe_ANL_31670},
+      {"HPGe_ANL_41203", collection.HPGe_ANL_41203}};
+
+  mt19937_64 engine(args.seed);
+  uniform_real_distribution<double> uniform(0., 1.);
+
+  vector<string> rows;
+  double total_uniform = 0.;
+  double total_adaptive = 0.;
+
+  for (auto crystal : crystals) {
+    const double length = crystal.properties.detector_length;
+    const double radius = crystal.properties.detector_radius;
+
+    const PolyconeProfile adaptive_profile = HPGe_Coaxial::CrystalProfile(crystal.properties, args.max_deviation * um);
+    int n_planes_uniform = 0;
+    G4Polycone *uniform_solid = uniform_polycone(adaptive_profile, length, crystal.name + "_uniform", n_planes_uniform);
+    G4Polycone *adaptive_solid = new G4Polycone(crystal.name + "_adaptive", 0., 360. * deg, (G4int)adaptive_profile.GetNPlanes(), adaptive_profile.GetZPlanes(), adaptive_profile.GetRInner(), adaptive_profile.GetROuter());
+
+    vector<G4ThreeVector> points(args.n_points);
+    vector<G4ThreeVector> directions(args.n_points);
+    for (unsigned long i = 0; i < args.n_points; ++i) {
+      const double r = 1.1 * radius * sqrt(uniform(engine));
+      const double phi = 2. * M_PI * uniform(engine);
+      points[i] = G4ThreeVector(r * cos(phi), r * sin(phi), -0.05 * length + 1.1 * length * uniform(engine));
+      const double cos_theta = 2. * uniform(engine) - 1.;
+      const double phi_direction = 2. * M_PI * uniform(engine);
+      directions[i] = G4ThreeVector(sqrt(1. - cos_theta * cos_theta) * cos(phi_direction), sqrt(1. - cos_theta * cos_theta) * sin(phi_direction), cos_theta);
+    }
+
+    const NavigationTimes uniform_times = benchmark(uniform_solid, points, directions);
+    const NavigationTimes adaptive_times = benchmark(adaptive_solid, points, directions);
+    total_uniform += uniform_times.inside + uniform_times.distance_to_in + uniform_times.distance_to_out;
+    total_adaptive += adaptive_times.inside + adaptive_times.distance_to_in + adaptive_times.distance_to_out;
+
+    // The checksums are only printed to make sure that the compiler does not optimize the
+    // navigation away. They should be similar for both polycones.
+    ostringstream row;
+    row << left << setw(26) << crystal.name << right
+        << setw(8) << n_planes_uniform << setw(8) << adaptive_profile.GetNPlanes()
+        << fixed << setprecision(1)
+        << setw(10) << max_deviation(adaptive_profile, uniform_solid, length) / um
+        << setw(10) << max_deviation(adaptive_profile, adaptive_solid, length) / um
+        << setw(9) << uniform_times.inside << setw(9) << adaptive_times.inside
+        << setw(9) << uniform_times.distance_to_in << setw(9) << adaptive_times.distance_to_in
+        << setw(9) << uniform_times.distance_to_out << setw(9) << adaptive_times.distance_to_out
+        << scientific << setprecision(3) << setw(12) << uniform_times.checksum << setw(12) << adaptive_times.checksum;
+    rows.push_back(row.str());
+  }
+
+  // OptimizePolycone prints several lines for each polycone, so the table is printed in the end
+  cout << "Crystal polycones, uniform (500 steps, OptimizePolycone) vs. adaptive (maximum deviation " << args.max_deviation << " um), " << args.n_points << " random points and directions per crystal" << endl;
+  cout << left << setw(26) << "" << right << setw(16) << "z-planes" << setw(20) << "max. dev. [um]" << setw(18) << "Inside [ns]" << setw(18) << "DistToIn [ns]" << setw(18) << "DistToOut [ns]" << setw(24) << "checksum" << endl;
+  cout << left << setw(26) << "Crystal" << right;
+  cout << setw(8) << "uniform" << setw(8) << "adapt.";
+  cout << setw(10) << "uniform" << setw(10) << "adapt.";
+  for (int i = 0; i < 4; ++i)
+    cout << setw(9) << "uniform" << setw(9) << "adapt.";
+  cout << setw(12) << "uniform" << setw(12) << "adapt." << endl;
+  for (auto row : rows)
+    cout << row << endl;
+  cout << "Total time per Inside() + DistanceToIn() + DistanceToOut(): " << fixed << setprecision(1) << total_uniform << " ns (uniform), " << total_adaptive << " ns (adaptive), speedup " << setprecision(2) << total_uniform / total_adaptive << endl;
+
+  return 0;
+}
@@ -0,0 +1,186 @@
+#include <argp.h>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "CLHEP/Random/MixMaxRng.h"
+#include "CLHEP/Random/RanecuEngine.h"
+#include "G4Version.hh"
+#include "Randomize.hh"
+#if G4VERSION_NUMBER >= 1070
+#include "CLHEP/Random/RanluxppEngine.h"
+#endif
+
+#include "AngularDistribution.hh"
+#include "AngularDistributionSampler.hh"
+#include "PhiloxEngine.hh"
+
+static char doc[] = "RandomEngine_Benchmark";
+static char args_doc[] = "Check the Philox4x32-10 engine against the known-answer tests of Random123, and compare the number of random numbers per second of the engines which can be selected with /utr/random/engine, for plain calls and for the direction sampling of the AngularDistributionGenerator";
+
+struct arguments {
+  unsigned long n_numbers;
+  unsigned long seed;
+
+  arguments() : n_numbers(10000000), seed(1){};
+};
+
+static struct argp_option options[] = {
+    {0, 'n', "NNUMBERS", 0, "Number of random numbers per engine and workload (default: 10000000)"},
+    {0, 's', "SEED", 0, "Random number seed (default: 1)"},
+    {0, 0, 0, 0, 0}};
+
+static error_t parse_opt(int key, char *arg, struct argp_state *state) {
+
+  struct arguments *args = (struct arguments *)state->input;
+
+  switch (key) {
+    case ARGP_KEY_ARG:
+      break;
+    case 'n':
+      args->n_numbers = strtoul(arg, nullptr, 10);
+      break;
+    case 's':
+      args->seed = strtoul(arg, nullptr, 10);
+      break;
+    case ARGP_KEY_END:
+      break;
+    default:
+      return ARGP_ERR_UNKNOWN;
+  }
+
+  return 0;
+}
+
+static struct argp argp = {options, parse_opt, args_doc, doc, 0, 0, 0};
+
+using namespace std;
+
+// Known-answer tests of Philox4x32-10 from the Random123 distribution (kat_vectors)
+bool check_philox() {
+  const uint32_t counters[3][4] = {{0x00000000, 0x00000000, 0x00000000, 0x00000000},
+                                   {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+                                   {0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}};
+  const uint32_t keys[3][2] = {{0x00000000, 0x00000000},
+                               {0xffffffff, 0xffffffff},
+                               {0xa4093822, 0x299f31d0}};
+  const uint32_t expected[3][4] = {{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8},
+                                   {0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd},
+                                   {0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}};
+
+  bool passed = true;
+  for (unsigned int i = 0; i < 3; ++i) {
+    uint32_t result[4];
+    PhiloxEngine::Block(counters[i], keys[i], result);
+    for (unsigned int j = 0; j < 4; ++j) {
+      if (result[j] != expected[i][j]) {
+        passed = false;
+      }
+    }
+  }
+  return passed;
+}
+
+struct Engine {
+  string name;
+  CLHEP::HepRandomEngine *engine;
+};
+
+int main(int argc, char *argv[]) {
+  struct arguments args;
+  argp_parse(&argp, argc, argv, 0, 0, &args);
+
+  if (!check_philox()) {
+    cerr << "ERROR: PhiloxEngine does not reproduce the known-answer tests." << endl;
+    return 1;
+  }
+  cout << "PhiloxEngine reproduces the known-answer tests" << endl;
+
+  vector<Engine> engines = {{"ranecu", new CLHEP::RanecuEngine},
+                            {"mixmax", new CLHEP::MixMaxRng},
+#if G4VERSION_NUMBER >= 1070
+                            {"ranluxpp", new CLHEP::RanluxppEngine},
+#endif
+                            {"philox", new PhiloxEngine}};
+
+  // Workload of the AngularDistributionGenerator: the cascade 0+ -> 1+ -> 0+, sampled with the
+  // rejection loop of GeneratePrimaries() and with the tabulated inverse CDF (/ang/inverseCDF)
+  AngularDistribution angdist;
+  const double st[3] = {0., 1., 0.};
+  const double mix[2] = {0., 0.};
+  AngDistFunction ang_dist = angdist.GetAngDistFunction(st, 3);
+  double max_w = 0.;
+  for (unsigned int i = 0; i <= 100; ++i) {
+    for (unsigned int j = 0; j <= 100; ++j) {
+      max_w = max(max_w, ang_dist(M_PI * i / 100., 2. * M_PI * j / 100., mix));
+    }
+  }
+  max_w *= 1.05;
+  AngularDistributionSampler sampler;
+  sampler.Tabulate([&](double theta, double phi) { return ang_dist(theta, phi, mix); });
+
+  cout << "Random numbers per second for " << args.n_numbers << " numbers per engine and workload" << endl;
+  cout << left << setw(12) << "Engine" << right << setw(16) << "flat() [1/s]" << setw(16) << "flatArray [1/s]" << setw(16) << "rejection [1/s]" << setw(16) << "inverse [1/s]" << endl;
+
+  vector<double> buffer(1024);
+  for (auto &e : engines) {
+    long seeds[3] = {(long)args.seed, (long)args.seed + 1, 0};
+    e.engine->setSeeds(seeds, 0);
+    // G4UniformRand() calls the engine of the current thread, like in utr
+    G4Random::setTheEngine(e.engine);
+
+    double sum = 0.;
+    auto start = chrono::steady_clock::now();
+    for (unsigned long i = 0; i < args.n_numbers; ++i)
+      sum += G4UniformRand();
+    auto stop = chrono::steady_clock::now();
+    double t_flat = chrono::duration<double>(stop - start).count();
+
+    unsigned long n_numbers_array = 0;
+    start = chrono::steady_clock::now();
+    for (; n_numbers_array < args.n_numbers; n_numbers_array += buffer.size()) {
+      e.engine->flatArray((int)buffer.size(), buffer.data());
+      sum += buffer[0];
+    }
+    stop = chrono::steady_clock::now();
+    double t_array = chrono::duration<double>(stop - start).count();
+
+    // Each trial of the rejection sampling uses three random numbers
+    unsigned long n_numbers_rejection = 0;
+    start = chrono::steady_clock::now();
+    while (n_numbers_rejection < args.n_numbers) {
+      double random_theta = acos(2. * G4UniformRand() - 1.);
+      double random_phi = 2. * M_PI * G4UniformRand();
+      double random_w = G4UniformRand() * max_w;
+      n_numbers_rejection += 3;
+      if (random_w <= ang_dist(random_theta, random_phi, mix))
+        sum += random_theta + random_phi;
+    }
+    stop = chrono::steady_clock::now();
+    double t_rejection = chrono::duration<double>(stop - start).count();
+
+    unsigned long n_numbers_inverse = 0;
+    start = chrono::steady_clock::now();
+    for (; n_numbers_inverse < args.n_numbers; n_numbers_inverse += 3) {
+      double random_theta, random_phi;
+      sampler.Sample(G4UniformRand(), G4UniformRand(), G4UniformRand(), random_theta, random_phi);
+      sum += random_theta + random_phi;
+    }
+    stop = chrono::steady_clock::now();
+    double t_inverse = chrono::duration<double>(stop - start).count();
+
+    // Print the sum, so that the loops cannot be optimized away
+    cout << left << setw(12) << e.name << right << scientific << setprecision(3)
+         << setw(16) << (double)args.n_numbers / t_flat
+         << setw(16) << (double)n_numbers_array / t_array
+         << setw(16) << (double)n_numbers_rejection / t_rejection
+         << setw(16) << (double)n_numbers_inverse / t_inverse
+         << "  (checksum " << fixed << setprecision(0) << sum << ")" << endl;
+  }
+
+  return 0;
+}